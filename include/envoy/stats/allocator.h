@@ -58,6 +58,13 @@ public:
   virtual const SymbolTable& constSymbolTable() const PURE;
   virtual SymbolTable& symbolTable() PURE;
 
+  /**
+   * Counters subsequently created with one of the given tag-extracted names are spread across
+   * per-thread shards, so that workers incrementing them concurrently do not contend.
+   * @param names supplies the tag-extracted names of the counters to shard.
+   */
+  virtual void setShardedCounterNames(const std::vector<std::string>& names) PURE;
+
   // TODO(jmarantz): create a parallel mechanism to instantiate histograms. At
   // the moment, histograms don't fit the same pattern of counters and gauges
   // as they are not actually created in the context of a stats allocator.
@@ -24,6 +24,12 @@ public:
    * @return The buckets for the histogram. Each value is an upper bound of a bucket.
    */
   virtual ConstSupportedBuckets& buckets(absl::string_view stat_name) const PURE;
+
+  /**
+   * @return true if the histogram should record its values directly into the buckets returned by
+   * buckets(), rather than into a log-linear histogram from which the buckets are computed.
+   */
+  virtual bool fixedBuckets(absl::string_view stat_name) const PURE;
 };
 
 using HistogramSettingsConstPtr = std::unique_ptr<const HistogramSettings>;
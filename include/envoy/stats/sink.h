@@ -55,6 +55,14 @@ public:
    */
   virtual void flush(MetricSnapshot& snapshot) PURE;
 
+  /**
+   * @return whether flush() should only be passed the counters with a non-zero delta, the gauges
+   * updated and the histograms with samples recorded since the previous flush. Text readouts are
+   * always passed in full. Sinks that export absolute values to a backend which retains them
+   * between flushes can opt in to skip the work of exporting unchanged metrics.
+   */
+  virtual bool flushChangedMetricsOnly() const { return false; }
+
   /**
    * Flush a single histogram sample. Note: this call is called synchronously as a part of recording
    * the metric, so implementations must be thread-safe.
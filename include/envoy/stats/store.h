@@ -2,6 +2,7 @@
 
 #include <functional>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "envoy/common/pure.h"
@@ -85,6 +86,12 @@ public:
    */
   virtual void setHistogramSettings(HistogramSettingsConstPtr&& histogram_settings) PURE;
 
+  /**
+   * Shard counters subsequently created with one of the given tag-extracted names across threads.
+   * @param names supplies the tag-extracted names of the counters to shard.
+   */
+  virtual void setShardedCounterNames(const std::vector<std::string>& names) PURE;
+
   /**
    * Initialize the store for threading. This will be called once after all worker threads have
    * been initialized. At this point the store can initialize itself for multi-threaded operation.
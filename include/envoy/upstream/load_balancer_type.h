@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <set>
 #include <string>
 #include <vector>
@@ -22,7 +23,8 @@ enum class LoadBalancerType {
   RingHash,
   OriginalDst,
   Maglev,
-  ClusterProvided
+  ClusterProvided,
+  PeakEwma
 };
 
 /**
@@ -107,6 +109,18 @@ public:
    * elements in a list value defined in endpoint metadata.
    */
   virtual bool listAsAny() const PURE;
+
+  /*
+   * @return bool whether subsets are only created when a request first selects them, instead of
+   * for every combination of host metadata values when hosts change.
+   */
+  virtual bool lazySubsets() const PURE;
+
+  /*
+   * @return std::chrono::milliseconds the time after which a lazily created subset that no request
+   * selected is removed.
+   */
+  virtual std::chrono::milliseconds lazySubsetIdleTimeout() const PURE;
 };
 
 } // namespace Upstream
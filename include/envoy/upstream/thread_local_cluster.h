@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+
 #include "envoy/common/pure.h"
 #include "envoy/upstream/load_balancer.h"
 #include "envoy/upstream/upstream.h"
@@ -32,6 +34,15 @@ public:
    * @return LoadBalancer& the backing load balancer.
    */
   virtual LoadBalancer& loadBalancer() PURE;
+
+  /**
+   * Record the response time of a request sent to a host of this cluster, for load balancers
+   * that take the response times of hosts into account.
+   * @param host supplies the host that the request was sent to.
+   * @param response_time supplies the time from the end of the request to the end of the response.
+   */
+  virtual void putResponseTime(const HostDescription& host,
+                               std::chrono::microseconds response_time) PURE;
 };
 
 } // namespace Upstream
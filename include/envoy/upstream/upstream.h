@@ -518,7 +518,9 @@ public:
 #define ALL_CLUSTER_STATS(COUNTER, GAUGE, HISTOGRAM)                                               \
   COUNTER(assignment_stale)                                                                        \
   COUNTER(assignment_timeout_received)                                                             \
-  COUNTER(bind_errors)                                                                             \
+  COUNTER(lb_bounded_load_all_hosts_overloaded)                                                    \
+  COUNTER(lb_bounded_load_overflow)                                                                \
+  COUNTER(lb_bounded_load_overflow_probes)                                                         \
   COUNTER(lb_healthy_panic)                                                                        \
   COUNTER(lb_local_cluster_not_ok)                                                                 \
   COUNTER(lb_recalculate_zone_structures)                                                          \
@@ -535,12 +537,28 @@ public:
   COUNTER(lb_zone_routing_sampled)                                                                 \
   COUNTER(membership_change)                                                                       \
   COUNTER(original_dst_host_invalid)                                                               \
-  COUNTER(retry_or_shadow_abandoned)                                                               \
   COUNTER(update_attempt)                                                                          \
   COUNTER(update_empty)                                                                            \
   COUNTER(update_failure)                                                                          \
   COUNTER(update_no_rebuild)                                                                       \
   COUNTER(update_success)                                                                          \
+  COUNTER(upstream_cx_none_healthy)                                                                \
+  GAUGE(lb_subsets_active, Accumulate)                                                             \
+  GAUGE(max_host_weight, NeverImport)                                                              \
+  GAUGE(membership_degraded, NeverImport)                                                          \
+  GAUGE(membership_excluded, NeverImport)                                                          \
+  GAUGE(membership_healthy, NeverImport)                                                           \
+  GAUGE(membership_total, NeverImport)                                                             \
+  GAUGE(version, NeverImport)
+
+/**
+ * All cluster stats that are only updated by traffic to the cluster, as opposed to configuration
+ * updates, host set changes or load balancing. These can be created on first use, see
+ * ClusterInfo::trafficStats(). @see stats_macros.h
+ */
+#define ALL_CLUSTER_TRAFFIC_STATS(COUNTER, GAUGE, HISTOGRAM)                                       \
+  COUNTER(bind_errors)                                                                             \
+  COUNTER(retry_or_shadow_abandoned)                                                               \
   COUNTER(upstream_cx_close_notify)                                                                \
   COUNTER(upstream_cx_connect_attempts_exceeded)                                                   \
   COUNTER(upstream_cx_connect_fail)                                                                \
@@ -555,7 +573,6 @@ public:
   COUNTER(upstream_cx_http2_total)                                                                 \
   COUNTER(upstream_cx_idle_timeout)                                                                \
   COUNTER(upstream_cx_max_requests)                                                                \
-  COUNTER(upstream_cx_none_healthy)                                                                \
   COUNTER(upstream_cx_overflow)                                                                    \
   COUNTER(upstream_cx_pool_overflow)                                                               \
   COUNTER(upstream_cx_protocol_error)                                                              \
@@ -586,18 +603,11 @@ public:
   COUNTER(upstream_rq_timeout)                                                                     \
   COUNTER(upstream_rq_total)                                                                       \
   COUNTER(upstream_rq_tx_reset)                                                                    \
-  GAUGE(lb_subsets_active, Accumulate)                                                             \
-  GAUGE(max_host_weight, NeverImport)                                                              \
-  GAUGE(membership_degraded, NeverImport)                                                          \
-  GAUGE(membership_excluded, NeverImport)                                                          \
-  GAUGE(membership_healthy, NeverImport)                                                           \
-  GAUGE(membership_total, NeverImport)                                                             \
   GAUGE(upstream_cx_active, Accumulate)                                                            \
   GAUGE(upstream_cx_rx_bytes_buffered, Accumulate)                                                 \
   GAUGE(upstream_cx_tx_bytes_buffered, Accumulate)                                                 \
   GAUGE(upstream_rq_active, Accumulate)                                                            \
   GAUGE(upstream_rq_pending_active, Accumulate)                                                    \
-  GAUGE(version, NeverImport)                                                                      \
   HISTOGRAM(upstream_cx_connect_ms, Milliseconds)                                                  \
   HISTOGRAM(upstream_cx_length_ms, Milliseconds)
 
@@ -647,6 +657,14 @@ struct ClusterStats {
   ALL_CLUSTER_STATS(GENERATE_COUNTER_STRUCT, GENERATE_GAUGE_STRUCT, GENERATE_HISTOGRAM_STRUCT)
 };
 
+/**
+ * Struct definition for all cluster traffic stats. @see stats_macros.h
+ */
+struct ClusterTrafficStats {
+  ALL_CLUSTER_TRAFFIC_STATS(GENERATE_COUNTER_STRUCT, GENERATE_GAUGE_STRUCT,
+                            GENERATE_HISTOGRAM_STRUCT)
+};
+
 /**
  * Struct definition for all cluster load report stats. @see stats_macros.h
  */
@@ -811,6 +829,12 @@ public:
   virtual const absl::optional<envoy::config::cluster::v3::Cluster::LeastRequestLbConfig>&
   lbLeastRequestConfig() const PURE;
 
+  /**
+   * @return configuration for peak EWMA load balancing, only used if LB type is peak EWMA.
+   */
+  virtual const absl::optional<envoy::config::cluster::v3::Cluster::PeakEwmaLbConfig>&
+  lbPeakEwmaConfig() const PURE;
+
   /**
    * @return configuration for ring hash load balancing, only used if type is set to ring_hash_lb.
    */
@@ -881,6 +905,19 @@ public:
    */
   virtual ClusterStats& stats() const PURE;
 
+  /**
+   * @return ClusterTrafficStats& strongly named stats for the traffic to this cluster. If the
+   *         cluster creates them lazily, this creates them on the first call.
+   */
+  virtual ClusterTrafficStats& trafficStats() const PURE;
+
+  /**
+   * @return bool whether trafficStats() has been created, i.e. whether the cluster either creates
+   *         them eagerly or has been used. This allows inspecting the traffic stats of a cluster
+   *         without creating them.
+   */
+  virtual bool trafficStatsCreated() const PURE;
+
   /**
    * @return the stats scope that contains all cluster stats. This can be used to produce dynamic
    *         stats that will be freed when the cluster is removed.
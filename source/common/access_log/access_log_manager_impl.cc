@@ -43,7 +43,10 @@ AccessLogFileImpl::AccessLogFileImpl(Filesystem::FilePtr&& file, Event::Dispatch
     : file_(std::move(file)), file_lock_(lock),
       flush_timer_(dispatcher.createTimer([this]() -> void {
         stats_.flushed_by_timer_.inc();
-        flush_event_.notifyOne();
+        {
+          Thread::LockGuard lock(flush_event_lock_);
+          flush_event_.notifyOne();
+        }
         flush_timer_->enableTimer(flush_interval_msec_);
       })),
       thread_factory_(thread_factory), flush_interval_msec_(flush_interval_msec), stats_(stats) {
@@ -68,9 +71,16 @@ void AccessLogFileImpl::open() {
 
 void AccessLogFileImpl::reopen() { reopen_file_ = true; }
 
+uint32_t AccessLogFileImpl::writeShardIndex() {
+  static std::atomic<uint32_t> next_shard_index{};
+  static thread_local const uint32_t shard_index =
+      next_shard_index.fetch_add(1, std::memory_order_relaxed) % NumWriteShards;
+  return shard_index;
+}
+
 AccessLogFileImpl::~AccessLogFileImpl() {
   {
-    Thread::LockGuard lock(write_lock_);
+    Thread::LockGuard lock(flush_event_lock_);
     flush_thread_exit_ = true;
     flush_event_.notifyOne();
   }
@@ -81,8 +91,10 @@ AccessLogFileImpl::~AccessLogFileImpl() {
 
   // Flush any remaining data. If file was not opened for some reason, skip flushing part.
   if (file_->isOpen()) {
-    if (flush_buffer_.length() > 0) {
-      doWrite(flush_buffer_);
+    Thread::LockGuard flush_lock(flush_lock_);
+    collectWriteShards();
+    if (about_to_write_buffer_.length() > 0) {
+      doWrite(about_to_write_buffer_);
     }
 
     const Api::IoCallBoolResult result = file_->close();
@@ -91,6 +103,22 @@ AccessLogFileImpl::~AccessLogFileImpl() {
   }
 }
 
+void AccessLogFileImpl::collectWriteShards() {
+  for (WriteShard& shard : write_shards_) {
+    Thread::LockGuard shard_lock(shard.lock_);
+    about_to_write_buffer_.move(shard.buffer_);
+    shard.length_.store(0, std::memory_order_relaxed);
+  }
+}
+
+uint64_t AccessLogFileImpl::writeShardsLength() const {
+  uint64_t length = 0;
+  for (const WriteShard& shard : write_shards_) {
+    length += shard.length_.load(std::memory_order_relaxed);
+  }
+  return length;
+}
+
 void AccessLogFileImpl::doWrite(Buffer::Instance& buffer) {
   Buffer::RawSliceVector slices = buffer.getRawSlices();
 
@@ -123,27 +151,24 @@ void AccessLogFileImpl::doWrite(Buffer::Instance& buffer) {
 void AccessLogFileImpl::flushThreadFunc() {
 
   while (true) {
-    std::unique_lock<Thread::BasicLockable> flush_lock;
-
     {
-      Thread::LockGuard write_lock(write_lock_);
+      Thread::LockGuard event_lock(flush_event_lock_);
 
-      // flush_event_ can be woken up either by large enough flush_buffer or by timer.
-      // In case it was timer, flush_buffer_ can be empty.
-      while (flush_buffer_.length() == 0 && !flush_thread_exit_ && !reopen_file_) {
+      // flush_event_ can be woken up either by large enough write shards or by timer.
+      // In case it was timer, the write shards can be empty.
+      while (writeShardsLength() == 0 && !flush_thread_exit_ && !reopen_file_) {
         // CondVar::wait() does not throw, so it's safe to pass the mutex rather than the guard.
-        flush_event_.wait(write_lock_);
+        flush_event_.wait(flush_event_lock_);
       }
 
       if (flush_thread_exit_) {
         return;
       }
-
-      flush_lock = std::unique_lock<Thread::BasicLockable>(flush_lock_);
-      about_to_write_buffer_.move(flush_buffer_);
-      ASSERT(flush_buffer_.length() == 0);
     }
 
+    Thread::LockGuard flush_lock(flush_lock_);
+    collectWriteShards();
+
     // if we failed to open file before, then simply ignore
     if (file_->isOpen()) {
       try {
@@ -164,40 +189,41 @@ void AccessLogFileImpl::flushThreadFunc() {
 }
 
 void AccessLogFileImpl::flush() {
-  std::unique_lock<Thread::BasicLockable> flush_buffer_lock;
+  // The flush thread holds flush_lock_ from collecting the write shards until the data is written,
+  // so once flush_lock_ is held here no previously written data can still be in flight.
+  Thread::LockGuard flush_lock(flush_lock_);
+  collectWriteShards();
 
-  {
-    Thread::LockGuard write_lock(write_lock_);
-
-    // flush_lock_ must be held while checking this or else it is
-    // possible that flushThreadFunc() has already moved data from
-    // flush_buffer_ to about_to_write_buffer_, has unlocked write_lock_,
-    // but has not yet completed doWrite(). This would allow flush() to
-    // return before the pending data has actually been written to disk.
-    flush_buffer_lock = std::unique_lock<Thread::BasicLockable>(flush_lock_);
-
-    if (flush_buffer_.length() == 0) {
-      return;
-    }
-
-    about_to_write_buffer_.move(flush_buffer_);
-    ASSERT(flush_buffer_.length() == 0);
+  if (about_to_write_buffer_.length() == 0) {
+    return;
   }
 
   doWrite(about_to_write_buffer_);
 }
 
 void AccessLogFileImpl::write(absl::string_view data) {
-  Thread::LockGuard lock(write_lock_);
+  stats_.write_buffered_.inc();
+  stats_.write_total_buffered_.add(data.length());
 
-  if (flush_thread_ == nullptr) {
-    createFlushStructures();
+  // Only the length of this thread's shard is checked, so that writers do not contend on a shared
+  // total. Up to NumWriteShards * MIN_FLUSH_SIZE bytes can be buffered until the flush timer fires.
+  uint64_t buffered_length;
+  {
+    WriteShard& shard = write_shards_[writeShardIndex()];
+    Thread::LockGuard lock(shard.lock_);
+    shard.buffer_.add(data.data(), data.size());
+    buffered_length = shard.buffer_.length();
+    shard.length_.store(buffered_length, std::memory_order_relaxed);
   }
 
-  stats_.write_buffered_.inc();
-  stats_.write_total_buffered_.add(data.length());
-  flush_buffer_.add(data.data(), data.size());
-  if (flush_buffer_.length() > MIN_FLUSH_SIZE) {
+  if (!flush_thread_started_) {
+    // The flush thread is started after the data has been added, so its first loop flushes it.
+    Thread::LockGuard lock(flush_event_lock_);
+    if (flush_thread_ == nullptr) {
+      createFlushStructures();
+    }
+  } else if (buffered_length > MIN_FLUSH_SIZE) {
+    Thread::LockGuard lock(flush_event_lock_);
     flush_event_.notifyOne();
   }
 }
@@ -206,6 +232,7 @@ void AccessLogFileImpl::createFlushStructures() {
   flush_thread_ = thread_factory_.createThread([this]() -> void { flushThreadFunc(); },
                                                Thread::Options{"AccessLogFlush"});
   flush_timer_->enableTimer(flush_interval_msec_);
+  flush_thread_started_ = true;
 }
 
 } // namespace AccessLog
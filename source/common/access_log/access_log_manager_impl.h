@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <string>
 
 #include "envoy/access_log/access_log.h"
@@ -61,6 +63,10 @@ private:
  * This implementation uses a flush thread per file, with the idea there aren't that many
  * files. If this turns out to be a good implementation we can potentially have a single flush
  * thread that flushes all files, but we will start with this.
+ *
+ * Writers append to one of several write shards, picked per thread, so that workers logging to the
+ * same file do not all contend on a single lock. Lines written by one thread are flushed in order;
+ * lines written by different threads within one flush interval may be reordered.
  */
 class AccessLogFileImpl : public AccessLogFile {
 public:
@@ -82,6 +88,24 @@ public:
   void flush() override;
 
 private:
+  // A buffer that writes are appended to. Aligned so that shards used by different threads do not
+  // share a cache line.
+  struct alignas(64) WriteShard {
+    Thread::MutexBasicLockable lock_;
+    Buffer::OwnedImpl buffer_ ABSL_GUARDED_BY(lock_);
+    // The length of buffer_, only updated under lock_ but read by the flush thread without it.
+    std::atomic<uint64_t> length_{};
+  };
+
+  static constexpr uint32_t NumWriteShards = 16;
+
+  // return the write shard used by the calling thread
+  static uint32_t writeShardIndex();
+
+  // Moves the contents of all write shards to about_to_write_buffer_. flush_lock_ must be held.
+  void collectWriteShards() ABSL_EXCLUSIVE_LOCKS_REQUIRED(flush_lock_);
+  // Total number of bytes in the write shards. Only used by the flush thread.
+  uint64_t writeShardsLength() const;
   void doWrite(Buffer::Instance& buffer);
   void flushThreadFunc();
   void open();
@@ -90,15 +114,16 @@ private:
   // return default flags set which used by open
   static Filesystem::FlagSet defaultFlags();
 
-  // Minimum size before the flush thread will be told to flush.
+  // Minimum size of a write shard before the flush thread will be told to flush.
   static const uint64_t MIN_FLUSH_SIZE = 1024 * 64;
 
   Filesystem::FilePtr file_;
 
   // These locks are always acquired in the following order if multiple locks are held:
-  //    1) write_lock_
-  //    2) flush_lock_
+  //    1) flush_lock_
+  //    2) a WriteShard::lock_
   //    3) file_lock_
+  // flush_event_lock_ is never held together with any other lock.
   Thread::BasicLockable& file_lock_;      // This lock is used only by the flush thread when writing
                                           // to disk. This is used to make sure that file blocks do
                                           // not get interleaved by multiple processes writing to
@@ -109,23 +134,24 @@ private:
                                           // and all other data used during flushing and file
                                           // re-opening.
   Thread::MutexBasicLockable
-      write_lock_; // The lock is used when filling the flush buffer. It allows
-                   // multiple threads to write to the same file at relatively
-                   // high performance. It is always local to the process.
+      flush_event_lock_; // The lock flush_event_ is waited on and signalled under. It also
+                         // serializes starting the flush thread. Writers only take it to start
+                         // or wake up the flush thread.
   Thread::ThreadPtr flush_thread_;
   Thread::CondVar flush_event_;
+  std::atomic<bool> flush_thread_started_{};
   std::atomic<bool> flush_thread_exit_{};
   std::atomic<bool> reopen_file_{};
-  Buffer::OwnedImpl
-      flush_buffer_ ABSL_GUARDED_BY(write_lock_); // This buffer is used by multiple threads. It
-                                                  // gets filled and then flushed either when max
-                                                  // size is reached or when a timer fires.
+  std::array<WriteShard, NumWriteShards> write_shards_; // These buffers are used by multiple
+                                                        // threads. They get filled and then
+                                                        // flushed either when max size is reached
+                                                        // or when a timer fires.
   // TODO(jmarantz): this should be ABSL_GUARDED_BY(flush_lock_) but the analysis cannot poke
   // through the std::make_unique assignment. I do not believe it's possible to annotate this
   // properly now due to limitations in the clang thread annotation analysis.
   Buffer::OwnedImpl about_to_write_buffer_; // This buffer is used only by the flush thread. Data
-                                            // is moved from flush_buffer_ under lock, and then
-                                            // the lock is released so that flush_buffer_ can
+                                            // is moved from write_shards_ under lock, and then
+                                            // the lock is released so that the shards can
                                             // continue to fill. This buffer is then used for the
                                             // final write to disk.
   Event::TimerPtr flush_timer_;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <deque>
 #include <string>
@@ -253,6 +254,56 @@ protected:
 
 using SlicePtr = std::unique_ptr<Slice>;
 
+/**
+ * Allocator for OwnedSlice storage. Blocks of the most common sizes (a single 4KiB page, and the
+ * 20KiB, 40KiB and 80KiB slices that socket reads fill) are recycled through a small per-thread
+ * free list, so a worker that repeatedly creates and frees such slices does not need to go through
+ * the global allocator. Each thread retains at most MaxRetainedBytesPerSize bytes of each size;
+ * all other sizes are passed straight through to ::operator new and ::operator delete. Blocks
+ * carry no bookkeeping of their own, so a page-sized request stays in the allocator's page-sized
+ * class and callers must supply the size again on deallocation.
+ */
+class SliceAllocator {
+public:
+  static constexpr size_t MaxRetainedBytesPerSize = 256 * 1024;
+
+  struct Stats {
+    // Number of cacheable allocations served from a thread's free list.
+    uint64_t hits_;
+    // Number of cacheable allocations that had to go to the global allocator.
+    uint64_t misses_;
+    // Bytes currently held in free lists across all threads.
+    uint64_t retained_bytes_;
+  };
+
+  /**
+   * @param size the number of usable bytes to allocate.
+   * @return a pointer to at least size bytes, suitably aligned for any OwnedSlice.
+   */
+  static void* allocate(size_t size);
+
+  /**
+   * Return a block obtained from allocate(). The block may be retained by the calling thread.
+   * @param address the pointer returned by allocate().
+   * @param size the size that was passed to allocate().
+   */
+  static void deallocate(void* address, size_t size);
+
+  /**
+   * @return Stats the allocator statistics aggregated across all threads, including threads that
+   *               have exited.
+   */
+  static Stats stats();
+
+  /**
+   * Enable or disable the per-thread caches for all threads. While disabled, every allocation goes
+   * to the global allocator and freed blocks are not retained. Blocks already retained are kept
+   * until the cache is enabled again or the owning thread exits. The cache is enabled by default.
+   * @param enabled supplies whether the per-thread caches should be used.
+   */
+  static void setCacheEnabled(bool enabled);
+};
+
 // OwnedSlice can not be derived from as it has variable sized array as member.
 class OwnedSlice final : public Slice, public InlineStorage {
 public:
@@ -281,9 +332,39 @@ public:
     return slice;
   }
 
+  /**
+   * @param allocation_size the number of bytes to allocate for the slice, a multiple of the page
+   *        size.
+   * @return the capacity to request from create() so that the slice fills exactly allocation_size
+   *         bytes. Sizing reads this way keeps them in the sizes that SliceAllocator recycles.
+   */
+  static constexpr uint64_t capacityForAllocation(uint64_t allocation_size) {
+    return allocation_size - sizeof(OwnedSlice);
+  }
+
+  // Route slice storage through SliceAllocator rather than InlineStorage's global allocation.
+  // Without C++20 destroying delete the slice's capacity can not be read here, so the destructor
+  // hands the allocation size over through deallocation_size_.
+  static void operator delete(void* address) {
+    SliceAllocator::deallocate(address, deallocation_size_);
+  }
+
+  ~OwnedSlice() override {
+    // Drain trackers may free other slices on this thread, so run them before setting the size.
+    callAndClearDrainTrackers();
+    deallocation_size_ = sizeof(OwnedSlice) + capacity_;
+  }
+
 private:
+  static void* operator new(size_t object_size, size_t data_size_bytes) {
+    return SliceAllocator::allocate(object_size + data_size_bytes);
+  }
+
   OwnedSlice(uint64_t size) : Slice(0, 0, size) { base_ = storage_; }
 
+  // Size of the slice being deleted on this thread, set by the destructor for operator delete.
+  static thread_local size_t deallocation_size_;
+
   bool isMutable() const override { return true; }
 
   /**
@@ -132,6 +132,27 @@ CompiledMatcherPtr Utility::parseStdRegexAsCompiledMatcher(const std::string& re
   return std::make_unique<CompiledStdMatcher>(parseStdRegex(regex, flags));
 }
 
+GoogleReSet::GoogleReSet(const std::vector<std::string>& regexes)
+    : set_(re2::RE2::Quiet, re2::RE2::ANCHOR_BOTH) {
+  for (const std::string& regex : regexes) {
+    std::string error;
+    if (set_.Add(regex, &error) < 0) {
+      throw EnvoyException(fmt::format("Invalid regex '{}': {}", regex, error));
+    }
+  }
+  if (!set_.Compile()) {
+    throw EnvoyException("unable to compile regex set: out of memory");
+  }
+}
+
+bool GoogleReSet::match(absl::string_view value, std::vector<int>& matches) const {
+  re2::RE2::Set::ErrorInfo error_info;
+  if (set_.Match(re2::StringPiece(value.data(), value.size()), &matches, &error_info)) {
+    return true;
+  }
+  return error_info.kind == re2::RE2::Set::kNoError;
+}
+
 std::regex Utility::parseStdRegex(const std::string& regex, std::regex::flag_type flags) {
   // TODO(zuercher): In the future, PGV (https://github.com/envoyproxy/protoc-gen-validate)
   // annotations may allow us to remove this in favor of direct validation of regular
@@ -2,10 +2,15 @@
 
 #include <memory>
 #include <regex>
+#include <string>
+#include <vector>
 
 #include "envoy/common/regex.h"
 #include "envoy/type/matcher/v3/regex.pb.h"
 
+#include "absl/strings/string_view.h"
+#include "re2/set.h"
+
 namespace Envoy {
 namespace Regex {
 
@@ -40,5 +45,35 @@ public:
   static CompiledMatcherPtr parseRegex(const envoy::type::matcher::v3::RegexMatcher& matcher);
 };
 
+/**
+ * A set of Google RE2 regular expressions that are all matched against a value in a single pass,
+ * with the same full match semantics as the matchers returned by Utility::parseRegex().
+ */
+class GoogleReSet {
+public:
+  /**
+   * @param regexes supplies the regular expressions in the set.
+   * @throw EnvoyException if any of the regular expressions is invalid, or if RE2 runs out of
+   *        memory compiling the set, which a few hundred regular expressions can cause.
+   */
+  explicit GoogleReSet(const std::vector<std::string>& regexes);
+
+  /**
+   * Find all regular expressions in the set that match a value.
+   * @param value supplies the value to match.
+   * @param matches supplies the list the positions of the matching regular expressions in the
+   *                constructor argument are written to, in no particular order.
+   * @return bool false if the set could not be evaluated, for example because RE2 ran out of
+   *              memory for this input. matches is then unspecified and the caller must match each
+   *              regular expression separately.
+   */
+  bool match(absl::string_view value, std::vector<int>& matches) const;
+
+private:
+  re2::RE2::Set set_;
+};
+
+using GoogleReSetPtr = std::unique_ptr<const GoogleReSet>;
+
 } // namespace Regex
 } // namespace Envoy
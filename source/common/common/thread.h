@@ -139,6 +139,12 @@ public:
     return atomic_ref.load();
   }
 
+  /**
+   * @param index the Index to look up.
+   * @return whether no T* has been saved at the index yet.
+   */
+  bool isNull(uint32_t index) const { return data_[index].load() == nullptr; }
+
 private:
   std::atomic<T*> data_[size];
   absl::Mutex mutex_;
@@ -166,6 +172,11 @@ public:
    * @return The new or already-existing T*, possibly nullptr if make_object returns nullptr.
    */
   T* get(const MakeObject& make_object) { return BaseClass::get(0, make_object); }
+
+  /**
+   * @return whether no T* has been saved yet.
+   */
+  bool isNull() const { return BaseClass::isNull(0); }
 };
 
 } // namespace Thread
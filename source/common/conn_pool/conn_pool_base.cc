@@ -94,7 +94,7 @@ bool ConnPoolImplBase::tryCreateNewConnection(float global_prefetch_ratio) {
   const bool can_create_connection =
       host_->cluster().resourceManager(priority_).connections().canCreate();
   if (!can_create_connection) {
-    host_->cluster().stats().upstream_cx_overflow_.inc();
+    host_->cluster().trafficStats().upstream_cx_overflow_.inc();
   }
   // If we are at the connection circuit-breaker limit due to other upstreams having
   // too many open connections, and this upstream has no connections, always create one, to
@@ -121,14 +121,14 @@ void ConnPoolImplBase::attachStreamToClient(Envoy::ConnectionPool::ActiveClient&
     ENVOY_LOG(debug, "max streams overflow");
     onPoolFailure(client.real_host_description_, absl::string_view(),
                   ConnectionPool::PoolFailureReason::Overflow, context);
-    host_->cluster().stats().upstream_rq_pending_overflow_.inc();
+    host_->cluster().trafficStats().upstream_rq_pending_overflow_.inc();
   } else {
     ENVOY_CONN_LOG(debug, "creating stream", client);
 
     client.remaining_streams_--;
     if (client.remaining_streams_ == 0) {
       ENVOY_CONN_LOG(debug, "maximum streams per connection, DRAINING", client);
-      host_->cluster().stats().upstream_cx_max_requests_.inc();
+      host_->cluster().trafficStats().upstream_cx_max_requests_.inc();
       transitionActiveClientState(client, Envoy::ConnectionPool::ActiveClient::State::DRAINING);
     } else if (client.numActiveStreams() + 1 >= client.concurrent_stream_limit_) {
       // As soon as the new stream is created, the client will be maxed out.
@@ -138,8 +138,8 @@ void ConnPoolImplBase::attachStreamToClient(Envoy::ConnectionPool::ActiveClient&
     num_active_streams_++;
     host_->stats().rq_total_.inc();
     host_->stats().rq_active_.inc();
-    host_->cluster().stats().upstream_rq_total_.inc();
-    host_->cluster().stats().upstream_rq_active_.inc();
+    host_->cluster().trafficStats().upstream_rq_total_.inc();
+    host_->cluster().trafficStats().upstream_rq_active_.inc();
     host_->cluster().resourceManager(priority_).requests().inc();
 
     onPoolReady(client, context);
@@ -152,7 +152,7 @@ void ConnPoolImplBase::onStreamClosed(Envoy::ConnectionPool::ActiveClient& clien
   ASSERT(num_active_streams_ > 0);
   num_active_streams_--;
   host_->stats().rq_active_.dec();
-  host_->cluster().stats().upstream_rq_active_.dec();
+  host_->cluster().trafficStats().upstream_rq_active_.dec();
   host_->cluster().resourceManager(priority_).requests().dec();
   if (client.state_ == ActiveClient::State::DRAINING && client.numActiveStreams() == 0) {
     // Close out the draining client if we no longer have active streams.
@@ -190,7 +190,7 @@ ConnectionPool::Cancellable* ConnPoolImplBase::newStream(AttachContext& context)
     ENVOY_LOG(debug, "max pending streams overflow");
     onPoolFailure(nullptr, absl::string_view(), ConnectionPool::PoolFailureReason::Overflow,
                   context);
-    host_->cluster().stats().upstream_rq_pending_overflow_.inc();
+    host_->cluster().trafficStats().upstream_rq_pending_overflow_.inc();
     return nullptr;
   }
 }
@@ -320,7 +320,7 @@ void ConnPoolImplBase::onConnectionEvent(ActiveClient& client, absl::string_view
     }
 
     if (client.state_ == ActiveClient::State::CONNECTING) {
-      host_->cluster().stats().upstream_cx_connect_fail_.inc();
+      host_->cluster().trafficStats().upstream_cx_connect_fail_.inc();
       host_->stats().cx_connect_fail_.inc();
 
       ConnectionPool::PoolFailureReason reason;
@@ -378,13 +378,13 @@ void ConnPoolImplBase::onConnectionEvent(ActiveClient& client, absl::string_view
 }
 
 PendingStream::PendingStream(ConnPoolImplBase& parent) : parent_(parent) {
-  parent_.host()->cluster().stats().upstream_rq_pending_total_.inc();
-  parent_.host()->cluster().stats().upstream_rq_pending_active_.inc();
+  parent_.host()->cluster().trafficStats().upstream_rq_pending_total_.inc();
+  parent_.host()->cluster().trafficStats().upstream_rq_pending_active_.inc();
   parent_.host()->cluster().resourceManager(parent_.priority()).pendingRequests().inc();
 }
 
 PendingStream::~PendingStream() {
-  parent_.host()->cluster().stats().upstream_rq_pending_active_.dec();
+  parent_.host()->cluster().trafficStats().upstream_rq_pending_active_.dec();
   parent_.host()->cluster().resourceManager(parent_.priority()).pendingRequests().dec();
 }
 
@@ -401,7 +401,7 @@ void ConnPoolImplBase::purgePendingStreams(
   while (!pending_streams_to_purge_.empty()) {
     PendingStreamPtr stream =
         pending_streams_to_purge_.front()->removeFromList(pending_streams_to_purge_);
-    host_->cluster().stats().upstream_rq_pending_failure_eject_.inc();
+    host_->cluster().trafficStats().upstream_rq_pending_failure_eject_.inc();
     onPoolFailure(host_description, failure_reason, reason, stream->context());
   }
 }
@@ -440,7 +440,7 @@ void ConnPoolImplBase::onPendingStreamCancel(PendingStream& stream,
     client.close();
   }
 
-  host_->cluster().stats().upstream_rq_cancelled_.inc();
+  host_->cluster().trafficStats().upstream_rq_cancelled_.inc();
   checkForDrained();
 }
 
@@ -458,14 +458,16 @@ ActiveClient::ActiveClient(ConnPoolImplBase& parent, uint64_t lifetime_stream_li
       concurrent_stream_limit_(translateZeroToUnlimited(concurrent_stream_limit)),
       connect_timer_(parent_.dispatcher().createTimer([this]() -> void { onConnectTimeout(); })) {
   conn_connect_ms_ = std::make_unique<Stats::HistogramCompletableTimespanImpl>(
-      parent_.host()->cluster().stats().upstream_cx_connect_ms_, parent_.dispatcher().timeSource());
+      parent_.host()->cluster().trafficStats().upstream_cx_connect_ms_,
+      parent_.dispatcher().timeSource());
   conn_length_ = std::make_unique<Stats::HistogramCompletableTimespanImpl>(
-      parent_.host()->cluster().stats().upstream_cx_length_ms_, parent_.dispatcher().timeSource());
+      parent_.host()->cluster().trafficStats().upstream_cx_length_ms_,
+      parent_.dispatcher().timeSource());
   connect_timer_->enableTimer(parent_.host()->cluster().connectTimeout());
   parent_.host()->stats().cx_total_.inc();
   parent_.host()->stats().cx_active_.inc();
-  parent_.host()->cluster().stats().upstream_cx_total_.inc();
-  parent_.host()->cluster().stats().upstream_cx_active_.inc();
+  parent_.host()->cluster().trafficStats().upstream_cx_total_.inc();
+  parent_.host()->cluster().trafficStats().upstream_cx_active_.inc();
   parent_.host()->cluster().resourceManager(parent_.priority()).connections().inc();
 }
 
@@ -481,7 +483,7 @@ void ActiveClient::releaseResources() {
 
     conn_length_->complete();
 
-    parent_.host()->cluster().stats().upstream_cx_active_.dec();
+    parent_.host()->cluster().trafficStats().upstream_cx_active_.dec();
     parent_.host()->stats().cx_active_.dec();
     parent_.host()->cluster().resourceManager(parent_.priority()).connections().dec();
   }
@@ -489,7 +491,7 @@ void ActiveClient::releaseResources() {
 
 void ActiveClient::onConnectTimeout() {
   ENVOY_CONN_LOG(debug, "connect timeout", *this);
-  parent_.host()->cluster().stats().upstream_cx_connect_timeout_.inc();
+  parent_.host()->cluster().trafficStats().upstream_cx_connect_timeout_.inc();
   timed_out_ = true;
   close();
 }
@@ -1,6 +1,8 @@
 #include "common/formatter/substitution_formatter.h"
 
+#include <algorithm>
 #include <climits>
+#include <cmath>
 #include <cstdint>
 #include <regex>
 #include <string>
@@ -19,8 +21,10 @@
 #include "common/http/utility.h"
 #include "common/protobuf/message_validator_impl.h"
 #include "common/protobuf/utility.h"
+#include "common/runtime/runtime_features.h"
 #include "common/stream_info/utility.h"
 
+#include "absl/strings/numbers.h"
 #include "absl/strings/str_split.h"
 #include "fmt/format.h"
 
@@ -52,6 +56,132 @@ const std::regex& getNewlinePattern() { CONSTRUCT_ON_FIRST_USE(std::regex, "\n")
 template <class... Ts> struct JsonFormatMapVisitor : Ts... { using Ts::operator()...; };
 template <class... Ts> JsonFormatMapVisitor(Ts...) -> JsonFormatMapVisitor<Ts...>;
 
+// Upper bound on the output size hint, so that a single unusually long line does not make every
+// later line reserve that much.
+constexpr size_t MaxOutputSizeHint = 4096;
+
+// Remember the size of the longest line seen so that later lines can be formatted into a buffer of
+// the right size. Concurrent updates may race, which at worst loses a hint.
+void updateOutputSizeHint(std::atomic<size_t>& hint, size_t size) {
+  size = std::min(size, MaxOutputSizeHint);
+  if (size > hint.load(std::memory_order_relaxed)) {
+    hint.store(size, std::memory_order_relaxed);
+  }
+}
+
+// The escape sequence protobuf's JSON printer uses for an ASCII character, or nullptr if it is
+// written as is.
+const char* jsonEscape(char c) {
+  static const char* const control_escapes[] = {
+      "\\u0000", "\\u0001", "\\u0002", "\\u0003", "\\u0004", "\\u0005", "\\u0006",
+      "\\u0007", "\\b",     "\\t",     "\\n",     "\\u000b", "\\f",     "\\r",
+      "\\u000e", "\\u000f", "\\u0010", "\\u0011", "\\u0012", "\\u0013", "\\u0014",
+      "\\u0015", "\\u0016", "\\u0017", "\\u0018", "\\u0019", "\\u001a", "\\u001b",
+      "\\u001c", "\\u001d", "\\u001e", "\\u001f"};
+  switch (c) {
+  case '"':
+    return "\\\"";
+  case '\\':
+    return "\\\\";
+  case '<':
+    return "\\u003c";
+  case '>':
+    return "\\u003e";
+  case 0x7f:
+    return "\\u007f";
+  default:
+    return static_cast<uint8_t>(c) < 0x20 ? control_escapes[static_cast<uint8_t>(c)] : nullptr;
+  }
+}
+
+// Append str to output as a JSON string, byte for byte as protobuf's JSON printer would write it.
+// Protobuf also escapes a number of non-ASCII code points and rejects invalid UTF-8, so strings
+// that are not pure ASCII are handed to it instead.
+void appendJsonString(absl::string_view str, std::string& output) {
+  const size_t original_size = output.size();
+  output.push_back('"');
+  size_t unescaped_start = 0;
+  for (size_t i = 0; i < str.size(); ++i) {
+    const char c = str[i];
+    if (static_cast<uint8_t>(c) >= 0x80) {
+      output.resize(original_size);
+      output.append(MessageUtil::getJsonStringFromMessage(
+          ValueUtil::stringValue(std::string(str)), false, true));
+      return;
+    }
+    const char* escape = jsonEscape(c);
+    if (escape != nullptr) {
+      output.append(str.data() + unescaped_start, i - unescaped_start);
+      output.append(escape);
+      unescaped_start = i + 1;
+    }
+  }
+  output.append(str.data() + unescaped_start, str.size() - unescaped_start);
+  output.push_back('"');
+}
+
+// Append value to output as JSON, byte for byte as protobuf's JSON printer would write it.
+void appendJsonValue(const ProtobufWkt::Value& value, std::string& output) {
+  switch (value.kind_case()) {
+  case ProtobufWkt::Value::kNullValue:
+    output.append("null");
+    return;
+  case ProtobufWkt::Value::kNumberValue: {
+    const double number = value.number_value();
+    if (!std::isfinite(number)) {
+      break;
+    }
+    // Like protobuf's SimpleDtoa(), use 15 significant digits unless the value needs 17 to round
+    // trip.
+    std::string str = fmt::format("{:.15g}", number);
+    double parsed;
+    if (!absl::SimpleAtod(str, &parsed) || parsed != number) {
+      str = fmt::format("{:.17g}", number);
+    }
+    output.append(str);
+    return;
+  }
+  case ProtobufWkt::Value::kStringValue:
+    appendJsonString(value.string_value(), output);
+    return;
+  case ProtobufWkt::Value::kBoolValue:
+    output.append(value.bool_value() ? "true" : "false");
+    return;
+  case ProtobufWkt::Value::kStructValue: {
+    output.push_back('{');
+    bool first = true;
+    for (const auto& field : value.struct_value().fields()) {
+      if (!first) {
+        output.push_back(',');
+      }
+      first = false;
+      appendJsonString(field.first, output);
+      output.push_back(':');
+      appendJsonValue(field.second, output);
+    }
+    output.push_back('}');
+    return;
+  }
+  case ProtobufWkt::Value::kListValue: {
+    output.push_back('[');
+    bool first = true;
+    for (const auto& element : value.list_value().values()) {
+      if (!first) {
+        output.push_back(',');
+      }
+      first = false;
+      appendJsonValue(element, output);
+    }
+    output.push_back(']');
+    return;
+  }
+  default:
+    break;
+  }
+  // Leave anything protobuf treats specially, such as non-finite numbers, to protobuf.
+  output.append(MessageUtil::getJsonStringFromMessage(value, false, true));
+}
+
 } // namespace
 
 const std::string SubstitutionFormatUtils::DEFAULT_FORMAT =
@@ -109,7 +239,9 @@ const std::string SubstitutionFormatUtils::getHostnameOrDefault() {
 }
 
 FormatterImpl::FormatterImpl(const std::string& format, bool omit_empty_values)
-    : empty_value_string_(omit_empty_values ? EMPTY_STRING : DefaultUnspecifiedValueString) {
+    : empty_value_string_(omit_empty_values ? EMPTY_STRING : DefaultUnspecifiedValueString),
+      use_output_size_hint_(Runtime::runtimeFeatureEnabled(
+          "envoy.reloadable_features.access_log_output_size_hint")) {
   providers_ = SubstitutionFormatParser::parse(format);
 }
 
@@ -119,7 +251,7 @@ std::string FormatterImpl::format(const Http::RequestHeaderMap& request_headers,
                                   const StreamInfo::StreamInfo& stream_info,
                                   absl::string_view local_reply_body) const {
   std::string log_line;
-  log_line.reserve(256);
+  log_line.reserve(use_output_size_hint_ ? output_size_hint_.load(std::memory_order_relaxed) : 256);
 
   for (const FormatterProviderPtr& provider : providers_) {
     const auto bit = provider->format(request_headers, response_headers, response_trailers,
@@ -127,14 +259,34 @@ std::string FormatterImpl::format(const Http::RequestHeaderMap& request_headers,
     log_line += bit.value_or(empty_value_string_);
   }
 
+  if (use_output_size_hint_) {
+    updateOutputSizeHint(output_size_hint_, log_line.size());
+  }
   return log_line;
 }
 
+JsonFormatterImpl::JsonFormatterImpl(const ProtobufWkt::Struct& format_mapping,
+                                     bool preserve_types, bool omit_empty_values)
+    : omit_empty_values_(omit_empty_values), preserve_types_(preserve_types),
+      direct_serialization_(Runtime::runtimeFeatureEnabled(
+          "envoy.reloadable_features.json_access_log_direct_serialization")),
+      json_output_format_(toFormatMap(format_mapping)) {}
+
 std::string JsonFormatterImpl::format(const Http::RequestHeaderMap& request_headers,
                                       const Http::ResponseHeaderMap& response_headers,
                                       const Http::ResponseTrailerMap& response_trailers,
                                       const StreamInfo::StreamInfo& stream_info,
                                       absl::string_view local_reply_body) const {
+  if (direct_serialization_) {
+    std::string log_line;
+    log_line.reserve(output_size_hint_.load(std::memory_order_relaxed));
+    writeJson(request_headers, response_headers, response_trailers, stream_info, local_reply_body,
+              log_line);
+    log_line.push_back('\n');
+    updateOutputSizeHint(output_size_hint_, log_line.size());
+    return log_line;
+  }
+
   const auto output_struct =
       toStruct(request_headers, response_headers, response_trailers, stream_info, local_reply_body);
 
@@ -158,9 +310,85 @@ JsonFormatterImpl::toFormatMap(const ProtobufWkt::Struct& json_format) const {
           "Only string values or nested structs are supported in the JSON access log format.");
     }
   }
-  return {std::move(output)};
+  std::vector<std::string> json_keys;
+  json_keys.reserve(output->size());
+  for (const auto& pair : *output) {
+    std::string json_key;
+    appendJsonString(pair.first, json_key);
+    json_key.push_back(':');
+    json_keys.push_back(std::move(json_key));
+  }
+  return {std::move(output), std::move(json_keys)};
 };
 
+void JsonFormatterImpl::writeJson(const Http::RequestHeaderMap& request_headers,
+                                  const Http::ResponseHeaderMap& response_headers,
+                                  const Http::ResponseTrailerMap& response_trailers,
+                                  const StreamInfo::StreamInfo& stream_info,
+                                  absl::string_view local_reply_body, std::string& output) const {
+  const std::string& empty_value =
+      omit_empty_values_ ? EMPTY_STRING : DefaultUnspecifiedValueString;
+  // Writes the value of a field, returning false if the field should be omitted. Mirrors the
+  // conversions toStruct() makes.
+  const std::function<bool(const std::vector<FormatterProviderPtr>&)> providers_callback =
+      [&](const std::vector<FormatterProviderPtr>& providers) {
+        ASSERT(!providers.empty());
+        if (providers.size() == 1) {
+          const auto& provider = providers.front();
+          if (preserve_types_) {
+            const ProtobufWkt::Value value = provider->formatValue(
+                request_headers, response_headers, response_trailers, stream_info,
+                local_reply_body);
+            if (omit_empty_values_ && value.kind_case() == ProtobufWkt::Value::kNullValue) {
+              return false;
+            }
+            appendJsonValue(value, output);
+            return true;
+          }
+
+          const auto str = provider->format(request_headers, response_headers, response_trailers,
+                                            stream_info, local_reply_body);
+          if (!str.has_value() && omit_empty_values_) {
+            return false;
+          }
+          appendJsonString(str.has_value() ? str.value() : DefaultUnspecifiedValueString, output);
+          return true;
+        }
+        // Multiple providers forces string output.
+        std::string str;
+        for (const auto& provider : providers) {
+          const auto bit = provider->format(request_headers, response_headers, response_trailers,
+                                            stream_info, local_reply_body);
+          str += bit.value_or(empty_value);
+        }
+        appendJsonString(str, output);
+        return true;
+      };
+  const std::function<bool(const JsonFormatterImpl::JsonFormatMapWrapper&)>
+      json_format_map_callback = [&](const JsonFormatterImpl::JsonFormatMapWrapper& format) {
+        output.push_back('{');
+        JsonFormatMapVisitor visitor{json_format_map_callback, providers_callback};
+        bool first = true;
+        auto json_key = format.json_keys_.begin();
+        for (const auto& pair : *format.value_) {
+          // The key is written before the value is known, and rolled back if it is omitted.
+          const size_t field_start = output.size();
+          if (!first) {
+            output.push_back(',');
+          }
+          output.append(*json_key++);
+          if (absl::visit(visitor, pair.second)) {
+            first = false;
+          } else {
+            output.resize(field_start);
+          }
+        }
+        output.push_back('}');
+        return true;
+      };
+  json_format_map_callback(json_output_format_);
+}
+
 ProtobufWkt::Struct JsonFormatterImpl::toStruct(const Http::RequestHeaderMap& request_headers,
                                                 const Http::ResponseHeaderMap& response_headers,
                                                 const Http::ResponseTrailerMap& response_trailers,
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <string>
 #include <vector>
@@ -105,14 +106,17 @@ public:
 private:
   const std::string& empty_value_string_;
   std::vector<FormatterProviderPtr> providers_;
+  // Whether to size the output from output_size_hint_ rather than a fixed reservation.
+  const bool use_output_size_hint_;
+  // The longest line formatted so far, up to a few KiB, used to size the output up front so that
+  // appending the fields of a line rarely has to reallocate.
+  mutable std::atomic<size_t> output_size_hint_{256};
 };
 
 class JsonFormatterImpl : public Formatter {
 public:
   JsonFormatterImpl(const ProtobufWkt::Struct& format_mapping, bool preserve_types,
-                    bool omit_empty_values)
-      : omit_empty_values_(omit_empty_values), preserve_types_(preserve_types),
-        json_output_format_(toFormatMap(format_mapping)) {}
+                    bool omit_empty_values);
 
   // Formatter::format
   std::string format(const Http::RequestHeaderMap& request_headers,
@@ -131,11 +135,22 @@ private:
   using JsonFormatMapPtr = std::unique_ptr<JsonFormatMap>;
   struct JsonFormatMapWrapper {
     JsonFormatMapPtr value_;
+    // The escaped and quoted key of each entry of value_, in iteration order, followed by ':'.
+    std::vector<std::string> json_keys_;
   };
 
   bool omit_empty_values_;
   bool preserve_types_;
+  // Whether to write the log line directly rather than building and serializing a Struct.
+  const bool direct_serialization_;
   const JsonFormatMapWrapper json_output_format_;
+  mutable std::atomic<size_t> output_size_hint_{256};
+
+  void writeJson(const Http::RequestHeaderMap& request_headers,
+                 const Http::ResponseHeaderMap& response_headers,
+                 const Http::ResponseTrailerMap& response_trailers,
+                 const StreamInfo::StreamInfo& stream_info, absl::string_view local_reply_body,
+                 std::string& output) const;
 
   ProtobufWkt::Struct toStruct(const Http::RequestHeaderMap& request_headers,
                                const Http::ResponseHeaderMap& response_headers,
@@ -84,11 +84,11 @@ public:
     codec_client_ = parent.createCodecClient(data);
     codec_client_->addConnectionCallbacks(*this);
     codec_client_->setConnectionStats(
-        {parent_.host()->cluster().stats().upstream_cx_rx_bytes_total_,
-         parent_.host()->cluster().stats().upstream_cx_rx_bytes_buffered_,
-         parent_.host()->cluster().stats().upstream_cx_tx_bytes_total_,
-         parent_.host()->cluster().stats().upstream_cx_tx_bytes_buffered_,
-         &parent_.host()->cluster().stats().bind_errors_, nullptr});
+        {parent_.host()->cluster().trafficStats().upstream_cx_rx_bytes_total_,
+         parent_.host()->cluster().trafficStats().upstream_cx_rx_bytes_buffered_,
+         parent_.host()->cluster().trafficStats().upstream_cx_tx_bytes_total_,
+         parent_.host()->cluster().trafficStats().upstream_cx_tx_bytes_buffered_,
+         &parent_.host()->cluster().trafficStats().bind_errors_, nullptr});
   }
   void close() override { codec_client_->close(); }
   virtual Http::RequestEncoder& newStreamEncoder(Http::ResponseDecoder& response_decoder) PURE;
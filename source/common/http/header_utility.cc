@@ -1,5 +1,9 @@
 #include "common/http/header_utility.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include "envoy/config/route/v3/route_components.pb.h"
 
 #include "common/common/regex.h"
@@ -22,6 +26,23 @@ struct SharedResponseCodeDetailsValues {
 
 using SharedResponseCodeDetails = ConstSingleton<SharedResponseCodeDetailsValues>;
 
+namespace {
+
+// Per RFC 7230, section 3.2, a header value may contain VCHAR, obs-text, SP and HTAB; this is the
+// same set of characters accepted by nghttp2_check_header_value().
+bool isInvalidHeaderValueChar(uint8_t c) { return (c < 0x20 && c != '\t') || c == 0x7f; }
+
+bool headerValueIsValidScalar(const uint8_t* data, size_t size) {
+  for (size_t i = 0; i < size; i++) {
+    if (isInvalidHeaderValueChar(data[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
 // HeaderMatcher will consist of:
 //   header_match_specifier which can be any one of exact_match, regex_match, range_match,
 //   present_match, prefix_match or suffix_match.
@@ -166,8 +187,26 @@ bool HeaderUtility::matchHeaders(const HeaderMap& request_headers, const HeaderD
 }
 
 bool HeaderUtility::headerValueIsValid(const absl::string_view header_value) {
-  return nghttp2_check_header_value(reinterpret_cast<const uint8_t*>(header_value.data()),
-                                    header_value.size()) != 0;
+  const uint8_t* data = reinterpret_cast<const uint8_t*>(header_value.data());
+  size_t size = header_value.size();
+#if defined(__SSE2__)
+  // Check 16 bytes at a time. SSE2 is part of the x86-64 baseline, so this needs no runtime CPU
+  // detection; any remaining tail bytes are checked by the scalar loop below.
+  const __m128i max_control = _mm_set1_epi8(0x1f);
+  const __m128i tab = _mm_set1_epi8('\t');
+  const __m128i del = _mm_set1_epi8(0x7f);
+  for (; size >= 16; data += 16, size -= 16) {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    // There is no unsigned byte comparison in SSE2; min(c, 0x1f) == c iff c <= 0x1f.
+    const __m128i control = _mm_cmpeq_epi8(_mm_min_epu8(chunk, max_control), chunk);
+    const __m128i invalid = _mm_or_si128(_mm_andnot_si128(_mm_cmpeq_epi8(chunk, tab), control),
+                                         _mm_cmpeq_epi8(chunk, del));
+    if (_mm_movemask_epi8(invalid) != 0) {
+      return false;
+    }
+  }
+#endif
+  return headerValueIsValidScalar(data, size);
 }
 
 bool HeaderUtility::headerNameContainsUnderscore(const absl::string_view header_name) {
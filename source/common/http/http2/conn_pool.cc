@@ -27,7 +27,7 @@ Envoy::ConnectionPool::ActiveClientPtr ConnPoolImpl::instantiateActiveClient() {
 }
 void ConnPoolImpl::onGoAway(ActiveClient& client, Http::GoAwayErrorCode) {
   ENVOY_CONN_LOG(debug, "remote goaway", *client.codec_client_);
-  host_->cluster().stats().upstream_cx_close_notify_.inc();
+  host_->cluster().trafficStats().upstream_cx_close_notify_.inc();
   if (client.state_ != ActiveClient::State::DRAINING) {
     if (client.codec_client_->numActiveRequests() == 0) {
       client.codec_client_->close();
@@ -51,12 +51,12 @@ void ConnPoolImpl::onStreamDestroy(ActiveClient& client) {
 void ConnPoolImpl::onStreamReset(ActiveClient& client, Http::StreamResetReason reason) {
   if (reason == StreamResetReason::ConnectionTermination ||
       reason == StreamResetReason::ConnectionFailure) {
-    host_->cluster().stats().upstream_rq_pending_failure_eject_.inc();
+    host_->cluster().trafficStats().upstream_rq_pending_failure_eject_.inc();
     client.closed_with_active_rq_ = true;
   } else if (reason == StreamResetReason::LocalReset) {
-    host_->cluster().stats().upstream_rq_tx_reset_.inc();
+    host_->cluster().trafficStats().upstream_rq_tx_reset_.inc();
   } else if (reason == StreamResetReason::RemoteReset) {
-    host_->cluster().stats().upstream_rq_rx_reset_.inc();
+    host_->cluster().trafficStats().upstream_rq_rx_reset_.inc();
   }
 }
 
@@ -72,7 +72,7 @@ ConnPoolImpl::ActiveClient::ActiveClient(ConnPoolImpl& parent)
   codec_client_->setCodecClientCallbacks(*this);
   codec_client_->setCodecConnectionCallbacks(*this);
 
-  parent.host_->cluster().stats().upstream_cx_http2_total_.inc();
+  parent.host_->cluster().trafficStats().upstream_cx_http2_total_.inc();
 }
 
 bool ConnPoolImpl::ActiveClient::closingWithIncompleteStream() const {
@@ -4,10 +4,24 @@
 #include "common/common/assert.h"
 #include "common/common/empty_string.h"
 #include "common/http/headers.h"
+#include "common/runtime/runtime_features.h"
 
 namespace Envoy {
 namespace Network {
 
+RawBufferSocket::RawBufferSocket()
+    : stop_on_short_write_(
+          // Only read the runtime feature if the runtime loader singleton exists, to avoid
+          // spurious warnings from sockets created before (or without) runtime.
+          Runtime::LoaderSingleton::getExisting()
+              ? Runtime::runtimeFeatureEnabled(
+                    "envoy.reloadable_features.raw_buffer_socket_stop_on_short_write")
+              : true),
+      grow_read_size_(Runtime::LoaderSingleton::getExisting()
+                          ? Runtime::runtimeFeatureEnabled(
+                                "envoy.reloadable_features.raw_buffer_socket_grow_read_size")
+                          : true) {}
+
 void RawBufferSocket::setTransportSocketCallbacks(TransportSocketCallbacks& callbacks) {
   ASSERT(!callbacks_);
   callbacks_ = &callbacks;
@@ -17,9 +31,24 @@ IoResult RawBufferSocket::doRead(Buffer::Instance& buffer) {
   PostIoAction action = PostIoAction::KeepOpen;
   uint64_t bytes_read = 0;
   bool end_stream = false;
+  // Start with a small read and grow it while the socket keeps filling the requested size. Bulk
+  // transfers then land in larger buffer slices, which cuts the number of readv() calls here and
+  // the number of writev() calls when the same data is written out on another connection.
+  uint64_t read_allocation = InitialReadAllocation;
   do {
-    // 16K read is arbitrary. TODO(mattklein123) PERF: Tune the read size.
-    Api::IoCallUint64Result result = callbacks_->ioHandle().read(buffer, 16384);
+    uint64_t read_size = grow_read_size_
+                             ? Buffer::OwnedSlice::capacityForAllocation(read_allocation)
+                             : FixedReadSize;
+    if (read_size > InitialReadSize) {
+      // Don't read past the buffer limit by more than the initial read size would have, as the
+      // limit is only checked after each read.
+      const uint32_t buffer_limit = callbacks_->connection().bufferLimit();
+      if (buffer_limit > 0) {
+        const uint64_t room = buffer_limit > buffer.length() ? buffer_limit - buffer.length() : 0;
+        read_size = std::min(read_size, std::max(room, InitialReadSize));
+      }
+    }
+    Api::IoCallUint64Result result = callbacks_->ioHandle().read(buffer, read_size);
 
     if (result.ok()) {
       ENVOY_CONN_LOG(trace, "read returns: {}", callbacks_->connection(), result.rc_);
@@ -33,6 +62,9 @@ IoResult RawBufferSocket::doRead(Buffer::Instance& buffer) {
         callbacks_->setReadBufferReady();
         break;
       }
+      if (grow_read_size_ && result.rc_ == read_size) {
+        read_allocation = std::min(read_allocation * 2, MaxReadAllocation);
+      }
     } else {
       // Remote error (might be no data).
       ENVOY_CONN_LOG(trace, "read error: {}", callbacks_->connection(),
@@ -62,11 +94,18 @@ IoResult RawBufferSocket::doWrite(Buffer::Instance& buffer, bool end_stream) {
       action = PostIoAction::KeepOpen;
       break;
     }
+    const uint64_t bytes_offered = stop_on_short_write_ ? bytesOfferedPerWrite(buffer) : 0;
     Api::IoCallUint64Result result = callbacks_->ioHandle().write(buffer);
 
     if (result.ok()) {
       ENVOY_CONN_LOG(trace, "write returns: {}", callbacks_->connection(), result.rc_);
       bytes_written += result.rc_;
+      if (result.rc_ < bytes_offered) {
+        // The kernel did not take everything that was offered, so the socket send buffer is
+        // full. Another write would only fail with EAGAIN; wait for the next write event instead.
+        action = PostIoAction::KeepOpen;
+        break;
+      }
     } else {
       ENVOY_CONN_LOG(trace, "write error: {}", callbacks_->connection(),
                      result.err_->getErrorDetails());
@@ -82,6 +121,14 @@ IoResult RawBufferSocket::doWrite(Buffer::Instance& buffer, bool end_stream) {
   return {action, bytes_written, false};
 }
 
+uint64_t RawBufferSocket::bytesOfferedPerWrite(const Buffer::Instance& buffer) {
+  uint64_t bytes_offered = 0;
+  for (const Buffer::RawSlice& slice : buffer.getRawSlices(MaxSlicesPerWrite)) {
+    bytes_offered += slice.len_;
+  }
+  return bytes_offered;
+}
+
 std::string RawBufferSocket::protocol() const { return EMPTY_STRING; }
 absl::string_view RawBufferSocket::failureReason() const { return EMPTY_STRING; }
 
@@ -4,6 +4,7 @@
 #include "envoy/network/connection.h"
 #include "envoy/network/transport_socket.h"
 
+#include "common/buffer/buffer_impl.h"
 #include "common/common/logger.h"
 
 namespace Envoy {
@@ -11,6 +12,8 @@ namespace Network {
 
 class RawBufferSocket : public TransportSocket, protected Logger::Loggable<Logger::Id::connection> {
 public:
+  RawBufferSocket();
+
   // Network::TransportSocket
   void setTransportSocketCallbacks(TransportSocketCallbacks& callbacks) override;
   std::string protocol() const override;
@@ -23,8 +26,36 @@ public:
   Ssl::ConnectionInfoConstSharedPtr ssl() const override { return nullptr; }
 
 private:
+  // Reads are sized so that each fills a whole buffer slice of a size that Buffer::SliceAllocator
+  // recycles: a 20KiB slice for the first read on each read event, doubling up to 80KiB while
+  // consecutive reads fill the requested size.
+  static constexpr uint64_t InitialReadAllocation = 20480;
+  static constexpr uint64_t MaxReadAllocation = 81920;
+  static constexpr uint64_t InitialReadSize =
+      Buffer::OwnedSlice::capacityForAllocation(InitialReadAllocation);
+  // Size of every read when the read size does not grow.
+  // TODO(mattklein123) PERF: Tune the read size.
+  static constexpr uint64_t FixedReadSize = 16384;
+  // Same limit as IoSocketHandleImpl::write(), which every IoHandle in the tree either is or
+  // delegates to.
+  static constexpr uint64_t MaxSlicesPerWrite = 16;
+
+  /**
+   * @return the number of bytes a single IoHandle::write() of buffer offers to the kernel, so
+   *         that a short write can be told apart from a write of everything that was offered.
+   */
+  static uint64_t bytesOfferedPerWrite(const Buffer::Instance& buffer);
+
   TransportSocketCallbacks* callbacks_{};
   bool shutdown_{};
+  // Latched "envoy.reloadable_features.raw_buffer_socket_stop_on_short_write" runtime feature. If
+  // true, a write that is not fully accepted by the kernel ends the write loop instead of issuing
+  // another writev() that is bound to fail with EAGAIN.
+  const bool stop_on_short_write_;
+  // Latched "envoy.reloadable_features.raw_buffer_socket_grow_read_size" runtime feature. If true,
+  // the read size grows from InitialReadSize up to fill a MaxReadAllocation slice while reads fill
+  // the requested size. Otherwise every read is FixedReadSize.
+  const bool grow_read_size_;
 };
 
 class RawBufferSocketFactory : public TransportSocketFactory {
@@ -1154,6 +1154,10 @@ VirtualHostImpl::VirtualHostImpl(const envoy::config::route::v3::VirtualHost& vi
     }
   }
 
+  if (Runtime::runtimeFeatureEnabled("envoy.reloadable_features.route_path_match_index")) {
+    buildPathMatchIndex(virtual_host);
+  }
+
   for (const auto& virtual_cluster : virtual_host.virtual_clusters()) {
     virtual_clusters_.push_back(
         VirtualClusterEntry(virtual_cluster, stat_name_pool_, *vcluster_scope_));
@@ -1281,21 +1285,22 @@ RouteConstSharedPtr VirtualHostImpl::getRouteFromEntries(const RouteCallback& cb
     return SSL_REDIRECT_ROUTE;
   }
 
-  // Check for a route that matches the request.
-  for (auto route = routes_.begin(); route != routes_.end(); ++route) {
-    if (!headers.Path() && !(*route)->supportsPathlessHeaders()) {
-      continue;
+  // Check the route at the given position in routes_. Returns absl::nullopt if evaluation should
+  // continue with the next route, and the result of the lookup otherwise.
+  const auto check_route = [&](uint32_t index) -> absl::optional<RouteConstSharedPtr> {
+    const RouteEntryImplBaseConstSharedPtr& route = routes_[index];
+    if (!headers.Path() && !route->supportsPathlessHeaders()) {
+      return absl::nullopt;
     }
 
-    RouteConstSharedPtr route_entry = (*route)->matches(headers, stream_info, random_value);
+    RouteConstSharedPtr route_entry = route->matches(headers, stream_info, random_value);
     if (nullptr == route_entry) {
-      continue;
+      return absl::nullopt;
     }
 
     if (cb) {
-      RouteEvalStatus eval_status = (std::next(route) == routes_.end())
-                                        ? RouteEvalStatus::NoMoreRoutes
-                                        : RouteEvalStatus::HasMoreRoutes;
+      RouteEvalStatus eval_status = (index + 1 == routes_.size()) ? RouteEvalStatus::NoMoreRoutes
+                                                                  : RouteEvalStatus::HasMoreRoutes;
       RouteMatchStatus match_status = cb(route_entry, eval_status);
       if (match_status == RouteMatchStatus::Accept) {
         return route_entry;
@@ -1304,15 +1309,91 @@ RouteConstSharedPtr VirtualHostImpl::getRouteFromEntries(const RouteCallback& cb
           eval_status == RouteEvalStatus::NoMoreRoutes) {
         return nullptr;
       }
-      continue;
+      return absl::nullopt;
     }
 
     return route_entry;
+  };
+
+  // Check for a route that matches the request.
+  if (path_match_index_ != nullptr) {
+    // Only routes whose path matcher matches, and routes that are not indexed, can match. Checking
+    // those in their configured order gives the same result as checking every route.
+    PathMatchIndex::Candidates candidates(unindexed_routes_.begin(), unindexed_routes_.end());
+    if (headers.Path()) {
+      const absl::string_view path = Http::PathUtil::removeQueryAndFragment(headers.getPathValue());
+      path_match_index_->find(path, candidates);
+      if (regex_set_ != nullptr) {
+        // Reused across requests on this thread; RE2 clears it before writing the matches.
+        static thread_local std::vector<int> regex_matches;
+        if (regex_set_->match(path, regex_matches)) {
+          for (const int regex_index : regex_matches) {
+            candidates.push_back(regex_set_routes_[regex_index]);
+          }
+        } else {
+          candidates.insert(candidates.end(), regex_set_routes_.begin(), regex_set_routes_.end());
+        }
+      }
+      std::sort(candidates.begin(), candidates.end());
+    }
+    for (const uint32_t index : candidates) {
+      absl::optional<RouteConstSharedPtr> result = check_route(index);
+      if (result.has_value()) {
+        return std::move(result.value());
+      }
+    }
+    return nullptr;
+  }
+
+  for (uint32_t index = 0; index < routes_.size(); index++) {
+    absl::optional<RouteConstSharedPtr> result = check_route(index);
+    if (result.has_value()) {
+      return std::move(result.value());
+    }
   }
 
   return nullptr;
 }
 
+void VirtualHostImpl::buildPathMatchIndex(
+    const envoy::config::route::v3::VirtualHost& virtual_host) {
+  const bool use_regex_set =
+      Runtime::runtimeFeatureEnabled("envoy.reloadable_features.route_regex_set_prefilter");
+  auto index = std::make_unique<PathMatchIndex>();
+  std::vector<std::string> regexes;
+  for (uint32_t i = 0; i < routes_.size(); i++) {
+    const RouteEntryImplBase& route = *routes_[i];
+    const envoy::config::route::v3::RouteMatch& match = virtual_host.routes(i).match();
+    const bool safe_regex = match.path_specifier_case() ==
+                            envoy::config::route::v3::RouteMatch::PathSpecifierCase::kSafeRegex;
+    if (route.caseSensitive() && route.matchType() == PathMatchType::Prefix) {
+      index->addPrefix(route.matcher(), i);
+    } else if (route.caseSensitive() && route.matchType() == PathMatchType::Exact) {
+      index->addExact(route.matcher(), i);
+    } else if (use_regex_set && safe_regex) {
+      regexes.push_back(match.safe_regex().regex());
+      regex_set_routes_.push_back(i);
+    } else {
+      unindexed_routes_.push_back(i);
+    }
+  }
+  path_match_index_ = std::move(index);
+  if (!regexes.empty()) {
+    try {
+      regex_set_ = std::make_unique<Regex::GoogleReSet>(regexes);
+    } catch (const EnvoyException& e) {
+      // RE2 bounds the memory of a set, which a few hundred regex routes can exceed. Check those
+      // routes one by one like any other unindexed route.
+      ENVOY_LOG_MISC(warn, "unable to pre-filter the {} regex routes of virtual host '{}': {}",
+                     regexes.size(), virtual_host.name(), e.what());
+      unindexed_routes_.insert(unindexed_routes_.end(), regex_set_routes_.begin(),
+                               regex_set_routes_.end());
+      std::sort(unindexed_routes_.begin(), unindexed_routes_.end());
+      regex_set_routes_.clear();
+    }
+  }
+}
+
 const VirtualHostImpl* RouteMatcher::findVirtualHost(const Http::RequestHeaderMap& headers) const {
   // Fast path the case where we only have a default virtual host.
   if (virtual_hosts_.empty() && wildcard_virtual_host_suffixes_.empty() &&
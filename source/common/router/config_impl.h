@@ -27,6 +27,7 @@
 #include "common/router/header_formatter.h"
 #include "common/router/header_parser.h"
 #include "common/router/metadatamatchcriteria_impl.h"
+#include "common/router/path_match_index.h"
 #include "common/router/router_ratelimit.h"
 #include "common/router/tls_context_match_criteria_impl.h"
 #include "common/stats/symbol_table_impl.h"
@@ -219,12 +220,24 @@ private:
         : VirtualClusterBase(pool.add("other"), scope.createScope("other")) {}
   };
 
+  void buildPathMatchIndex(const envoy::config::route::v3::VirtualHost& virtual_host);
+
   static const std::shared_ptr<const SslRedirectRoute> SSL_REDIRECT_ROUTE;
 
   Stats::StatNamePool stat_name_pool_;
   const Stats::StatName stat_name_;
   Stats::ScopePtr vcluster_scope_;
   std::vector<RouteEntryImplBaseConstSharedPtr> routes_;
+  // Indexes the case sensitive prefix and path routes in routes_. Null if the index is disabled.
+  std::unique_ptr<const PathMatchIndex> path_match_index_;
+  // Positions in routes_ of the routes neither path_match_index_ nor regex_set_ covers, which are
+  // candidates for every request.
+  std::vector<uint32_t> unindexed_routes_;
+  // Matches the safe_regex routes of routes_ in a single pass. Null if there are none or the set is
+  // disabled; only built together with path_match_index_.
+  Regex::GoogleReSetPtr regex_set_;
+  // Positions in routes_ of the routes in regex_set_, in the order they were added to the set.
+  std::vector<uint32_t> regex_set_routes_;
   std::vector<VirtualClusterEntry> virtual_clusters_;
   SslRequirements ssl_requirements_;
   const RateLimitPolicyImpl rate_limit_policy_;
@@ -462,6 +475,7 @@ public:
   bool matchRoute(const Http::RequestHeaderMap& headers, const StreamInfo::StreamInfo& stream_info,
                   uint64_t random_value) const;
   void validateClusters(Upstream::ClusterManager& cm) const;
+  bool caseSensitive() const { return case_sensitive_; }
 
   // Router::RouteEntry
   const std::string& clusterName() const override;
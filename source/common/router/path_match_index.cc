@@ -0,0 +1,72 @@
+#include "common/router/path_match_index.h"
+
+#include <algorithm>
+
+#include "absl/strings/match.h"
+
+namespace Envoy {
+namespace Router {
+
+PathMatchIndex::PathMatchIndex() : root_(std::make_unique<Node>()) {}
+
+void PathMatchIndex::addPrefix(absl::string_view prefix, uint32_t id) {
+  insert(prefix).prefix_ids_.push_back(id);
+}
+
+void PathMatchIndex::addExact(absl::string_view path, uint32_t id) {
+  insert(path).exact_ids_.push_back(id);
+}
+
+PathMatchIndex::Node& PathMatchIndex::insert(absl::string_view key) {
+  Node* node = root_.get();
+  while (!key.empty()) {
+    NodePtr& child = node->children_[key[0]];
+    if (child == nullptr) {
+      child = std::make_unique<Node>();
+      child->label_ = std::string(key);
+      return *child;
+    }
+
+    const size_t max_common = std::min(child->label_.size(), key.size());
+    size_t common = 1;
+    while (common < max_common && child->label_[common] == key[common]) {
+      common++;
+    }
+
+    if (common < child->label_.size()) {
+      // The key diverges from, or ends within, the child's label. Split the edge so that the key
+      // ends on, or branches off from, a node.
+      auto split = std::make_unique<Node>();
+      split->label_ = child->label_.substr(0, common);
+      child->label_.erase(0, common);
+      const char child_key = child->label_[0];
+      split->children_.emplace(child_key, std::move(child));
+      child = std::move(split);
+    }
+
+    node = child.get();
+    key.remove_prefix(common);
+  }
+  return *node;
+}
+
+void PathMatchIndex::find(absl::string_view path, Candidates& candidates) const {
+  const Node* node = root_.get();
+  while (true) {
+    candidates.insert(candidates.end(), node->prefix_ids_.begin(), node->prefix_ids_.end());
+    if (path.empty()) {
+      candidates.insert(candidates.end(), node->exact_ids_.begin(), node->exact_ids_.end());
+      return;
+    }
+
+    auto it = node->children_.find(path[0]);
+    if (it == node->children_.end() || !absl::StartsWith(path, it->second->label_)) {
+      return;
+    }
+    node = it->second.get();
+    path.remove_prefix(node->label_.size());
+  }
+}
+
+} // namespace Router
+} // namespace Envoy
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/inlined_vector.h"
+#include "absl/strings/string_view.h"
+
+namespace Envoy {
+namespace Router {
+
+/**
+ * A radix trie over the case sensitive prefix and exact path matchers of a virtual host's routes.
+ * Given a request path, find() returns the ids of all routes whose path matcher matches it, in
+ * O(path length) regardless of the number of routes. The index says nothing about any other match
+ * criteria, so callers still need to evaluate each candidate in order to preserve first-match
+ * semantics.
+ */
+class PathMatchIndex {
+public:
+  // Route ids returned by find(). Most paths match only a handful of nested prefixes.
+  using Candidates = absl::InlinedVector<uint32_t, 8>;
+
+  PathMatchIndex();
+
+  /**
+   * Index a route that matches any path starting with prefix.
+   * @param prefix supplies the route's path prefix.
+   * @param id supplies the id to return from find() for matching paths.
+   */
+  void addPrefix(absl::string_view prefix, uint32_t id);
+
+  /**
+   * Index a route that matches exactly one path.
+   * @param path supplies the route's path.
+   * @param id supplies the id to return from find() for a matching path.
+   */
+  void addExact(absl::string_view path, uint32_t id);
+
+  /**
+   * Append the ids of all routes matching a path, in no particular order.
+   * @param path supplies the request path, without query string or fragment.
+   * @param candidates supplies the list to append the matching route ids to.
+   */
+  void find(absl::string_view path, Candidates& candidates) const;
+
+private:
+  struct Node;
+  using NodePtr = std::unique_ptr<Node>;
+
+  struct Node {
+    // The bytes of the path consumed by the edge leading to this node. Empty only for the root.
+    std::string label_;
+    std::vector<uint32_t> prefix_ids_;
+    std::vector<uint32_t> exact_ids_;
+    // Keyed by the first byte of the child's label.
+    absl::flat_hash_map<char, NodePtr> children_;
+  };
+
+  Node& insert(absl::string_view key);
+
+  NodePtr root_;
+};
+
+} // namespace Router
+} // namespace Envoy
@@ -168,13 +168,13 @@ void RetryStateImpl::enableBackoffTimer() {
     // be reused.
     ratelimited_backoff_strategy_.reset();
 
-    cluster_.stats().upstream_rq_retry_backoff_ratelimited_.inc();
+    cluster_.trafficStats().upstream_rq_retry_backoff_ratelimited_.inc();
 
   } else {
     // Otherwise we use a fully jittered exponential backoff algorithm.
     retry_timer_->enableTimer(std::chrono::milliseconds(backoff_strategy_->nextBackOffMs()));
 
-    cluster_.stats().upstream_rq_retry_backoff_exponential_.inc();
+    cluster_.trafficStats().upstream_rq_retry_backoff_exponential_.inc();
   }
 }
 
@@ -254,7 +254,7 @@ RetryStatus RetryStateImpl::shouldRetry(bool would_retry, DoRetryCallback callba
   // retry this particular request, we can infer that we did a retry earlier
   // and it was successful.
   if (callback_ && !would_retry) {
-    cluster_.stats().upstream_rq_retry_success_.inc();
+    cluster_.trafficStats().upstream_rq_retry_success_.inc();
     if (vcluster_) {
       vcluster_->stats().upstream_rq_retry_success_.inc();
     }
@@ -269,7 +269,7 @@ RetryStatus RetryStateImpl::shouldRetry(bool would_retry, DoRetryCallback callba
   // The request has exhausted the number of retries allotted to it by the retry policy configured
   // (or the x-envoy-max-retries header).
   if (retries_remaining_ == 0) {
-    cluster_.stats().upstream_rq_retry_limit_exceeded_.inc();
+    cluster_.trafficStats().upstream_rq_retry_limit_exceeded_.inc();
     if (vcluster_) {
       vcluster_->stats().upstream_rq_retry_limit_exceeded_.inc();
     }
@@ -279,7 +279,7 @@ RetryStatus RetryStateImpl::shouldRetry(bool would_retry, DoRetryCallback callba
   retries_remaining_--;
 
   if (!cluster_.resourceManager(priority_).retries().canCreate()) {
-    cluster_.stats().upstream_rq_retry_overflow_.inc();
+    cluster_.trafficStats().upstream_rq_retry_overflow_.inc();
     if (vcluster_) {
       vcluster_->stats().upstream_rq_retry_overflow_.inc();
     }
@@ -293,7 +293,7 @@ RetryStatus RetryStateImpl::shouldRetry(bool would_retry, DoRetryCallback callba
   ASSERT(!callback_);
   callback_ = callback;
   cluster_.resourceManager(priority_).retries().inc();
-  cluster_.stats().upstream_rq_retry_.inc();
+  cluster_.trafficStats().upstream_rq_retry_.inc();
   if (vcluster_) {
     vcluster_->stats().upstream_rq_retry_.inc();
   }
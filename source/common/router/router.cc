@@ -468,7 +468,7 @@ Http::FilterHeadersStatus Filter::decodeHeaders(Http::RequestHeaderMap& headers,
           modify_headers(headers);
         },
         absl::nullopt, StreamInfo::ResponseCodeDetails::get().MaintenanceMode);
-    cluster_->stats().upstream_rq_maintenance_mode_.inc();
+    cluster_->trafficStats().upstream_rq_maintenance_mode_.inc();
     return Http::FilterHeadersStatus::StopIteration;
   }
 
@@ -635,7 +635,7 @@ Http::FilterDataStatus Filter::decodeData(Buffer::Instance& data, bool end_strea
   if (buffering &&
       getLength(callbacks_->decodingBuffer()) + data.length() > retry_shadow_buffer_limit_) {
     // The request is larger than we should buffer. Give up on the retry/shadow
-    cluster_->stats().retry_or_shadow_abandoned_.inc();
+    cluster_->trafficStats().retry_or_shadow_abandoned_.inc();
     retry_state_.reset();
     buffering = false;
     active_shadow_policies_.clear();
@@ -804,7 +804,7 @@ void Filter::onResponseTimeout() {
 
     // Don't do work for upstream requests we've already seen headers for.
     if (upstream_request->awaitingHeaders()) {
-      cluster_->stats().upstream_rq_timeout_.inc();
+      cluster_->trafficStats().upstream_rq_timeout_.inc();
       if (request_vcluster_) {
         request_vcluster_->stats().upstream_rq_timeout_.inc();
       }
@@ -825,6 +825,7 @@ void Filter::onResponseTimeout() {
         updateOutlierDetection(Upstream::Outlier::Result::LocalOriginTimeout, *upstream_request,
                                absl::optional<uint64_t>(enumToInt(timeout_response_code_)));
       }
+      putPeakEwmaResponseTime(*upstream_request, timeout_.global_timeout_);
 
       chargeUpstreamAbort(timeout_response_code_, false, *upstream_request);
     }
@@ -872,7 +873,7 @@ void Filter::onPerTryTimeout(UpstreamRequest& upstream_request) {
     return;
   }
 
-  cluster_->stats().upstream_rq_per_try_timeout_.inc();
+  cluster_->trafficStats().upstream_rq_per_try_timeout_.inc();
   if (upstream_request.upstreamHost()) {
     upstream_request.upstreamHost()->stats().rq_timeout_.inc();
   }
@@ -881,6 +882,7 @@ void Filter::onPerTryTimeout(UpstreamRequest& upstream_request) {
 
   updateOutlierDetection(Upstream::Outlier::Result::LocalOriginTimeout, upstream_request,
                          absl::optional<uint64_t>(enumToInt(timeout_response_code_)));
+  putPeakEwmaResponseTime(upstream_request, timeout_.per_try_timeout_);
 
   if (maybeRetryReset(Http::StreamResetReason::LocalReset, upstream_request)) {
     return;
@@ -919,6 +921,35 @@ void Filter::onStreamMaxDurationReached(UpstreamRequest& upstream_request) {
   }
 }
 
+void Filter::putPeakEwmaResponseTime(UpstreamRequest& upstream_request,
+                                     std::chrono::milliseconds min_response_time) {
+  if (cluster_->lbType() != Upstream::LoadBalancerType::PeakEwma ||
+      !upstream_request.upstreamHost()) {
+    return;
+  }
+
+  // Measure from the start of this upstream request, so that retries and hedged requests are not
+  // charged for the time before they were sent.
+  const absl::optional<MonotonicTime>& start_time =
+      upstream_request.upstreamTiming().first_upstream_tx_byte_sent_;
+  std::chrono::microseconds response_time = min_response_time;
+  if (start_time.has_value()) {
+    response_time = std::max(response_time,
+                             std::chrono::duration_cast<std::chrono::microseconds>(
+                                 callbacks_->dispatcher().timeSource().monotonicTime() -
+                                 start_time.value()));
+  } else if (min_response_time.count() == 0) {
+    // Nothing was sent to the host.
+    return;
+  }
+
+  // The cluster may have been removed while the request was in flight.
+  Upstream::ThreadLocalCluster* cluster = config_.cm_.get(cluster_->name());
+  if (cluster != nullptr) {
+    cluster->putResponseTime(*upstream_request.upstreamHost(), response_time);
+  }
+}
+
 void Filter::updateOutlierDetection(Upstream::Outlier::Result result,
                                     UpstreamRequest& upstream_request,
                                     absl::optional<uint64_t> code) {
@@ -1034,6 +1065,15 @@ void Filter::onUpstreamReset(Http::StreamResetReason reset_reason,
   // config param set to true.
   updateOutlierDetection(Upstream::Outlier::Result::LocalOriginConnectFailed, upstream_request,
                          absl::nullopt);
+  // Treat a reset as if the request had timed out, so that a host failing fast does not look
+  // fast. Without a timeout the reset is not reported, as the time until the reset would make the
+  // host look fast.
+  const std::chrono::milliseconds reset_response_time = timeout_.per_try_timeout_.count() > 0
+                                                            ? timeout_.per_try_timeout_
+                                                            : timeout_.global_timeout_;
+  if (reset_response_time.count() > 0) {
+    putPeakEwmaResponseTime(upstream_request, reset_response_time);
+  }
 
   if (maybeRetryReset(reset_reason, upstream_request)) {
     return;
@@ -1357,6 +1397,8 @@ void Filter::onUpstreamComplete(UpstreamRequest& upstream_request) {
   std::chrono::milliseconds response_time = std::chrono::duration_cast<std::chrono::milliseconds>(
       dispatcher.timeSource().monotonicTime() - downstream_request_complete_time_);
 
+  putPeakEwmaResponseTime(upstream_request, std::chrono::milliseconds(0));
+
   Upstream::ClusterTimeoutBudgetStatsOptRef tb_stats = cluster()->timeoutBudgetStats();
   if (tb_stats.has_value()) {
     tb_stats->get().upstream_rq_timeout_budget_percent_used_.recordValue(
@@ -1427,14 +1469,14 @@ bool Filter::setupRedirect(const Http::ResponseHeaderMap& headers,
       location != nullptr &&
       convertRequestHeadersForInternalRedirect(*downstream_headers_, *location) &&
       callbacks_->recreateStream()) {
-    cluster_->stats().upstream_internal_redirect_succeeded_total_.inc();
+    cluster_->trafficStats().upstream_internal_redirect_succeeded_total_.inc();
     return true;
   }
 
   attempting_internal_redirect_with_complete_stream_ = false;
 
   ENVOY_STREAM_LOG(debug, "Internal redirect failed", *callbacks_);
-  cluster_->stats().upstream_internal_redirect_failed_total_.inc();
+  cluster_->trafficStats().upstream_internal_redirect_failed_total_.inc();
   return false;
 }
 
@@ -510,6 +510,11 @@ private:
   bool setupRedirect(const Http::ResponseHeaderMap& headers, UpstreamRequest& upstream_request);
   bool convertRequestHeadersForInternalRedirect(Http::RequestHeaderMap& downstream_headers,
                                                 const Http::HeaderEntry& internal_redirect);
+  // Report the response time of an upstream request to a peak EWMA cluster. Requests that ended
+  // without a response are reported as taking at least min_response_time, so that they raise the
+  // host's cost rather than lower it.
+  void putPeakEwmaResponseTime(UpstreamRequest& upstream_request,
+                               std::chrono::milliseconds min_response_time);
   void updateOutlierDetection(Upstream::Outlier::Result result, UpstreamRequest& upstream_request,
                               absl::optional<uint64_t> code);
   void doRetry();
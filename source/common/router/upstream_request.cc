@@ -104,7 +104,7 @@ UpstreamRequest::~UpstreamRequest() {
 
   while (downstream_data_disabled_ != 0) {
     parent_.callbacks()->onDecoderFilterBelowWriteBufferLowWatermark();
-    parent_.cluster()->stats().upstream_flow_control_drained_total_.inc();
+    parent_.cluster()->trafficStats().upstream_flow_control_drained_total_.inc();
     --downstream_data_disabled_;
   }
 }
@@ -458,7 +458,7 @@ void UpstreamRequest::encodeBodyAndTrailers() {
 }
 
 void UpstreamRequest::onStreamMaxDurationReached() {
-  upstream_host_->cluster().stats().upstream_rq_max_duration_reached_.inc();
+  upstream_host_->cluster().trafficStats().upstream_rq_max_duration_reached_.inc();
 
   // The upstream had closed then try to retry along with retry policy.
   parent_.onStreamMaxDurationReached(*this);
@@ -485,7 +485,7 @@ void UpstreamRequest::DownstreamWatermarkManager::onAboveWriteBufferHighWatermar
   // The downstream connection is overrun. Pause reads from upstream.
   // If there are multiple calls to readDisable either the codec (H2) or the underlying
   // Network::Connection (H1) will handle reference counting.
-  parent_.parent_.cluster()->stats().upstream_flow_control_paused_reading_total_.inc();
+  parent_.parent_.cluster()->trafficStats().upstream_flow_control_paused_reading_total_.inc();
   parent_.upstream_->readDisable(true);
 }
 
@@ -494,7 +494,7 @@ void UpstreamRequest::DownstreamWatermarkManager::onBelowWriteBufferLowWatermark
 
   // One source of connection blockage has buffer available. Pass this on to the stream, which
   // will resume reads if this was the last remaining high watermark.
-  parent_.parent_.cluster()->stats().upstream_flow_control_resumed_reading_total_.inc();
+  parent_.parent_.cluster()->trafficStats().upstream_flow_control_resumed_reading_total_.inc();
   parent_.upstream_->readDisable(false);
 }
 
@@ -509,7 +509,7 @@ void UpstreamRequest::disableDataFromDownstreamForFlowControl() {
   // the per try timeout timer is started only after downstream_end_stream_
   // is true.
   ASSERT(parent_.upstreamRequests().size() == 1 || parent_.downstreamEndStream());
-  parent_.cluster()->stats().upstream_flow_control_backed_up_total_.inc();
+  parent_.cluster()->trafficStats().upstream_flow_control_backed_up_total_.inc();
   parent_.callbacks()->onDecoderFilterAboveWriteBufferHighWatermark();
   ++downstream_data_disabled_;
 }
@@ -525,7 +525,7 @@ void UpstreamRequest::enableDataFromDownstreamForFlowControl() {
   // the per try timeout timer is started only after downstream_end_stream_
   // is true.
   ASSERT(parent_.upstreamRequests().size() == 1 || parent_.downstreamEndStream());
-  parent_.cluster()->stats().upstream_flow_control_drained_total_.inc();
+  parent_.cluster()->trafficStats().upstream_flow_control_drained_total_.inc();
   parent_.callbacks()->onDecoderFilterBelowWriteBufferLowWatermark();
   ASSERT(downstream_data_disabled_ != 0);
   if (downstream_data_disabled_ > 0) {
@@ -57,11 +57,13 @@ constexpr const char* runtime_features[] = {
     // Begin alphabetically sorted section.
     "envoy.deprecated_features.allow_deprecated_extension_names",
     "envoy.reloadable_features.always_apply_route_header_rules",
+    "envoy.reloadable_features.access_log_output_size_hint",
     "envoy.reloadable_features.activate_fds_next_event_loop",
     "envoy.reloadable_features.activate_timers_next_event_loop",
     "envoy.reloadable_features.allow_500_after_100",
     "envoy.reloadable_features.allow_prefetch",
     "envoy.reloadable_features.allow_response_for_timeout",
+    "envoy.reloadable_features.buffer_slice_cache",
     "envoy.reloadable_features.consume_all_retry_headers",
     "envoy.reloadable_features.check_ocsp_policy",
     "envoy.reloadable_features.disallow_unbounded_access_logs",
@@ -77,15 +79,23 @@ constexpr const char* runtime_features[] = {
     "envoy.reloadable_features.http_set_copy_replace_all_headers",
     "envoy.reloadable_features.http_transport_failure_reason_in_body",
     "envoy.reloadable_features.http2_skip_encoding_empty_trailers",
+    "envoy.reloadable_features.json_access_log_direct_serialization",
     "envoy.reloadable_features.listener_in_place_filterchain_update",
     "envoy.reloadable_features.new_codec_behavior",
     "envoy.reloadable_features.overload_manager_disable_keepalive_drain_http2",
+    "envoy.reloadable_features.parallel_histogram_merge",
     "envoy.reloadable_features.prefer_quic_kernel_bpf_packet_routing",
     "envoy.reloadable_features.preserve_query_string_in_path_redirects",
     "envoy.reloadable_features.preserve_upstream_date",
+    "envoy.reloadable_features.raw_buffer_socket_grow_read_size",
+    "envoy.reloadable_features.raw_buffer_socket_stop_on_short_write",
     "envoy.reloadable_features.require_ocsp_response_for_must_staple_certs",
+    "envoy.reloadable_features.route_path_match_index",
+    "envoy.reloadable_features.route_regex_set_prefilter",
     "envoy.reloadable_features.stop_faking_paths",
     "envoy.reloadable_features.strict_1xx_and_204_response_headers",
+    "envoy.reloadable_features.tcp_proxy_lazy_idle_timer",
+    "envoy.reloadable_features.tls_io_handle_bio_read_ahead",
     "envoy.reloadable_features.tls_use_io_handle_bio",
     "envoy.reloadable_features.unify_grpc_handling",
     "envoy.restart_features.use_apple_api_for_dns_lookups",
@@ -111,6 +121,16 @@ constexpr const char* disabled_runtime_features[] = {
     "envoy.reloadable_features.test_feature_false",
     // gRPC Timeout header is missing (#13580)
     "envoy.reloadable_features.ext_authz_measure_timeout_on_check_created",
+    // Backends that expire gauges which are not reported on every flush would lose them.
+    "envoy.reloadable_features.statsd_flush_changed_metrics_only",
+    // Stats consumers that expect every cluster to report its traffic stats would miss the stats
+    // of clusters that have not been used.
+    "envoy.reloadable_features.lazy_cluster_traffic_stats",
+    // Latched at startup. Worker state of a cluster is created on its first use on each worker.
+    "envoy.reloadable_features.lazy_thread_local_clusters",
+    // Maglev tables rebuilt incrementally depend on the order of host updates, so Envoys that saw
+    // different updates may no longer agree on the host of a key.
+    "envoy.reloadable_features.maglev_incremental_table_rebuild",
 
 };
 
@@ -1,5 +1,6 @@
 #include "common/stats/allocator_impl.h"
 
+#include <array>
 #include <cstdint>
 
 #include "envoy/stats/stats.h"
@@ -144,6 +145,69 @@ private:
   std::atomic<uint64_t> pending_increment_{0};
 };
 
+// A counter spread across per-thread shards, each on its own cache line, so that concurrent
+// increments from different workers do not bounce a single cache line between cores.
+class ShardedCounterImpl : public StatsSharedImpl<Counter> {
+public:
+  // Enough for each worker of a large machine to mostly have a shard to itself.
+  static constexpr uint32_t NumShards = 32;
+
+  ShardedCounterImpl(StatName name, AllocatorImpl& alloc, StatName tag_extracted_name,
+                     const StatNameTagVector& stat_name_tags)
+      : StatsSharedImpl(name, alloc, tag_extracted_name, stat_name_tags) {}
+
+  void removeFromSetLockHeld() ABSL_EXCLUSIVE_LOCKS_REQUIRED(alloc_.mutex_) override {
+    const size_t count = alloc_.counters_.erase(statName());
+    ASSERT(count == 1);
+  }
+
+  // Stats::Counter
+  void add(uint64_t amount) override {
+    Shard& shard = shards_[shardIndex()];
+    shard.value_ += amount;
+    shard.pending_increment_ += amount;
+    // Only write the shared flags once, so that increments touch no shared cache line.
+    if (!(flags_ & Flags::Used)) {
+      flags_ |= Flags::Used;
+    }
+  }
+  void inc() override { add(1); }
+  uint64_t latch() override {
+    uint64_t delta = 0;
+    for (Shard& shard : shards_) {
+      delta += shard.pending_increment_.exchange(0);
+    }
+    return delta;
+  }
+  void reset() override {
+    for (Shard& shard : shards_) {
+      shard.value_ = 0;
+    }
+  }
+  uint64_t value() const override {
+    uint64_t value = 0;
+    for (const Shard& shard : shards_) {
+      value += shard.value_;
+    }
+    return value;
+  }
+
+private:
+  struct alignas(64) Shard {
+    std::atomic<uint64_t> value_{0};
+    std::atomic<uint64_t> pending_increment_{0};
+  };
+
+  // Threads are assigned shards round-robin the first time they increment any sharded counter.
+  static uint32_t shardIndex() {
+    static std::atomic<uint32_t> next_shard{0};
+    thread_local const uint32_t shard = next_shard++ % NumShards;
+    return shard;
+  }
+
+  std::array<Shard, NumShards> shards_;
+};
+
 class GaugeImpl : public StatsSharedImpl<Gauge> {
 public:
   GaugeImpl(StatName name, AllocatorImpl& alloc, StatName tag_extracted_name,
@@ -173,20 +237,24 @@ public:
   // Stats::Gauge
   void add(uint64_t amount) override {
     child_value_ += amount;
-    flags_ |= Flags::Used;
+    flags_ |= Flags::Used | Flags::Changed;
   }
   void dec() override { sub(1); }
   void inc() override { add(1); }
   void set(uint64_t value) override {
     child_value_ = value;
-    flags_ |= Flags::Used;
+    flags_ |= Flags::Used | Flags::Changed;
   }
   void sub(uint64_t amount) override {
     ASSERT(child_value_ >= amount);
     ASSERT(used() || amount == 0);
     child_value_ -= amount;
+    flags_ |= Flags::Changed;
   }
   uint64_t value() const override { return child_value_ + parent_value_; }
+  bool latchChanged() override {
+    return flags_.fetch_and(static_cast<uint16_t>(~Flags::Changed)) & Flags::Changed;
+  }
 
   ImportMode importMode() const override {
     if (flags_ & Flags::NeverImport) {
@@ -219,12 +287,15 @@ public:
       // we clear the accumulated value.
       parent_value_ = 0;
       flags_ &= ~Flags::Used;
-      flags_ |= Flags::NeverImport;
+      flags_ |= Flags::NeverImport | Flags::Changed;
       break;
     }
   }
 
-  void setParentValue(uint64_t value) override { parent_value_ = value; }
+  void setParentValue(uint64_t value) override {
+    parent_value_ = value;
+    flags_ |= Flags::Changed;
+  }
 
 private:
   std::atomic<uint64_t> parent_value_{0};
@@ -267,7 +338,13 @@ CounterSharedPtr AllocatorImpl::makeCounter(StatName name, StatName tag_extracte
   if (iter != counters_.end()) {
     return CounterSharedPtr(*iter);
   }
-  auto counter = CounterSharedPtr(makeCounterInternal(name, tag_extracted_name, stat_name_tags));
+  Counter* counter_ptr;
+  if (!sharded_counter_names_.empty() && sharded_counter_names_.contains(tag_extracted_name)) {
+    counter_ptr = new ShardedCounterImpl(name, *this, tag_extracted_name, stat_name_tags);
+  } else {
+    counter_ptr = makeCounterInternal(name, tag_extracted_name, stat_name_tags);
+  }
+  auto counter = CounterSharedPtr(counter_ptr);
   counters_.insert(counter.get());
   return counter;
 }
@@ -303,6 +380,13 @@ TextReadoutSharedPtr AllocatorImpl::makeTextReadout(StatName name, StatName tag_
   return text_readout;
 }
 
+void AllocatorImpl::setShardedCounterNames(const std::vector<std::string>& names) {
+  Thread::LockGuard lock(mutex_);
+  for (const std::string& name : names) {
+    sharded_counter_names_.insert(sharded_counter_pool_.add(name));
+  }
+}
+
 bool AllocatorImpl::isMutexLockedForTest() {
   bool locked = mutex_.tryLock();
   if (locked) {
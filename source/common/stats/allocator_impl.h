@@ -1,5 +1,6 @@
 #pragma once
 
+#include <string>
 #include <vector>
 
 #include "envoy/stats/allocator.h"
@@ -8,6 +9,7 @@
 
 #include "common/common/thread_synchronizer.h"
 #include "common/stats/metric_impl.h"
+#include "common/stats/symbol_table_impl.h"
 
 #include "absl/container/flat_hash_set.h"
 #include "absl/strings/string_view.h"
@@ -19,7 +21,8 @@ class AllocatorImpl : public Allocator {
 public:
   static const char DecrementToZeroSyncPoint[];
 
-  AllocatorImpl(SymbolTable& symbol_table) : symbol_table_(symbol_table) {}
+  AllocatorImpl(SymbolTable& symbol_table)
+      : symbol_table_(symbol_table), sharded_counter_pool_(symbol_table) {}
   ~AllocatorImpl() override;
 
   // Allocator
@@ -37,6 +40,16 @@ public:
   void debugPrint();
 #endif
 
+  /**
+   * Counters subsequently created with one of the given tag-extracted names keep their value in
+   * per-thread, cache-line sized shards rather than in a single atomic, so that workers
+   * incrementing them concurrently do not contend on one cache line. Reading or latching such a
+   * counter sums the shards, and each one costs a few KiB, so this is only worthwhile for the
+   * handful of counters incremented by every worker on every request.
+   * @param names supplies the tag-extracted names of the counters to shard.
+   */
+  void setShardedCounterNames(const std::vector<std::string>& names) override;
+
   /**
    * @return a thread synchronizer object used for reproducing a race-condition in tests.
    */
@@ -54,6 +67,7 @@ protected:
 private:
   template <class BaseClass> friend class StatsSharedImpl;
   friend class CounterImpl;
+  friend class ShardedCounterImpl;
   friend class GaugeImpl;
   friend class TextReadoutImpl;
   friend class NotifyingAllocatorImpl;
@@ -68,6 +82,9 @@ private:
 
   SymbolTable& symbol_table_;
 
+  StatNamePool sharded_counter_pool_ ABSL_GUARDED_BY(mutex_);
+  StatNameHashSet sharded_counter_names_ ABSL_GUARDED_BY(mutex_);
+
   // A mutex is needed here to protect both the stats_ object from both
   // alloc() and free() operations. Although alloc() operations are called under existing locking,
   // free() operations are made from the destructors of the individual stat objects, which are not
@@ -1,6 +1,7 @@
 #include "common/stats/histogram_impl.h"
 
 #include <algorithm>
+#include <limits>
 #include <string>
 
 #include "common/common/utility.h"
@@ -34,6 +35,12 @@ HistogramStatisticsImpl::HistogramStatisticsImpl(const histogram_t* histogram_pt
   }
 }
 
+HistogramStatisticsImpl::HistogramStatisticsImpl(ConstSupportedBuckets& supported_buckets)
+    : supported_buckets_(supported_buckets),
+      computed_quantiles_(HistogramStatisticsImpl::supportedQuantiles().size(),
+                          std::numeric_limits<double>::quiet_NaN()),
+      computed_buckets_(supported_buckets.size(), 0), sample_count_(0), sample_sum_(0) {}
+
 const std::vector<double>& HistogramStatisticsImpl::supportedQuantiles() const {
   CONSTRUCT_ON_FIRST_USE(std::vector<double>,
                          {0, 0.25, 0.5, 0.75, 0.90, 0.95, 0.99, 0.995, 0.999, 1});
@@ -81,25 +88,112 @@ void HistogramStatisticsImpl::refresh(const histogram_t* new_histogram_ptr) {
   }
 }
 
+void HistogramStatisticsImpl::refresh(const FixedBucketHistogram& histogram) {
+  ConstSupportedBuckets& supported_buckets = supportedBuckets();
+  ASSERT(supported_buckets == histogram.supportedBuckets());
+  ASSERT(supportedBuckets().size() == computed_buckets_.size());
+  uint64_t count_below = 0;
+  for (size_t i = 0; i < supported_buckets.size(); ++i) {
+    count_below += histogram.bucketCount(i);
+    computed_buckets_[i] = count_below;
+  }
+  sample_count_ = count_below + histogram.bucketCount(supported_buckets.size());
+  sample_sum_ = histogram.sampleSum();
+
+  const std::vector<double>& supported_quantiles = supportedQuantiles();
+  ASSERT(supported_quantiles.size() == computed_quantiles_.size());
+  for (size_t i = 0; i < supported_quantiles.size(); ++i) {
+    if (sample_count_ == 0) {
+      computed_quantiles_[i] = std::numeric_limits<double>::quiet_NaN();
+      continue;
+    }
+    // Find the first non-empty bucket holding the value of the given rank, and interpolate the
+    // value within it. Values in the overflow bucket have no upper bound, so report its lower one.
+    const double rank = supported_quantiles[i] * sample_count_;
+    size_t bucket = 0;
+    while (bucket < computed_buckets_.size() &&
+           (computed_buckets_[bucket] == 0 || computed_buckets_[bucket] < rank)) {
+      ++bucket;
+    }
+    if (bucket == computed_buckets_.size()) {
+      computed_quantiles_[i] = supported_buckets.empty() ? 0 : supported_buckets.back();
+      continue;
+    }
+    const double lower_bound = bucket == 0 ? 0 : supported_buckets[bucket - 1];
+    const uint64_t count_before = bucket == 0 ? 0 : computed_buckets_[bucket - 1];
+    const uint64_t count_in_bucket = computed_buckets_[bucket] - count_before;
+    computed_quantiles_[i] = lower_bound + (supported_buckets[bucket] - lower_bound) *
+                                               std::max(0.0, rank - count_before) /
+                                               count_in_bucket;
+  }
+}
+
+FixedBucketHistogram::FixedBucketHistogram(ConstSupportedBuckets& supported_buckets)
+    : supported_buckets_(supported_buckets), counts_(supported_buckets.size() + 1) {}
+
+void FixedBucketHistogram::recordValue(uint64_t value) {
+  // A value equal to a bucket's upper bound belongs in that bucket, as for hist_approx_count_below.
+  const auto bucket = std::lower_bound(supported_buckets_.begin(), supported_buckets_.end(),
+                                       static_cast<double>(value));
+  counts_[bucket - supported_buckets_.begin()].fetch_add(1, std::memory_order_relaxed);
+  sum_.fetch_add(value, std::memory_order_relaxed);
+}
+
+void FixedBucketHistogram::addTo(FixedBucketHistogram& target) const {
+  ASSERT(counts_.size() == target.counts_.size());
+  for (size_t i = 0; i < counts_.size(); ++i) {
+    target.counts_[i].fetch_add(counts_[i].load(std::memory_order_relaxed),
+                                std::memory_order_relaxed);
+  }
+  target.sum_.fetch_add(sum_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+void FixedBucketHistogram::moveTo(FixedBucketHistogram& target) {
+  ASSERT(counts_.size() == target.counts_.size());
+  for (size_t i = 0; i < counts_.size(); ++i) {
+    target.counts_[i].fetch_add(counts_[i].exchange(0, std::memory_order_relaxed),
+                                std::memory_order_relaxed);
+  }
+  target.sum_.fetch_add(sum_.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+void FixedBucketHistogram::clear() {
+  for (auto& count : counts_) {
+    count.store(0, std::memory_order_relaxed);
+  }
+  sum_.store(0, std::memory_order_relaxed);
+}
+
 HistogramSettingsImpl::HistogramSettingsImpl(const envoy::config::metrics::v3::StatsConfig& config)
     : configs_([&config]() {
         std::vector<Config> configs;
         for (const auto& matcher : config.histogram_bucket_settings()) {
           std::vector<double> buckets{matcher.buckets().begin(), matcher.buckets().end()};
           std::sort(buckets.begin(), buckets.end());
-          configs.emplace_back(matcher.match(), std::move(buckets));
+          configs.emplace_back(matcher.match(), std::move(buckets), matcher.fixed_buckets());
         }
 
         return configs;
       }()) {}
 
-const ConstSupportedBuckets& HistogramSettingsImpl::buckets(absl::string_view stat_name) const {
+const HistogramSettingsImpl::Config*
+HistogramSettingsImpl::findConfig(absl::string_view stat_name) const {
   for (const auto& config : configs_) {
-    if (config.first.match(stat_name)) {
-      return config.second;
+    if (config.matcher_.match(stat_name)) {
+      return &config;
     }
   }
-  return defaultBuckets();
+  return nullptr;
+}
+
+const ConstSupportedBuckets& HistogramSettingsImpl::buckets(absl::string_view stat_name) const {
+  const Config* config = findConfig(stat_name);
+  return config != nullptr ? config->buckets_ : defaultBuckets();
+}
+
+bool HistogramSettingsImpl::fixedBuckets(absl::string_view stat_name) const {
+  const Config* config = findConfig(stat_name);
+  return config != nullptr && config->fixed_buckets_;
 }
 
 const ConstSupportedBuckets& HistogramSettingsImpl::defaultBuckets() {
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "envoy/config/metrics/v3/stats.pb.h"
 #include "envoy/stats/histogram.h"
@@ -24,16 +26,73 @@ public:
 
   // HistogramSettings
   const ConstSupportedBuckets& buckets(absl::string_view stat_name) const override;
+  bool fixedBuckets(absl::string_view stat_name) const override;
 
   static ConstSupportedBuckets& defaultBuckets();
 
 private:
-  using Config = std::pair<Matchers::StringMatcherImpl, ConstSupportedBuckets>;
+  struct Config {
+    Config(const envoy::type::matcher::v3::StringMatcher& matcher, std::vector<double>&& buckets,
+           bool fixed_buckets)
+        : matcher_(matcher), buckets_(std::move(buckets)), fixed_buckets_(fixed_buckets) {}
+
+    Matchers::StringMatcherImpl matcher_;
+    ConstSupportedBuckets buckets_;
+    bool fixed_buckets_;
+  };
+  const Config* findConfig(absl::string_view stat_name) const;
+
   const std::vector<Config> configs_{};
 };
 
 /**
- * Implementation of HistogramStatistics for circllhist.
+ * A histogram that counts values into a fixed set of buckets, given by the upper bound of each
+ * bucket, plus an overflow bucket for values above the last bound. Unlike circllhist, recording a
+ * value is an atomic increment of a preallocated count, so one thread can record values while
+ * another moves them out, and merging two histograms is linear in the number of buckets.
+ */
+class FixedBucketHistogram : NonCopyable {
+public:
+  /**
+   * @param supported_buckets the sorted upper bounds of the buckets. This reference is retained.
+   */
+  explicit FixedBucketHistogram(ConstSupportedBuckets& supported_buckets);
+
+  void recordValue(uint64_t value);
+
+  /**
+   * Adds the counts of this histogram to target.
+   */
+  void addTo(FixedBucketHistogram& target) const;
+
+  /**
+   * Adds the counts of this histogram to target and clears them. This may be called while another
+   * thread records values into this histogram.
+   */
+  void moveTo(FixedBucketHistogram& target);
+
+  void clear();
+
+  ConstSupportedBuckets& supportedBuckets() const { return supported_buckets_; }
+
+  /**
+   * @param index of the bucket, where supportedBuckets().size() is the overflow bucket.
+   * @return the number of values recorded in the bucket.
+   */
+  uint64_t bucketCount(size_t index) const {
+    return counts_[index].load(std::memory_order_relaxed);
+  }
+
+  uint64_t sampleSum() const { return sum_.load(std::memory_order_relaxed); }
+
+private:
+  ConstSupportedBuckets& supported_buckets_;
+  std::vector<std::atomic<uint64_t>> counts_;
+  std::atomic<uint64_t> sum_{0};
+};
+
+/**
+ * Implementation of HistogramStatistics for circllhist and FixedBucketHistogram.
  */
 class HistogramStatisticsImpl : public HistogramStatistics, NonCopyable {
 public:
@@ -48,10 +107,21 @@ public:
       const histogram_t* histogram_ptr,
       ConstSupportedBuckets& supported_buckets = HistogramSettingsImpl::defaultBuckets());
 
+  /**
+   * HistogramStatisticsImpl object is constructed for an empty histogram.
+   */
+  explicit HistogramStatisticsImpl(ConstSupportedBuckets& supported_buckets);
+
   static ConstSupportedBuckets& defaultSupportedBuckets();
 
   void refresh(const histogram_t* new_histogram_ptr);
 
+  /**
+   * Refreshes the computed values from a histogram whose buckets are supportedBuckets(). The
+   * bucket counts are exact, and the quantiles are interpolated linearly within their bucket.
+   */
+  void refresh(const FixedBucketHistogram& histogram);
+
   // HistogramStatistics
   std::string quantileSummary() const override;
   std::string bucketSummary() const override;
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <iostream>
 #include <memory>
+#include <tuple>
 #include <vector>
 
 #include "common/common/assert.h"
@@ -157,11 +158,8 @@ void SymbolTableImpl::Encoding::decodeTokens(
 std::vector<absl::string_view> SymbolTableImpl::decodeStrings(const SymbolTable::Storage array,
                                                               size_t size) const {
   std::vector<absl::string_view> strings;
-  Thread::LockGuard lock(lock_);
   Encoding::decodeTokens(
-      array, size,
-      [this, &strings](Symbol symbol)
-          ABSL_NO_THREAD_SAFETY_ANALYSIS { strings.push_back(fromSymbol(symbol)); },
+      array, size, [this, &strings](Symbol symbol) { strings.push_back(fromSymbol(symbol)); },
       [&strings](absl::string_view str) { strings.push_back(str); });
   return strings;
 }
@@ -192,6 +190,17 @@ SymbolTableImpl::~SymbolTableImpl() {
   // is needed in production. But it would be good to ensure clean up during
   // tests.
   ASSERT(numSymbols() == 0);
+
+  for (uint32_t i = 0; i < NumDecodeSegments; ++i) {
+    DecodeSlot* segment = decode_segments_[i].load(std::memory_order_relaxed);
+    if (segment == nullptr) {
+      break;
+    }
+    for (uint32_t j = 0; j < (DecodeSegmentBase << i); ++j) {
+      delete segment[j].load(std::memory_order_relaxed);
+    }
+    delete[] segment;
+  }
 }
 
 // TODO(ambuc): There is a possible performance optimization here for avoiding
@@ -208,18 +217,22 @@ void SymbolTableImpl::addTokensToEncoding(const absl::string_view name, Encoding
   std::vector<Symbol> symbols;
   symbols.reserve(tokens.size());
 
-  // Now take the lock and populate the Symbol objects, which involves bumping
-  // ref-counts in this.
-  {
+  // Only take lock_ when the names themselves are being remembered; otherwise the lookup is just
+  // counted in the first token's encode shard.
+  const bool track_lookup = recent_lookups_enabled_.load(std::memory_order_relaxed);
+  if (track_lookup) {
     Thread::LockGuard lock(lock_);
     recent_lookups_.lookup(name);
-    for (auto& token : tokens) {
-      // TODO(jmarantz): consider using StatNameDynamicStorage for tokens with
-      // length below some threshold, say 4 bytes. It might be preferable not to
-      // reserve Symbols for every 3 digit number found (for example) in ipv4
-      // addresses.
-      symbols.push_back(toSymbol(token));
-    }
+  }
+
+  // Now populate the Symbol objects, which involves bumping ref-counts in this.
+  // Each token only locks its own encode shard.
+  for (size_t i = 0; i < tokens.size(); ++i) {
+    // TODO(jmarantz): consider using StatNameDynamicStorage for tokens with
+    // length below some threshold, say 4 bytes. It might be preferable not to
+    // reserve Symbols for every 3 digit number found (for example) in ipv4
+    // addresses.
+    symbols.push_back(toSymbol(tokens[i], !track_lookup && i == 0));
   }
 
   // Now efficiently encode the array of 32-bit symbols into a uint8_t array.
@@ -227,9 +240,12 @@ void SymbolTableImpl::addTokensToEncoding(const absl::string_view name, Encoding
 }
 
 uint64_t SymbolTableImpl::numSymbols() const {
-  Thread::LockGuard lock(lock_);
-  ASSERT(encode_map_.size() == decode_map_.size());
-  return encode_map_.size();
+  uint64_t num_symbols = 0;
+  for (const EncodeShard& shard : encode_shards_) {
+    Thread::LockGuard lock(shard.lock_);
+    num_symbols += shard.encode_map_.size();
+  }
+  return num_symbols;
 }
 
 std::string SymbolTableImpl::toString(const StatName& stat_name) const {
@@ -245,13 +261,12 @@ void SymbolTableImpl::incRefCount(const StatName& stat_name) {
   // Before taking the lock, decode the array of symbols from the SymbolTable::Storage.
   const SymbolVec symbols = Encoding::decodeSymbols(stat_name.data(), stat_name.dataSize());
 
-  Thread::LockGuard lock(lock_);
   for (Symbol symbol : symbols) {
-    auto decode_search = decode_map_.find(symbol);
-    ASSERT(decode_search != decode_map_.end());
-
-    auto encode_search = encode_map_.find(decode_search->second->toStringView());
-    ASSERT(encode_search != encode_map_.end());
+    const absl::string_view token = fromSymbol(symbol);
+    EncodeShard& shard = encodeShard(token);
+    Thread::LockGuard lock(shard.lock_);
+    auto encode_search = shard.encode_map_.find(token);
+    ASSERT(encode_search != shard.encode_map_.end());
 
     ++encode_search->second.ref_count_;
   }
@@ -261,25 +276,35 @@ void SymbolTableImpl::free(const StatName& stat_name) {
   // Before taking the lock, decode the array of symbols from the SymbolTable::Storage.
   const SymbolVec symbols = Encoding::decodeSymbols(stat_name.data(), stat_name.dataSize());
 
-  Thread::LockGuard lock(lock_);
   for (Symbol symbol : symbols) {
-    auto decode_search = decode_map_.find(symbol);
-    ASSERT(decode_search != decode_map_.end());
-
-    auto encode_search = encode_map_.find(decode_search->second->toStringView());
-    ASSERT(encode_search != encode_map_.end());
-
-    // If that was the last remaining client usage of the symbol, erase the
-    // current mappings and add the now-unused symbol to the reuse pool.
-    //
-    // The "if (--EXPR.ref_count_)" pattern speeds up BM_CreateRace by 20% in
-    // symbol_table_speed_test.cc, relative to breaking out the decrement into a
-    // separate step, likely due to the non-trivial dereferences in EXPR.
-    if (--encode_search->second.ref_count_ == 0) {
-      decode_map_.erase(decode_search);
-      encode_map_.erase(encode_search);
-      pool_.push(symbol);
+    DecodeSlot* slot = decodeSlot(symbol);
+    ASSERT(slot != nullptr);
+    InlineString* str = slot->load(std::memory_order_acquire);
+    ASSERT(str != nullptr);
+    EncodeShard& shard = encodeShard(str->toStringView());
+
+    {
+      Thread::LockGuard lock(shard.lock_);
+      auto encode_search = shard.encode_map_.find(str->toStringView());
+      ASSERT(encode_search != shard.encode_map_.end());
+
+      // The "if (--EXPR.ref_count_)" pattern speeds up BM_CreateRace by 20% in
+      // symbol_table_speed_test.cc, relative to breaking out the decrement into a
+      // separate step, likely due to the non-trivial dereferences in EXPR.
+      if (--encode_search->second.ref_count_ != 0) {
+        continue;
+      }
+      // That was the last remaining client usage of the symbol, so erase the
+      // current mappings. Once the encode map entry is gone nothing else can
+      // reach the string, so it can be deleted outside the shard lock.
+      shard.encode_map_.erase(encode_search);
+      slot->store(nullptr, std::memory_order_relaxed);
     }
+    delete str;
+
+    // Add the now-unused symbol to the reuse pool.
+    Thread::LockGuard lock(lock_);
+    pool_.push(symbol);
   }
 }
 
@@ -296,6 +321,10 @@ uint64_t SymbolTableImpl::getRecentLookups(const RecentLookupsFn& iter) const {
             ABSL_NO_THREAD_SAFETY_ANALYSIS { name_count_map[std::string(str)] += count; });
     total += recent_lookups_.total();
   }
+  for (const EncodeShard& shard : encode_shards_) {
+    Thread::LockGuard lock(shard.lock_);
+    total += shard.untracked_lookups_;
+  }
 
   // Now we have the collated name-count map data: we need to vectorize and
   // sort. We define the pair with the count first as std::pair::operator<
@@ -342,11 +371,18 @@ DynamicSpans SymbolTableImpl::getDynamicSpans(StatName stat_name) const {
 void SymbolTableImpl::setRecentLookupCapacity(uint64_t capacity) {
   Thread::LockGuard lock(lock_);
   recent_lookups_.setCapacity(capacity);
+  recent_lookups_enabled_.store(capacity != 0, std::memory_order_relaxed);
 }
 
 void SymbolTableImpl::clearRecentLookups() {
-  Thread::LockGuard lock(lock_);
-  recent_lookups_.clear();
+  {
+    Thread::LockGuard lock(lock_);
+    recent_lookups_.clear();
+  }
+  for (EncodeShard& shard : encode_shards_) {
+    Thread::LockGuard lock(shard.lock_);
+    shard.untracked_lookups_ = 0;
+  }
 }
 
 uint64_t SymbolTableImpl::recentLookupCapacity() const {
@@ -360,23 +396,26 @@ StatNameSetPtr SymbolTableImpl::makeSet(absl::string_view name) {
   return stat_name_set;
 }
 
-Symbol SymbolTableImpl::toSymbol(absl::string_view sv) {
+Symbol SymbolTableImpl::toSymbol(absl::string_view sv, bool count_lookup) {
+  EncodeShard& shard = encodeShard(sv);
+  Thread::LockGuard lock(shard.lock_);
+  if (count_lookup) {
+    ++shard.untracked_lookups_;
+  }
   Symbol result;
-  auto encode_find = encode_map_.find(sv);
+  auto encode_find = shard.encode_map_.find(sv);
   // If the string segment doesn't already exist,
-  if (encode_find == encode_map_.end()) {
-    // We create the actual string, place it in the decode_map_, and then insert
-    // a string_view pointing to it in the encode_map_. This allows us to only
-    // store the string once. We use unique_ptr so copies are not made as
-    // flat_hash_map moves values around.
+  if (encode_find == shard.encode_map_.end()) {
+    // We create the actual string, place it in the decode table, and then insert
+    // a string_view pointing to it in the encode map. This allows us to only
+    // store the string once.
+    result = allocateSymbol();
     InlineStringPtr str = InlineString::create(sv);
-    auto encode_insert = encode_map_.insert({str->toStringView(), SharedSymbol(next_symbol_)});
+    auto encode_insert = shard.encode_map_.insert({str->toStringView(), SharedSymbol(result)});
     ASSERT(encode_insert.second);
-    auto decode_insert = decode_map_.insert({next_symbol_, std::move(str)});
-    ASSERT(decode_insert.second);
-
-    result = next_symbol_;
-    newSymbol();
+    DecodeSlot* slot = decodeSlot(result);
+    ASSERT(slot != nullptr && slot->load(std::memory_order_relaxed) == nullptr);
+    slot->store(str.release(), std::memory_order_release);
   } else {
     // If the insertion didn't take place, return the actual value at that location and up the
     // refcount at that location
@@ -386,14 +425,52 @@ Symbol SymbolTableImpl::toSymbol(absl::string_view sv) {
   return result;
 }
 
-absl::string_view SymbolTableImpl::fromSymbol(const Symbol symbol) const
-    ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_) {
-  auto search = decode_map_.find(symbol);
-  RELEASE_ASSERT(search != decode_map_.end(), "no such symbol");
-  return search->second->toStringView();
+absl::string_view SymbolTableImpl::fromSymbol(const Symbol symbol) const {
+  const DecodeSlot* slot = decodeSlot(symbol);
+  const InlineString* str = slot == nullptr ? nullptr : slot->load(std::memory_order_acquire);
+  RELEASE_ASSERT(str != nullptr, "no such symbol");
+  return str->toStringView();
+}
+
+SymbolTableImpl::DecodeSlot* SymbolTableImpl::decodeSlot(const Symbol symbol) const {
+  // Segment i covers the DecodeSegmentBase << i symbols starting at DecodeSegmentBase * (2^i - 1),
+  // so the segment is floor(log2(symbol / DecodeSegmentBase + 1)).
+  uint32_t index = symbol / DecodeSegmentBase + 1;
+  uint32_t segment = 0;
+  for (uint32_t shift = 16; shift > 0; shift >>= 1) {
+    if (index >= (1u << shift)) {
+      index >>= shift;
+      segment += shift;
+    }
+  }
+  DecodeSlot* slots = decode_segments_[segment].load(std::memory_order_acquire);
+  if (slots == nullptr) {
+    return nullptr;
+  }
+  return &slots[symbol - DecodeSegmentBase * ((1u << segment) - 1)];
 }
 
-void SymbolTableImpl::newSymbol() ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_) {
+Symbol SymbolTableImpl::allocateSymbol() {
+  Thread::LockGuard lock(lock_);
+  const Symbol symbol = next_symbol_;
+  newSymbol();
+
+  // Symbols are handed out in increasing order unless they come from the pool, so the segment of
+  // a new symbol is at most one past the last allocated segment.
+  if (decodeSlot(symbol) == nullptr) {
+    for (uint32_t i = 0; i < NumDecodeSegments; ++i) {
+      if (decode_segments_[i].load(std::memory_order_relaxed) == nullptr) {
+        decode_segments_[i].store(new DecodeSlot[DecodeSegmentBase << i]{},
+                                  std::memory_order_release);
+        break;
+      }
+    }
+    ASSERT(decodeSlot(symbol) != nullptr);
+  }
+  return symbol;
+}
+
+void SymbolTableImpl::newSymbol() {
   if (pool_.empty()) {
     next_symbol_ = ++monotonic_counter_;
   } else {
@@ -423,16 +500,17 @@ bool SymbolTableImpl::lessThan(const StatName& a, const StatName& b) const {
 
 #ifndef ENVOY_CONFIG_COVERAGE
 void SymbolTableImpl::debugPrint() const {
-  Thread::LockGuard lock(lock_);
-  std::vector<Symbol> symbols;
-  for (const auto& p : decode_map_) {
-    symbols.push_back(p.first);
+  std::vector<std::tuple<Symbol, absl::string_view, uint32_t>> symbols;
+  for (const EncodeShard& shard : encode_shards_) {
+    Thread::LockGuard lock(shard.lock_);
+    for (const auto& p : shard.encode_map_) {
+      symbols.emplace_back(p.second.symbol_, p.first, p.second.ref_count_);
+    }
   }
   std::sort(symbols.begin(), symbols.end());
-  for (Symbol symbol : symbols) {
-    const InlineString& token = *decode_map_.find(symbol)->second;
-    const SharedSymbol& shared_symbol = encode_map_.find(token.toStringView())->second;
-    ENVOY_LOG_MISC(info, "{}: '{}' ({})", symbol, token.toStringView(), shared_symbol.ref_count_);
+  for (const auto& symbol : symbols) {
+    ENVOY_LOG_MISC(info, "{}: '{}' ({})", std::get<0>(symbol), std::get<1>(symbol),
+                   std::get<2>(symbol));
   }
 }
 #endif
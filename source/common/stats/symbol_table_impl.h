@@ -1,6 +1,8 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstring>
 #include <memory>
 #include <stack>
@@ -212,7 +214,32 @@ private:
     uint32_t ref_count_;
   };
 
-  // This must be held during both encode() and free().
+  // The encode map stores both the symbol and the ref count of that symbol.
+  // Using absl::string_view lets us only store the complete string once, in the decode table.
+  using EncodeMap = absl::flat_hash_map<absl::string_view, SharedSymbol>;
+
+  // The encode map is split into shards by the hash of each token, so that threads encoding or
+  // freeing different tokens rarely contend on the same lock.
+  static constexpr uint32_t NumEncodeShards = 16;
+  struct alignas(64) EncodeShard {
+    mutable Thread::MutexBasicLockable lock_;
+    EncodeMap encode_map_ ABSL_GUARDED_BY(lock_);
+    // Lookups counted while recent_lookups_ is disabled, attributed to the shard of the name's
+    // first token so that they can be counted under a lock the encode already takes.
+    uint64_t untracked_lookups_ ABSL_GUARDED_BY(lock_){0};
+  };
+
+  // Symbols are dense small integers, so the decode table is an array indexed by symbol. It is
+  // split into segments of doubling size, starting at DecodeSegmentBase entries, which are
+  // allocated as the symbol count grows and never move, so lookups need no lock. A caller can only
+  // decode symbols of a StatName it holds a reference to, and those symbols can't be freed or
+  // reused while it does.
+  static constexpr uint32_t DecodeSegmentBase = 256;
+  static constexpr uint32_t NumDecodeSegments = 25; // Enough to index every 32-bit Symbol.
+  using DecodeSlot = std::atomic<InlineString*>;
+
+  // Guards symbol allocation and recent_lookups_. Lock ordering: an encode shard's lock_ may be
+  // held while acquiring this one, but not the other way around.
   mutable Thread::MutexBasicLockable lock_;
 
   /**
@@ -234,9 +261,10 @@ private:
    * Convenience function for encode(), symbolizing one string segment at a time.
    *
    * @param sv the individual string to be encoded as a symbol.
+   * @param count_lookup whether to count an untracked lookup in the token's shard.
    * @return Symbol the encoded string.
    */
-  Symbol toSymbol(absl::string_view sv) ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  Symbol toSymbol(absl::string_view sv, bool count_lookup);
 
   /**
    * Convenience function for decode(), decoding one symbol at a time.
@@ -244,12 +272,30 @@ private:
    * @param symbol the individual symbol to be decoded.
    * @return absl::string_view the decoded string.
    */
-  absl::string_view fromSymbol(Symbol symbol) const ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  absl::string_view fromSymbol(Symbol symbol) const;
+
+  /**
+   * @return the decode table slot for symbol, or nullptr if no symbol this large has been
+   *         allocated.
+   */
+  DecodeSlot* decodeSlot(Symbol symbol) const;
+
+  /**
+   * @return the encode shard holding the given token.
+   */
+  EncodeShard& encodeShard(absl::string_view token) {
+    return encode_shards_[HashUtil::xxHash64(token) % NumEncodeShards];
+  }
+
+  /**
+   * Takes the staged symbol for a new token, making sure its decode table slot exists.
+   */
+  Symbol allocateSymbol();
 
   /**
    * Stages a new symbol for use. To be called after a successful insertion.
    */
-  void newSymbol();
+  void newSymbol() ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
 
   /**
    * Tokenizes name, finds or allocates symbols for each token, and adds them
@@ -272,19 +318,19 @@ private:
   // If the free pool is exhausted, we monotonically increase this counter.
   Symbol monotonic_counter_;
 
-  // Bitmap implementation.
-  // The encode map stores both the symbol and the ref count of that symbol.
-  // Using absl::string_view lets us only store the complete string once, in the decode map.
-  using EncodeMap = absl::flat_hash_map<absl::string_view, SharedSymbol>;
-  using DecodeMap = absl::flat_hash_map<Symbol, InlineStringPtr>;
-  EncodeMap encode_map_ ABSL_GUARDED_BY(lock_);
-  DecodeMap decode_map_ ABSL_GUARDED_BY(lock_);
+  std::array<EncodeShard, NumEncodeShards> encode_shards_;
+  // Segment i holds the strings of DecodeSegmentBase << i consecutive symbols. Segments are only
+  // allocated with lock_ held.
+  std::array<std::atomic<DecodeSlot*>, NumDecodeSegments> decode_segments_{};
 
   // Free pool of symbols for re-use.
   // TODO(ambuc): There might be an optimization here relating to storing ranges of freed symbols
   // using an Envoy::IntervalSet.
   std::stack<Symbol> pool_ ABSL_GUARDED_BY(lock_);
   RecentLookups recent_lookups_ ABSL_GUARDED_BY(lock_);
+  // Whether recent_lookups_ has a non-zero capacity, so that encoding only needs to take lock_ to
+  // record lookups when they are actually being tracked.
+  std::atomic<bool> recent_lookups_enabled_{false};
 };
 
 // Base class for holding the backing-storing for a StatName. The two derived
@@ -5,6 +5,7 @@
 #include <list>
 #include <memory>
 #include <string>
+#include <thread>
 
 #include "envoy/stats/allocator.h"
 #include "envoy/stats/histogram.h"
@@ -12,6 +13,7 @@
 #include "envoy/stats/stats.h"
 
 #include "common/common/lock_guard.h"
+#include "common/runtime/runtime_features.h"
 #include "common/stats/histogram_impl.h"
 #include "common/stats/stats_matcher_impl.h"
 #include "common/stats/tag_producer_impl.h"
@@ -221,13 +223,67 @@ void ThreadLocalStoreImpl::mergeHistograms(PostMergeCb merge_complete_cb) {
   }
 }
 
+namespace {
+
+// The histograms being merged by all threads at once. Each thread repeatedly claims the next
+// histogram that nobody has started on, until there are none left.
+struct ParallelHistogramMerge {
+  void prepare() {
+    for (size_t i = next_++; i < histograms_.size(); i = next_++) {
+      histograms_[i]->prepareMerge();
+    }
+  }
+
+  std::vector<ParentHistogramImplSharedPtr> histograms_;
+  std::atomic<size_t> next_{0};
+};
+
+} // namespace
+
 void ThreadLocalStoreImpl::mergeInternal(PostMergeCb merge_complete_cb) {
   if (!shutting_down_) {
-    for (const ParentHistogramSharedPtr& histogram : histograms()) {
-      histogram->merge();
+    if (!Runtime::runtimeFeatureEnabled("envoy.reloadable_features.parallel_histogram_merge")) {
+      for (const ParentHistogramSharedPtr& histogram : histograms()) {
+        histogram->merge();
+      }
+      merge_complete_cb();
+      merge_in_progress_ = false;
+      return;
     }
-    merge_complete_cb();
-    merge_in_progress_ = false;
+
+    // Combining the TLS histograms and computing the statistics of each histogram is spread across
+    // the workers, and the main thread only publishes the results.
+    auto merge = std::make_shared<ParallelHistogramMerge>();
+    {
+      Thread::LockGuard lock(hist_mutex_);
+      merge->histograms_.reserve(histogram_set_.size());
+      for (ParentHistogramImpl* histogram : histogram_set_) {
+        merge->histograms_.emplace_back(histogram);
+      }
+    }
+    const std::thread::id main_thread_id = std::this_thread::get_id();
+    tls_->runOnAllThreads(
+        [merge, main_thread_id](ThreadLocal::ThreadLocalObjectSharedPtr object)
+            -> ThreadLocal::ThreadLocalObjectSharedPtr {
+          // The main thread runs this before posting it to the workers, so leave the work to them.
+          if (std::this_thread::get_id() != main_thread_id) {
+            merge->prepare();
+          }
+          return object;
+        },
+        [this, merge, merge_complete_cb]() -> void {
+          // Covers the case where there are no workers.
+          merge->prepare();
+          for (const ParentHistogramImplSharedPtr& histogram : merge->histograms_) {
+            histogram->finishMerge();
+          }
+          // Release the histograms here rather than on whichever worker drops the last reference.
+          merge->histograms_.clear();
+          if (!shutting_down_) {
+            merge_complete_cb();
+          }
+          merge_in_progress_ = false;
+        });
   }
 }
 
@@ -613,10 +669,12 @@ Histogram& ThreadLocalStoreImpl::ScopeImpl::histogramFromStatNameWithTags(
     StatNameTagHelper tag_helper(parent_, joiner.tagExtractedName(), stat_name_tags);
 
     ConstSupportedBuckets* buckets = nullptr;
-    symbolTable().callWithStringView(final_stat_name,
-                                     [&buckets, this](absl::string_view stat_name) {
-                                       buckets = &parent_.histogram_settings_->buckets(stat_name);
-                                     });
+    bool fixed_buckets = false;
+    symbolTable().callWithStringView(
+        final_stat_name, [&buckets, &fixed_buckets, this](absl::string_view stat_name) {
+          buckets = &parent_.histogram_settings_->buckets(stat_name);
+          fixed_buckets = parent_.histogram_settings_->fixedBuckets(stat_name);
+        });
 
     RefcountPtr<ParentHistogramImpl> stat;
     {
@@ -627,7 +685,7 @@ Histogram& ThreadLocalStoreImpl::ScopeImpl::histogramFromStatNameWithTags(
       } else {
         stat = new ParentHistogramImpl(final_stat_name, unit, parent_,
                                        tag_helper.tagExtractedName(), tag_helper.statNameTags(),
-                                       *buckets, parent_.next_histogram_id_++);
+                                       *buckets, fixed_buckets, parent_.next_histogram_id_++);
         if (!parent_.shutting_down_) {
           parent_.histogram_set_.insert(stat.get());
         }
@@ -724,7 +782,8 @@ Histogram& ThreadLocalStoreImpl::tlsHistogram(ParentHistogramImpl& parent, uint6
 
   TlsHistogramSharedPtr hist_tls_ptr(
       new ThreadLocalHistogramImpl(parent.statName(), parent.unit(), tag_helper.tagExtractedName(),
-                                   tag_helper.statNameTags(), symbolTable()));
+                                   tag_helper.statNameTags(), symbolTable(),
+                                   parent.fixedBuckets()));
 
   parent.addTlsHistogram(hist_tls_ptr);
 
@@ -738,49 +797,79 @@ Histogram& ThreadLocalStoreImpl::tlsHistogram(ParentHistogramImpl& parent, uint6
 ThreadLocalHistogramImpl::ThreadLocalHistogramImpl(StatName name, Histogram::Unit unit,
                                                    StatName tag_extracted_name,
                                                    const StatNameTagVector& stat_name_tags,
-                                                   SymbolTable& symbol_table)
+                                                   SymbolTable& symbol_table,
+                                                   ConstSupportedBuckets* fixed_buckets)
     : HistogramImplHelper(name, tag_extracted_name, stat_name_tags, symbol_table), unit_(unit),
-      current_active_(0), used_(false), created_thread_id_(std::this_thread::get_id()),
-      symbol_table_(symbol_table) {
-  histograms_[0] = hist_alloc();
-  histograms_[1] = hist_alloc();
+      current_active_(0), histograms_{}, used_(false),
+      created_thread_id_(std::this_thread::get_id()), symbol_table_(symbol_table) {
+  if (fixed_buckets != nullptr) {
+    fixed_histogram_ = std::make_unique<FixedBucketHistogram>(*fixed_buckets);
+  } else {
+    histograms_[0] = hist_alloc();
+    histograms_[1] = hist_alloc();
+  }
 }
 
 ThreadLocalHistogramImpl::~ThreadLocalHistogramImpl() {
   MetricImpl::clear(symbol_table_);
-  hist_free(histograms_[0]);
-  hist_free(histograms_[1]);
+  if (fixed_histogram_ == nullptr) {
+    hist_free(histograms_[0]);
+    hist_free(histograms_[1]);
+  }
 }
 
 void ThreadLocalHistogramImpl::recordValue(uint64_t value) {
   ASSERT(std::this_thread::get_id() == created_thread_id_);
-  hist_insert_intscale(histograms_[current_active_], value, 0, 1);
+  if (fixed_histogram_ != nullptr) {
+    fixed_histogram_->recordValue(value);
+  } else {
+    hist_insert_intscale(histograms_[current_active_], value, 0, 1);
+  }
   used_ = true;
 }
 
 void ThreadLocalHistogramImpl::merge(histogram_t* target) {
+  ASSERT(fixed_histogram_ == nullptr);
   histogram_t** other_histogram = &histograms_[otherHistogramIndex()];
   hist_accumulate(target, other_histogram, 1);
   hist_clear(*other_histogram);
 }
 
+void ThreadLocalHistogramImpl::merge(FixedBucketHistogram& target) {
+  ASSERT(fixed_histogram_ != nullptr);
+  fixed_histogram_->moveTo(target);
+}
+
 ParentHistogramImpl::ParentHistogramImpl(StatName name, Histogram::Unit unit,
                                          ThreadLocalStoreImpl& thread_local_store,
                                          StatName tag_extracted_name,
                                          const StatNameTagVector& stat_name_tags,
-                                         ConstSupportedBuckets& supported_buckets, uint64_t id)
+                                         ConstSupportedBuckets& supported_buckets,
+                                         bool fixed_buckets, uint64_t id)
     : MetricImpl(name, tag_extracted_name, stat_name_tags, thread_local_store.symbolTable()),
-      unit_(unit), thread_local_store_(thread_local_store), interval_histogram_(hist_alloc()),
-      cumulative_histogram_(hist_alloc()),
-      interval_statistics_(interval_histogram_, supported_buckets),
-      cumulative_statistics_(cumulative_histogram_, supported_buckets), merged_(false), id_(id) {}
+      unit_(unit), thread_local_store_(thread_local_store),
+      interval_statistics_{HistogramStatisticsImpl(supported_buckets),
+                           HistogramStatisticsImpl(supported_buckets)},
+      cumulative_statistics_{HistogramStatisticsImpl(supported_buckets),
+                             HistogramStatisticsImpl(supported_buckets)},
+      merged_(false), id_(id) {
+  if (fixed_buckets) {
+    interval_fixed_histogram_ = std::make_unique<FixedBucketHistogram>(supported_buckets);
+    cumulative_fixed_histogram_ = std::make_unique<FixedBucketHistogram>(supported_buckets);
+  } else {
+    interval_histogram_ = hist_alloc();
+    cumulative_histogram_ = hist_alloc();
+  }
+}
 
 ParentHistogramImpl::~ParentHistogramImpl() {
   thread_local_store_.releaseHistogramCrossThread(id_);
   ASSERT(ref_count_ == 0);
   MetricImpl::clear(thread_local_store_.symbolTable());
-  hist_free(interval_histogram_);
-  hist_free(cumulative_histogram_);
+  if (interval_fixed_histogram_ == nullptr) {
+    hist_free(interval_histogram_);
+    hist_free(cumulative_histogram_);
+  }
 }
 
 void ParentHistogramImpl::incRefCount() { ++ref_count_; }
@@ -844,34 +933,63 @@ bool ParentHistogramImpl::used() const {
 }
 
 void ParentHistogramImpl::merge() {
+  prepareMerge();
+  finishMerge();
+}
+
+void ParentHistogramImpl::prepareMerge() {
   Thread::ReleasableLockGuard lock(merge_lock_);
-  if (merged_ || usedLockHeld()) {
-    hist_clear(interval_histogram_);
-    // Here we could copy all the pointers to TLS histograms in the tls_histogram_ list,
-    // then release the lock before we do the actual merge. However it is not a big deal
-    // because the tls_histogram merge is not that expensive as it is a single histogram
-    // merge and adding TLS histograms is rare.
+  merge_prepared_ = merged_ || usedLockHeld();
+  if (!merge_prepared_) {
+    return;
+  }
+  const uint32_t next_statistics = 1 - active_statistics_;
+  if (interval_fixed_histogram_ != nullptr) {
+    interval_fixed_histogram_->clear();
     for (const TlsHistogramSharedPtr& tls_histogram : tls_histograms_) {
-      tls_histogram->merge(interval_histogram_);
+      tls_histogram->merge(*interval_fixed_histogram_);
     }
-    // Since TLS merge is done, we can release the lock here.
     lock.release();
-    hist_accumulate(cumulative_histogram_, &interval_histogram_, 1);
-    cumulative_statistics_.refresh(cumulative_histogram_);
-    interval_statistics_.refresh(interval_histogram_);
+    interval_fixed_histogram_->addTo(*cumulative_fixed_histogram_);
+    cumulative_statistics_[next_statistics].refresh(*cumulative_fixed_histogram_);
+    interval_statistics_[next_statistics].refresh(*interval_fixed_histogram_);
+    return;
+  }
+
+  hist_clear(interval_histogram_);
+  // Here we could copy all the pointers to TLS histograms in the tls_histogram_ list,
+  // then release the lock before we do the actual merge. However it is not a big deal
+  // because the tls_histogram merge is not that expensive as it is a single histogram
+  // merge and adding TLS histograms is rare.
+  for (const TlsHistogramSharedPtr& tls_histogram : tls_histograms_) {
+    tls_histogram->merge(interval_histogram_);
+  }
+  // Since TLS merge is done, we can release the lock here.
+  lock.release();
+  hist_accumulate(cumulative_histogram_, &interval_histogram_, 1);
+  cumulative_statistics_[next_statistics].refresh(cumulative_histogram_);
+  interval_statistics_[next_statistics].refresh(interval_histogram_);
+}
+
+void ParentHistogramImpl::finishMerge() {
+  if (merge_prepared_) {
+    active_statistics_ = 1 - active_statistics_;
     merged_ = true;
+    merge_prepared_ = false;
   }
 }
 
 const std::string ParentHistogramImpl::quantileSummary() const {
   if (used()) {
     std::vector<std::string> summary;
-    const std::vector<double>& supported_quantiles_ref = interval_statistics_.supportedQuantiles();
+    const HistogramStatistics& interval_statistics = intervalStatistics();
+    const HistogramStatistics& cumulative_statistics = cumulativeStatistics();
+    const std::vector<double>& supported_quantiles_ref = interval_statistics.supportedQuantiles();
     summary.reserve(supported_quantiles_ref.size());
     for (size_t i = 0; i < supported_quantiles_ref.size(); ++i) {
       summary.push_back(fmt::format("P{:g}({},{})", 100 * supported_quantiles_ref[i],
-                                    interval_statistics_.computedQuantiles()[i],
-                                    cumulative_statistics_.computedQuantiles()[i]));
+                                    interval_statistics.computedQuantiles()[i],
+                                    cumulative_statistics.computedQuantiles()[i]));
     }
     return absl::StrJoin(summary, " ");
   } else {
@@ -882,12 +1000,14 @@ const std::string ParentHistogramImpl::quantileSummary() const {
 const std::string ParentHistogramImpl::bucketSummary() const {
   if (used()) {
     std::vector<std::string> bucket_summary;
-    ConstSupportedBuckets& supported_buckets = interval_statistics_.supportedBuckets();
+    const HistogramStatistics& interval_statistics = intervalStatistics();
+    const HistogramStatistics& cumulative_statistics = cumulativeStatistics();
+    ConstSupportedBuckets& supported_buckets = interval_statistics.supportedBuckets();
     bucket_summary.reserve(supported_buckets.size());
     for (size_t i = 0; i < supported_buckets.size(); ++i) {
       bucket_summary.push_back(fmt::format("B{:g}({},{})", supported_buckets[i],
-                                           interval_statistics_.computedBuckets()[i],
-                                           cumulative_statistics_.computedBuckets()[i]));
+                                           interval_statistics.computedBuckets()[i],
+                                           cumulative_statistics.computedBuckets()[i]));
     }
     return absl::StrJoin(bucket_summary, " ");
   } else {
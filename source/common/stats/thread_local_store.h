@@ -34,12 +34,23 @@ namespace Stats {
  */
 class ThreadLocalHistogramImpl : public HistogramImplHelper {
 public:
+  /**
+   * @param fixed_buckets if not null, the buckets to record values into instead of circllhist. This
+   * reference is retained.
+   */
   ThreadLocalHistogramImpl(StatName name, Histogram::Unit unit, StatName tag_extracted_name,
-                           const StatNameTagVector& stat_name_tags, SymbolTable& symbol_table);
+                           const StatNameTagVector& stat_name_tags, SymbolTable& symbol_table,
+                           ConstSupportedBuckets* fixed_buckets = nullptr);
   ~ThreadLocalHistogramImpl() override;
 
   void merge(histogram_t* target);
 
+  /**
+   * Moves the values recorded since the last merge into target. Unlike merge(histogram_t*), this
+   * needs no beginMerge() first, and may be called while the owning thread records values.
+   */
+  void merge(FixedBucketHistogram& target);
+
   /**
    * Called in the beginning of merge process. Swaps the histogram used for collection so that we do
    * not have to lock the histogram in high throughput TLS writes.
@@ -67,6 +78,8 @@ private:
   uint64_t otherHistogramIndex() const { return 1 - current_active_; }
   uint64_t current_active_;
   histogram_t* histograms_[2];
+  // Replaces histograms_ for histograms configured with fixed buckets.
+  std::unique_ptr<FixedBucketHistogram> fixed_histogram_;
   std::atomic<bool> used_;
   std::thread::id created_thread_id_;
   SymbolTable& symbol_table_;
@@ -83,11 +96,20 @@ class ParentHistogramImpl : public MetricImpl<ParentHistogram> {
 public:
   ParentHistogramImpl(StatName name, Histogram::Unit unit, ThreadLocalStoreImpl& parent,
                       StatName tag_extracted_name, const StatNameTagVector& stat_name_tags,
-                      ConstSupportedBuckets& supported_buckets, uint64_t id);
+                      ConstSupportedBuckets& supported_buckets, bool fixed_buckets, uint64_t id);
   ~ParentHistogramImpl() override;
 
   void addTlsHistogram(const TlsHistogramSharedPtr& hist_ptr);
 
+  /**
+   * @return the buckets the TLS histograms should record values into, or nullptr if they should
+   * use circllhist.
+   */
+  ConstSupportedBuckets* fixedBuckets() const {
+    return interval_fixed_histogram_ != nullptr ? &interval_fixed_histogram_->supportedBuckets()
+                                                : nullptr;
+  }
+
   // Stats::Histogram
   Histogram::Unit unit() const override;
   void recordValue(uint64_t value) override;
@@ -100,9 +122,24 @@ public:
    */
   void merge() override;
 
-  const HistogramStatistics& intervalStatistics() const override { return interval_statistics_; }
+  /**
+   * The first half of merge(), which may be called on any thread while the main thread is not
+   * reading this histogram's statistics. Collects the values recorded by the TLS histograms in
+   * the last interval and computes the new statistics, without publishing them yet.
+   */
+  void prepareMerge();
+
+  /**
+   * The second half of merge(), called on the main thread once prepareMerge() has completed.
+   * Publishes the statistics computed by prepareMerge().
+   */
+  void finishMerge();
+
+  const HistogramStatistics& intervalStatistics() const override {
+    return interval_statistics_[active_statistics_];
+  }
   const HistogramStatistics& cumulativeStatistics() const override {
-    return cumulative_statistics_;
+    return cumulative_statistics_[active_statistics_];
   }
   const std::string quantileSummary() const override;
   const std::string bucketSummary() const override;
@@ -125,13 +162,21 @@ private:
 
   Histogram::Unit unit_;
   ThreadLocalStoreImpl& thread_local_store_;
-  histogram_t* interval_histogram_;
-  histogram_t* cumulative_histogram_;
-  HistogramStatisticsImpl interval_statistics_;
-  HistogramStatisticsImpl cumulative_statistics_;
+  // Either the circllhist histograms or the fixed-bucket ones are allocated, depending on the
+  // histogram's settings.
+  histogram_t* interval_histogram_{};
+  histogram_t* cumulative_histogram_{};
+  std::unique_ptr<FixedBucketHistogram> interval_fixed_histogram_;
+  std::unique_ptr<FixedBucketHistogram> cumulative_fixed_histogram_;
+  // prepareMerge() refreshes the statistics at the index not in active_statistics_, so that it
+  // does not write to the statistics the main thread may be reading.
+  HistogramStatisticsImpl interval_statistics_[2];
+  HistogramStatisticsImpl cumulative_statistics_[2];
+  uint32_t active_statistics_{0};
   mutable Thread::MutexBasicLockable merge_lock_;
   std::list<TlsHistogramSharedPtr> tls_histograms_ ABSL_GUARDED_BY(merge_lock_);
   bool merged_;
+  bool merge_prepared_{false};
   std::atomic<bool> shutting_down_{false};
   std::atomic<uint32_t> ref_count_{0};
   const uint64_t id_; // Index into TlsCache::histogram_cache_.
@@ -250,6 +295,9 @@ public:
   }
   void setStatsMatcher(StatsMatcherPtr&& stats_matcher) override;
   void setHistogramSettings(HistogramSettingsConstPtr&& histogram_settings) override;
+  void setShardedCounterNames(const std::vector<std::string>& names) override {
+    alloc_.setShardedCounterNames(names);
+  }
   void initializeThreading(Event::Dispatcher& main_thread_dispatcher,
                            ThreadLocal::Instance& tls) override;
   void shutdownThreading() override;
@@ -113,7 +113,7 @@ OriginalConnPoolImpl::newConnection(ConnectionPool::Callbacks& callbacks) {
     bool can_create_connection =
         host_->cluster().resourceManager(priority_).connections().canCreate();
     if (!can_create_connection) {
-      host_->cluster().stats().upstream_cx_overflow_.inc();
+      host_->cluster().trafficStats().upstream_cx_overflow_.inc();
     }
 
     // If we have no connections at all, make one no matter what so we don't starve.
@@ -129,7 +129,7 @@ OriginalConnPoolImpl::newConnection(ConnectionPool::Callbacks& callbacks) {
   } else {
     ENVOY_LOG(debug, "max pending requests overflow");
     callbacks.onPoolFailure(ConnectionPool::PoolFailureReason::Overflow, nullptr);
-    host_->cluster().stats().upstream_rq_pending_overflow_.inc();
+    host_->cluster().trafficStats().upstream_rq_pending_overflow_.inc();
     return nullptr;
   }
 }
@@ -158,7 +158,7 @@ void OriginalConnPoolImpl::onConnectionEvent(ActiveConn& conn, Network::Connecti
       check_for_drained = false;
     } else {
       // The only time this happens is if we actually saw a connect failure.
-      host_->cluster().stats().upstream_cx_connect_fail_.inc();
+      host_->cluster().trafficStats().upstream_cx_connect_fail_.inc();
       host_->stats().cx_connect_fail_.inc();
       removed = conn.removeFromList(pending_conns_);
 
@@ -183,7 +183,7 @@ void OriginalConnPoolImpl::onConnectionEvent(ActiveConn& conn, Network::Connecti
       while (!pending_requests_to_purge.empty()) {
         PendingRequestPtr request =
             pending_requests_to_purge.front()->removeFromList(pending_requests_to_purge);
-        host_->cluster().stats().upstream_rq_pending_failure_eject_.inc();
+        host_->cluster().trafficStats().upstream_rq_pending_failure_eject_.inc();
         request->callbacks_.onPoolFailure(reason, conn.real_host_description_);
       }
     }
@@ -222,7 +222,7 @@ void OriginalConnPoolImpl::onPendingRequestCancel(PendingRequest& request,
                                                   ConnectionPool::CancelPolicy cancel_policy) {
   ENVOY_LOG(debug, "canceling pending request");
   request.removeFromList(pending_requests_);
-  host_->cluster().stats().upstream_rq_cancelled_.inc();
+  host_->cluster().trafficStats().upstream_rq_cancelled_.inc();
 
   // If the cancel requests closure of excess connections and there are more pending connections
   // than requests, close the most recently created pending connection.
@@ -240,7 +240,7 @@ void OriginalConnPoolImpl::onConnReleased(ActiveConn& conn) {
 
   if (conn.remaining_requests_ > 0 && --conn.remaining_requests_ == 0) {
     ENVOY_CONN_LOG(debug, "maximum requests per connection", *conn.conn_);
-    host_->cluster().stats().upstream_cx_max_requests_.inc();
+    host_->cluster().trafficStats().upstream_cx_max_requests_.inc();
 
     conn.conn_->close(Network::ConnectionCloseType::NoFlush);
   } else {
@@ -317,8 +317,8 @@ void OriginalConnPoolImpl::processIdleConnection(ActiveConn& conn, bool new_conn
 }
 
 OriginalConnPoolImpl::ConnectionWrapper::ConnectionWrapper(ActiveConn& parent) : parent_(parent) {
-  parent_.parent_.host_->cluster().stats().upstream_rq_total_.inc();
-  parent_.parent_.host_->cluster().stats().upstream_rq_active_.inc();
+  parent_.parent_.host_->cluster().trafficStats().upstream_rq_total_.inc();
+  parent_.parent_.host_->cluster().trafficStats().upstream_rq_active_.inc();
   parent_.parent_.host_->stats().rq_total_.inc();
   parent_.parent_.host_->stats().rq_active_.inc();
 }
@@ -344,7 +344,7 @@ void OriginalConnPoolImpl::ConnectionWrapper::release(bool closed) {
       parent_.parent_.onConnReleased(parent_);
     }
 
-    parent_.parent_.host_->cluster().stats().upstream_rq_active_.dec();
+    parent_.parent_.host_->cluster().trafficStats().upstream_rq_active_.dec();
     parent_.parent_.host_->stats().rq_active_.dec();
   }
 }
@@ -352,13 +352,13 @@ void OriginalConnPoolImpl::ConnectionWrapper::release(bool closed) {
 OriginalConnPoolImpl::PendingRequest::PendingRequest(OriginalConnPoolImpl& parent,
                                                      ConnectionPool::Callbacks& callbacks)
     : parent_(parent), callbacks_(callbacks) {
-  parent_.host_->cluster().stats().upstream_rq_pending_total_.inc();
-  parent_.host_->cluster().stats().upstream_rq_pending_active_.inc();
+  parent_.host_->cluster().trafficStats().upstream_rq_pending_total_.inc();
+  parent_.host_->cluster().trafficStats().upstream_rq_pending_active_.inc();
   parent_.host_->cluster().resourceManager(parent_.priority_).pendingRequests().inc();
 }
 
 OriginalConnPoolImpl::PendingRequest::~PendingRequest() {
-  parent_.host_->cluster().stats().upstream_rq_pending_active_.dec();
+  parent_.host_->cluster().trafficStats().upstream_rq_pending_active_.dec();
   parent_.host_->cluster().resourceManager(parent_.priority_).pendingRequests().dec();
 }
 
@@ -368,7 +368,8 @@ OriginalConnPoolImpl::ActiveConn::ActiveConn(OriginalConnPoolImpl& parent)
       remaining_requests_(parent_.host_->cluster().maxRequestsPerConnection()), timed_out_(false) {
 
   parent_.conn_connect_ms_ = std::make_unique<Stats::HistogramCompletableTimespanImpl>(
-      parent_.host_->cluster().stats().upstream_cx_connect_ms_, parent_.dispatcher_.timeSource());
+      parent_.host_->cluster().trafficStats().upstream_cx_connect_ms_,
+      parent_.dispatcher_.timeSource());
 
   Upstream::Host::CreateConnectionData data = parent_.host_->createConnection(
       parent_.dispatcher_, parent_.socket_options_, parent_.transport_socket_options_);
@@ -383,20 +384,21 @@ OriginalConnPoolImpl::ActiveConn::ActiveConn(OriginalConnPoolImpl& parent)
   ENVOY_CONN_LOG(debug, "connecting", *conn_);
   conn_->connect();
 
-  parent_.host_->cluster().stats().upstream_cx_total_.inc();
-  parent_.host_->cluster().stats().upstream_cx_active_.inc();
+  parent_.host_->cluster().trafficStats().upstream_cx_total_.inc();
+  parent_.host_->cluster().trafficStats().upstream_cx_active_.inc();
   parent_.host_->stats().cx_total_.inc();
   parent_.host_->stats().cx_active_.inc();
   conn_length_ = std::make_unique<Stats::HistogramCompletableTimespanImpl>(
-      parent_.host_->cluster().stats().upstream_cx_length_ms_, parent_.dispatcher_.timeSource());
+      parent_.host_->cluster().trafficStats().upstream_cx_length_ms_,
+      parent_.dispatcher_.timeSource());
   connect_timer_->enableTimer(parent_.host_->cluster().connectTimeout());
   parent_.host_->cluster().resourceManager(parent_.priority_).connections().inc();
 
-  conn_->setConnectionStats({parent_.host_->cluster().stats().upstream_cx_rx_bytes_total_,
-                             parent_.host_->cluster().stats().upstream_cx_rx_bytes_buffered_,
-                             parent_.host_->cluster().stats().upstream_cx_tx_bytes_total_,
-                             parent_.host_->cluster().stats().upstream_cx_tx_bytes_buffered_,
-                             &parent_.host_->cluster().stats().bind_errors_, nullptr});
+  conn_->setConnectionStats({parent_.host_->cluster().trafficStats().upstream_cx_rx_bytes_total_,
+                             parent_.host_->cluster().trafficStats().upstream_cx_rx_bytes_buffered_,
+                             parent_.host_->cluster().trafficStats().upstream_cx_tx_bytes_total_,
+                             parent_.host_->cluster().trafficStats().upstream_cx_tx_bytes_buffered_,
+                             &parent_.host_->cluster().trafficStats().bind_errors_, nullptr});
 
   // We just universally set no delay on connections. Theoretically we might at some point want
   // to make this configurable.
@@ -408,7 +410,7 @@ OriginalConnPoolImpl::ActiveConn::~ActiveConn() {
     wrapper_->invalidate();
   }
 
-  parent_.host_->cluster().stats().upstream_cx_active_.dec();
+  parent_.host_->cluster().trafficStats().upstream_cx_active_.dec();
   parent_.host_->stats().cx_active_.dec();
   conn_length_->complete();
   parent_.host_->cluster().resourceManager(parent_.priority_).connections().dec();
@@ -421,7 +423,7 @@ void OriginalConnPoolImpl::ActiveConn::onConnectTimeout() {
   // failure and will fold into all the normal connect failure logic.
   ENVOY_CONN_LOG(debug, "connect timeout", *conn_);
   timed_out_ = true;
-  parent_.host_->cluster().stats().upstream_cx_connect_timeout_.inc();
+  parent_.host_->cluster().trafficStats().upstream_cx_connect_timeout_.inc();
   conn_->close(Network::ConnectionCloseType::NoFlush);
 }
 
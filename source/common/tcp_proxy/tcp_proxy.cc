@@ -26,6 +26,7 @@
 #include "common/network/transport_socket_options_impl.h"
 #include "common/network/upstream_server_name.h"
 #include "common/router/metadatamatchcriteria_impl.h"
+#include "common/runtime/runtime_features.h"
 
 namespace Envoy {
 namespace TcpProxy {
@@ -216,7 +217,9 @@ UpstreamDrainManager& Config::drainManager() {
 
 Filter::Filter(ConfigSharedPtr config, Upstream::ClusterManager& cluster_manager)
     : config_(config), cluster_manager_(cluster_manager), downstream_callbacks_(*this),
-      upstream_callbacks_(new UpstreamCallbacks(this)) {
+      upstream_callbacks_(new UpstreamCallbacks(this)),
+      lazy_idle_timer_(
+          Runtime::runtimeFeatureEnabled("envoy.reloadable_features.tcp_proxy_lazy_idle_timer")) {
   ASSERT(config != nullptr);
 }
 
@@ -270,12 +273,12 @@ void Filter::readDisableUpstream(bool disable) {
   if (disable) {
     read_callbacks_->upstreamHost()
         ->cluster()
-        .stats()
+        .trafficStats()
         .upstream_flow_control_paused_reading_total_.inc();
   } else {
     read_callbacks_->upstreamHost()
         ->cluster()
-        .stats()
+        .trafficStats()
         .upstream_flow_control_resumed_reading_total_.inc();
   }
 }
@@ -401,7 +404,7 @@ Network::FilterStatus Filter::initializeUpstreamConnection() {
   // will never be released.
   if (!cluster->resourceManager(Upstream::ResourcePriority::Default).connections().canCreate()) {
     getStreamInfo().setResponseFlag(StreamInfo::ResponseFlag::UpstreamOverflow);
-    cluster->stats().upstream_cx_overflow_.inc();
+    cluster->trafficStats().upstream_cx_overflow_.inc();
     onInitFailure(UpstreamFailureReason::ResourceLimitExceeded);
     return Network::FilterStatus::StopIteration;
   }
@@ -409,7 +412,7 @@ Network::FilterStatus Filter::initializeUpstreamConnection() {
   const uint32_t max_connect_attempts = config_->maxConnectAttempts();
   if (connect_attempts_ >= max_connect_attempts) {
     getStreamInfo().setResponseFlag(StreamInfo::ResponseFlag::UpstreamRetryLimitExceeded);
-    cluster->stats().upstream_cx_connect_attempts_exceeded_.inc();
+    cluster->trafficStats().upstream_cx_connect_attempts_exceeded_.inc();
     onInitFailure(UpstreamFailureReason::ConnectFailed);
     return Network::FilterStatus::StopIteration;
   }
@@ -563,7 +566,7 @@ Network::FilterStatus Filter::onData(Buffer::Instance& data, bool end_stream) {
   // Before there is an upstream the connection should be readDisabled. If the upstream is
   // destroyed, there should be no further reads as well.
   ASSERT(0 == data.length());
-  resetIdleTimer(); // TODO(ggreenway) PERF: do we need to reset timer on both send and receive?
+  resetIdleTimer();
   return Network::FilterStatus::StopIteration;
 }
 
@@ -581,6 +584,11 @@ void Filter::onDownstreamEvent(Network::ConnectionEvent event) {
     Tcp::ConnectionPool::ConnectionDataPtr conn_data(upstream_->onDownstreamEvent(event));
     if (conn_data != nullptr &&
         conn_data->connection().state() != Network::Connection::State::Closed) {
+      // The drainer restarts the idle timer on its own activity only, so hand the timer over
+      // armed for the time remaining since the last activity seen here.
+      if (idle_timer_ != nullptr && lazy_idle_timer_) {
+        rearmIdleTimer();
+      }
       config_->drainManager().add(config_->sharedConfig(), std::move(conn_data),
                                   std::move(upstream_callbacks_), std::move(idle_timer_),
                                   read_callbacks_->upstreamHost());
@@ -604,7 +612,7 @@ void Filter::onUpstreamData(Buffer::Instance& data, bool end_stream) {
                  read_callbacks_->connection(), data.length(), end_stream);
   read_callbacks_->connection().write(data, end_stream);
   ASSERT(0 == data.length());
-  resetIdleTimer(); // TODO(ggreenway) PERF: do we need to reset timer on both send and receive?
+  resetIdleTimer();
 }
 
 void Filter::onUpstreamEvent(Network::ConnectionEvent event) {
@@ -654,6 +662,7 @@ void Filter::onUpstreamConnection() {
     idle_timer_ = read_callbacks_->connection().dispatcher().createTimer(
         [upstream_callbacks = upstream_callbacks_]() { upstream_callbacks->onIdleTimeout(); });
     resetIdleTimer();
+    idle_timer_->enableTimer(config_->idleTimeout().value());
     read_callbacks_->connection().addBytesSentCallback([this](uint64_t) { resetIdleTimer(); });
     if (upstream_) {
       upstream_->addBytesSentCallback([upstream_callbacks = upstream_callbacks_](uint64_t) {
@@ -664,6 +673,10 @@ void Filter::onUpstreamConnection() {
 }
 
 void Filter::onIdleTimeout() {
+  if (lazy_idle_timer_ && rearmIdleTimer()) {
+    // There was activity since the timer was armed.
+    return;
+  }
   ENVOY_CONN_LOG(debug, "Session timed out", read_callbacks_->connection());
   config_->stats().idle_timeout_.inc();
 
@@ -681,10 +694,31 @@ void Filter::onMaxDownstreamConnectionDuration() {
 void Filter::resetIdleTimer() {
   if (idle_timer_ != nullptr) {
     ASSERT(config_->idleTimeout());
-    idle_timer_->enableTimer(config_->idleTimeout().value());
+    if (!lazy_idle_timer_) {
+      idle_timer_->enableTimer(config_->idleTimeout().value());
+      return;
+    }
+    // Re-arming the timer on every read and write is measurable on busy connections, so only
+    // record the time of the activity here. See rearmIdleTimer().
+    last_activity_time_ = read_callbacks_->connection().dispatcher().approximateMonotonicTime();
   }
 }
 
+bool Filter::rearmIdleTimer() {
+  ASSERT(idle_timer_ != nullptr);
+  const std::chrono::milliseconds idle_timeout = config_->idleTimeout().value();
+  // The approximate time is only updated at the start of an event loop iteration and can be a
+  // whole idle timeout old by the time the timer fires, so read the clock here.
+  const auto idle_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+      read_callbacks_->connection().dispatcher().timeSource().monotonicTime() -
+      last_activity_time_);
+  if (idle_time >= idle_timeout) {
+    return false;
+  }
+  idle_timer_->enableTimer(idle_timeout - idle_time);
+  return true;
+}
+
 void Filter::disableIdleTimer() {
   if (idle_timer_ != nullptr) {
     idle_timer_->disableTimer();
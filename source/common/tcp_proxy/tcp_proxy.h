@@ -353,6 +353,7 @@ protected:
   void onUpstreamConnection();
   void onIdleTimeout();
   void resetIdleTimer();
+  bool rearmIdleTimer();
   void disableIdleTimer();
   void onMaxDownstreamConnectionDuration();
 
@@ -362,10 +363,16 @@ protected:
 
   DownstreamCallbacks downstream_callbacks_;
   Event::TimerPtr idle_timer_;
+  // Time of the last read or write on either connection. Activity only updates this; the idle
+  // timer is re-armed for the remaining time when it fires.
+  MonotonicTime last_activity_time_;
   Event::TimerPtr connection_duration_timer_;
 
   std::shared_ptr<UpstreamCallbacks> upstream_callbacks_; // shared_ptr required for passing as a
                                                           // read filter.
+  // Latched value of envoy.reloadable_features.tcp_proxy_lazy_idle_timer. When false, every read
+  // and write re-arms the idle timer.
+  const bool lazy_idle_timer_;
   // The upstream handle (either TCP or HTTP). This is set in onGenericPoolReady and should persist
   // until either the upstream or downstream connection is terminated.
   std::unique_ptr<GenericUpstream> upstream_;
@@ -248,7 +248,9 @@ ClusterManagerImpl::ClusterManagerImpl(
       time_source_(main_thread_dispatcher.timeSource()), dispatcher_(main_thread_dispatcher),
       http_context_(http_context),
       subscription_factory_(local_info, main_thread_dispatcher, *this,
-                            validation_context.dynamicValidationVisitor(), api, runtime_) {
+                            validation_context.dynamicValidationVisitor(), api, runtime_),
+      lazy_thread_local_clusters_(Runtime::runtimeFeatureEnabled(
+          "envoy.reloadable_features.lazy_thread_local_clusters")) {
   async_client_manager_ = std::make_unique<Grpc::AsyncClientManagerImpl>(
       *this, tls, time_source_, api, grpc_context.statNames());
   const auto& cm_config = bootstrap.cluster_manager();
@@ -650,22 +652,8 @@ void ClusterManagerImpl::createOrUpdateThreadLocalCluster(ClusterData& cluster)
                          thread_aware_lb_factory = cluster.loadBalancerFactory()](
                             ThreadLocal::ThreadLocalObjectSharedPtr object)
                             -> ThreadLocal::ThreadLocalObjectSharedPtr {
-    ThreadLocalClusterManagerImpl& cluster_manager =
-        object->asType<ThreadLocalClusterManagerImpl>();
-
-    if (cluster_manager.thread_local_clusters_.count(new_cluster->name()) > 0) {
-      ENVOY_LOG(debug, "updating TLS cluster {}", new_cluster->name());
-    } else {
-      ENVOY_LOG(debug, "adding TLS cluster {}", new_cluster->name());
-    }
-
-    auto thread_local_cluster = new ThreadLocalClusterManagerImpl::ClusterEntry(
-        cluster_manager, new_cluster, thread_aware_lb_factory);
-    cluster_manager.thread_local_clusters_[new_cluster->name()].reset(thread_local_cluster);
-    for (auto& cb : cluster_manager.update_callbacks_) {
-      cb->onClusterAddOrUpdate(*thread_local_cluster);
-    }
-
+    object->asType<ThreadLocalClusterManagerImpl>().addOrUpdateCluster(new_cluster,
+                                                                       thread_aware_lb_factory);
     return object;
   });
 }
@@ -682,15 +670,7 @@ bool ClusterManagerImpl::removeCluster(const std::string& cluster_name) {
     ENVOY_LOG(info, "removing cluster {}", cluster_name);
     tls_->runOnAllThreads([cluster_name](ThreadLocal::ThreadLocalObjectSharedPtr object)
                               -> ThreadLocal::ThreadLocalObjectSharedPtr {
-      ThreadLocalClusterManagerImpl& cluster_manager =
-          object->asType<ThreadLocalClusterManagerImpl>();
-
-      ASSERT(cluster_manager.thread_local_clusters_.count(cluster_name) == 1);
-      ENVOY_LOG(debug, "removing TLS cluster {}", cluster_name);
-      for (auto& cb : cluster_manager.update_callbacks_) {
-        cb->onClusterRemoval(cluster_name);
-      }
-      cluster_manager.thread_local_clusters_.erase(cluster_name);
+      object->asType<ThreadLocalClusterManagerImpl>().removeCluster(cluster_name);
       return object;
     });
   }
@@ -819,18 +799,11 @@ void ClusterManagerImpl::updateClusterCounts() {
 }
 
 ThreadLocalCluster* ClusterManagerImpl::get(absl::string_view cluster) {
-  auto& cluster_manager = tls_->getTyped<ThreadLocalClusterManagerImpl>();
-
-  auto entry = cluster_manager.thread_local_clusters_.find(cluster);
-  if (entry != cluster_manager.thread_local_clusters_.end()) {
-    return entry->second.get();
-  } else {
-    return nullptr;
-  }
+  return tls_->getTyped<ThreadLocalClusterManagerImpl>().getOrCreateCluster(cluster);
 }
 
 void ClusterManagerImpl::maybePrefetch(
-    ThreadLocalClusterManagerImpl::ClusterEntryPtr& cluster_entry,
+    ThreadLocalClusterManagerImpl::ClusterEntry& cluster_entry,
     std::function<ConnectionPool::Instance*()> pick_prefetch_pool) {
   // TODO(alyssawilk) As currently implemented, this will always just prefetch
   // one connection ahead of actually needed connections.
@@ -846,10 +819,10 @@ void ClusterManagerImpl::maybePrefetch(
   //  per-upstream prefetch.
   //
   //  Once we do this, this should loop capped number of times while shouldPrefetch is true.
-  if (cluster_entry->cluster_info_->peekaheadRatio() > 1.0) {
+  if (cluster_entry.cluster_info_->peekaheadRatio() > 1.0) {
     ConnectionPool::Instance* prefetch_pool = pick_prefetch_pool();
     if (prefetch_pool) {
-      prefetch_pool->maybePrefetch(cluster_entry->cluster_info_->peekaheadRatio());
+      prefetch_pool->maybePrefetch(cluster_entry.cluster_info_->peekaheadRatio());
     }
   }
 }
@@ -860,13 +833,13 @@ ClusterManagerImpl::httpConnPoolForCluster(const std::string& cluster, ResourceP
                                            LoadBalancerContext* context) {
   ThreadLocalClusterManagerImpl& cluster_manager = tls_->getTyped<ThreadLocalClusterManagerImpl>();
 
-  auto entry = cluster_manager.thread_local_clusters_.find(cluster);
-  if (entry == cluster_manager.thread_local_clusters_.end()) {
+  auto entry = cluster_manager.getOrCreateCluster(cluster);
+  if (entry == nullptr) {
     return nullptr;
   }
 
   // Select a host and create a connection pool for it if it does not already exist.
-  auto ret = entry->second->connPool(priority, protocol, context, false);
+  auto ret = entry->connPool(priority, protocol, context, false);
 
   // Now see if another host should be prefetched.
   // httpConnPoolForCluster is called immediately before a call for newStream. newStream doesn't
@@ -874,8 +847,8 @@ ClusterManagerImpl::httpConnPoolForCluster(const std::string& cluster, ResourceP
   // performed here in anticipation of the new stream.
   // TODO(alyssawilk) refactor to have one function call and return a pair, so this invariant is
   // code-enforced.
-  maybePrefetch(entry->second, [&entry, &priority, &protocol, &context]() {
-    return entry->second->connPool(priority, protocol, context, true);
+  maybePrefetch(*entry, [&entry, &priority, &protocol, &context]() {
+    return entry->connPool(priority, protocol, context, true);
   });
 
   return ret;
@@ -886,13 +859,13 @@ ClusterManagerImpl::tcpConnPoolForCluster(const std::string& cluster, ResourcePr
                                           LoadBalancerContext* context) {
   ThreadLocalClusterManagerImpl& cluster_manager = tls_->getTyped<ThreadLocalClusterManagerImpl>();
 
-  auto entry = cluster_manager.thread_local_clusters_.find(cluster);
-  if (entry == cluster_manager.thread_local_clusters_.end()) {
+  auto entry = cluster_manager.getOrCreateCluster(cluster);
+  if (entry == nullptr) {
     return nullptr;
   }
 
   // Select a host and create a connection pool for it if it does not already exist.
-  auto ret = entry->second->tcpConnPool(priority, context, false);
+  auto ret = entry->tcpConnPool(priority, context, false);
 
   // tcpConnPoolForCluster is called immediately before a call for newConnection. newConnection
   // doesn't have the load balancer context needed to make selection decisions so prefetching must
@@ -900,8 +873,8 @@ ClusterManagerImpl::tcpConnPoolForCluster(const std::string& cluster, ResourcePr
   // TODO(alyssawilk) refactor to have one function call and return a pair, so this invariant is
   // code-enforced.
   // Now see if another host should be prefetched.
-  maybePrefetch(entry->second, [&entry, &priority, &context]() {
-    return entry->second->tcpConnPool(priority, context, true);
+  maybePrefetch(*entry, [&entry, &priority, &context]() {
+    return entry->tcpConnPool(priority, context, true);
   });
 
   return ret;
@@ -947,17 +920,17 @@ Host::CreateConnectionData ClusterManagerImpl::tcpConnForCluster(const std::stri
                                                                  LoadBalancerContext* context) {
   ThreadLocalClusterManagerImpl& cluster_manager = tls_->getTyped<ThreadLocalClusterManagerImpl>();
 
-  auto entry = cluster_manager.thread_local_clusters_.find(cluster);
-  if (entry == cluster_manager.thread_local_clusters_.end()) {
+  auto entry = cluster_manager.getOrCreateCluster(cluster);
+  if (entry == nullptr) {
     throw EnvoyException(fmt::format("unknown cluster '{}'", cluster));
   }
 
-  HostConstSharedPtr logical_host = entry->second->lb_->chooseHost(context);
+  HostConstSharedPtr logical_host = entry->lb_->chooseHost(context);
   if (logical_host) {
     auto conn_info = logical_host->createConnection(
         cluster_manager.thread_local_dispatcher_, nullptr,
         context == nullptr ? nullptr : context->upstreamTransportSocketOptions());
-    if ((entry->second->cluster_info_->features() &
+    if ((entry->cluster_info_->features() &
          ClusterInfo::Features::CLOSE_CONNECTIONS_ON_HOST_HEALTH_FAILURE) &&
         conn_info.connection_ != nullptr) {
       auto& conn_map = cluster_manager.host_tcp_conn_map_[logical_host];
@@ -967,16 +940,16 @@ Host::CreateConnectionData ClusterManagerImpl::tcpConnForCluster(const std::stri
     }
     return conn_info;
   } else {
-    entry->second->cluster_info_->stats().upstream_cx_none_healthy_.inc();
+    entry->cluster_info_->stats().upstream_cx_none_healthy_.inc();
     return {nullptr, nullptr};
   }
 }
 
 Http::AsyncClient& ClusterManagerImpl::httpAsyncClientForCluster(const std::string& cluster) {
   ThreadLocalClusterManagerImpl& cluster_manager = tls_->getTyped<ThreadLocalClusterManagerImpl>();
-  auto entry = cluster_manager.thread_local_clusters_.find(cluster);
-  if (entry != cluster_manager.thread_local_clusters_.end()) {
-    return entry->second->http_async_client_;
+  auto entry = cluster_manager.getOrCreateCluster(cluster);
+  if (entry != nullptr) {
+    return entry->http_async_client_;
   } else {
     throw EnvoyException(fmt::format("unknown cluster '{}'", cluster));
   }
@@ -1043,6 +1016,11 @@ ClusterManagerImpl::ThreadLocalClusterManagerImpl::ThreadLocalClusterManagerImpl
 
     ENVOY_LOG(debug, "adding TLS initial cluster {}", cluster.first);
     ASSERT(thread_local_clusters_.count(cluster.first) == 0);
+    if (parent.lazy_thread_local_clusters_) {
+      pending_clusters_[cluster.first] = PendingCluster{
+          cluster.second->cluster_->info(), cluster.second->loadBalancerFactory(), {}};
+      continue;
+    }
     thread_local_clusters_[cluster.first] = std::make_unique<ClusterEntry>(
         *this, cluster.second->cluster_->info(), cluster.second->loadBalancerFactory());
   }
@@ -1178,8 +1156,13 @@ void ClusterManagerImpl::ThreadLocalClusterManagerImpl::removeTcpConn(
 
 void ClusterManagerImpl::ThreadLocalClusterManagerImpl::removeHosts(
     const std::string& name, const HostVector& hosts_removed) {
-  ASSERT(thread_local_clusters_.find(name) != thread_local_clusters_.end());
-  const auto& cluster_entry = thread_local_clusters_[name];
+  auto entry = thread_local_clusters_.find(name);
+  if (entry == thread_local_clusters_.end()) {
+    // A cluster that has not been used on this thread has no connection pools.
+    ASSERT(pending_clusters_.contains(name));
+    return;
+  }
+  ClusterEntry* cluster_entry = entry->second.get();
   ENVOY_LOG(debug, "removing hosts for TLS cluster {} removed {}", name, hosts_removed.size());
 
   // We need to go through and purge any connection pools for hosts that got deleted.
@@ -1192,8 +1175,18 @@ void ClusterManagerImpl::ThreadLocalClusterManagerImpl::updateClusterMembership(
     const std::string& name, uint32_t priority, PrioritySet::UpdateHostsParams update_hosts_params,
     LocalityWeightsConstSharedPtr locality_weights, const HostVector& hosts_added,
     const HostVector& hosts_removed, uint64_t overprovisioning_factor) {
-  ASSERT(thread_local_clusters_.find(name) != thread_local_clusters_.end());
-  const auto& cluster_entry = thread_local_clusters_[name];
+  auto entry = thread_local_clusters_.find(name);
+  if (entry == thread_local_clusters_.end()) {
+    // Keep the latest host set until the cluster is used on this thread.
+    auto pending = pending_clusters_.find(name);
+    ASSERT(pending != pending_clusters_.end());
+    pending->second.host_sets_[priority] = PendingCluster::HostSetUpdate{
+        std::move(update_hosts_params), std::move(locality_weights), overprovisioning_factor};
+    return;
+  }
+  // Not a reference into the map: host set callbacks and LB creation may look up other clusters,
+  // which can create their entries on first use and rehash thread_local_clusters_.
+  ClusterEntry* cluster_entry = entry->second.get();
   ENVOY_LOG(debug, "membership update for TLS cluster {} added {} removed {}", name,
             hosts_added.size(), hosts_removed.size());
   cluster_entry->priority_set_.updateHosts(priority, std::move(update_hosts_params),
@@ -1267,6 +1260,72 @@ void ClusterManagerImpl::ThreadLocalClusterManagerImpl::onHostHealthFailure(
   }
 }
 
+void ClusterManagerImpl::ThreadLocalClusterManagerImpl::addOrUpdateCluster(
+    const ClusterInfoConstSharedPtr& cluster_info, const LoadBalancerFactorySharedPtr& lb_factory) {
+  const std::string& name = cluster_info->name();
+  const bool in_use = thread_local_clusters_.contains(name);
+  // Update callbacks are handed the ThreadLocalCluster, so clusters are still created right away
+  // while any callbacks are registered on this thread.
+  if (parent_.lazy_thread_local_clusters_ && !in_use && update_callbacks_.empty()) {
+    ENVOY_LOG(debug, "saving TLS cluster {} until first use", name);
+    pending_clusters_[name] = PendingCluster{cluster_info, lb_factory, {}};
+    return;
+  }
+
+  if (in_use || pending_clusters_.erase(name) > 0) {
+    ENVOY_LOG(debug, "updating TLS cluster {}", name);
+  } else {
+    ENVOY_LOG(debug, "adding TLS cluster {}", name);
+  }
+
+  auto thread_local_cluster = new ClusterEntry(*this, cluster_info, lb_factory);
+  thread_local_clusters_[name].reset(thread_local_cluster);
+  for (auto& cb : update_callbacks_) {
+    cb->onClusterAddOrUpdate(*thread_local_cluster);
+  }
+}
+
+void ClusterManagerImpl::ThreadLocalClusterManagerImpl::removeCluster(const std::string& name) {
+  ASSERT(thread_local_clusters_.count(name) + pending_clusters_.count(name) == 1);
+  ENVOY_LOG(debug, "removing TLS cluster {}", name);
+  for (auto& cb : update_callbacks_) {
+    cb->onClusterRemoval(name);
+  }
+  thread_local_clusters_.erase(name);
+  pending_clusters_.erase(name);
+}
+
+ClusterManagerImpl::ThreadLocalClusterManagerImpl::ClusterEntry*
+ClusterManagerImpl::ThreadLocalClusterManagerImpl::getOrCreateCluster(absl::string_view name) {
+  auto entry = thread_local_clusters_.find(name);
+  if (entry != thread_local_clusters_.end()) {
+    return entry->second.get();
+  }
+
+  auto pending = pending_clusters_.find(name);
+  if (pending == pending_clusters_.end()) {
+    return nullptr;
+  }
+
+  ENVOY_LOG(debug, "adding TLS cluster {} on first use", name);
+  PendingCluster pending_cluster = std::move(pending->second);
+  pending_clusters_.erase(pending);
+  const std::string& cluster_name = pending_cluster.cluster_info_->name();
+  auto cluster_entry = std::make_unique<ClusterEntry>(*this, pending_cluster.cluster_info_,
+                                                      pending_cluster.lb_factory_);
+  ClusterEntry* thread_local_cluster = cluster_entry.get();
+  thread_local_clusters_[cluster_name] = std::move(cluster_entry);
+  // Replay the latest host sets as if they had all been added at once.
+  for (auto& host_set : pending_cluster.host_sets_) {
+    const HostVector& hosts = *host_set.second.update_hosts_params_.hosts;
+    updateClusterMembership(cluster_name, host_set.first,
+                            std::move(host_set.second.update_hosts_params_),
+                            std::move(host_set.second.locality_weights_), hosts, HostVector{},
+                            host_set.second.overprovisioning_factor_);
+  }
+  return thread_local_cluster;
+}
+
 ClusterManagerImpl::ThreadLocalClusterManagerImpl::ConnPoolsContainer*
 ClusterManagerImpl::ThreadLocalClusterManagerImpl::getHttpConnPoolsContainer(
     const HostConstSharedPtr& host, bool allocate) {
@@ -1300,7 +1359,8 @@ ClusterManagerImpl::ThreadLocalClusterManagerImpl::ClusterEntry::ClusterEntry(
         cluster->lbType(), priority_set_, parent_.local_priority_set_, cluster->stats(),
         cluster->statsScope(), parent.parent_.runtime_, parent.parent_.random_,
         cluster->lbSubsetInfo(), cluster->lbRingHashConfig(), cluster->lbMaglevConfig(),
-        cluster->lbLeastRequestConfig(), cluster->lbConfig());
+        cluster->lbLeastRequestConfig(), cluster->lbConfig(),
+        parent.thread_local_dispatcher_.timeSource());
   } else {
     switch (cluster->lbType()) {
     case LoadBalancerType::LeastRequest: {
@@ -1310,6 +1370,16 @@ ClusterManagerImpl::ThreadLocalClusterManagerImpl::ClusterEntry::ClusterEntry(
           parent.parent_.random_, cluster->lbConfig(), cluster->lbLeastRequestConfig());
       break;
     }
+    case LoadBalancerType::PeakEwma: {
+      ASSERT(lb_factory_ == nullptr);
+      auto peak_ewma_lb = std::make_unique<PeakEwmaLoadBalancer>(
+          priority_set_, parent_.local_priority_set_, cluster->stats(), parent.parent_.runtime_,
+          parent.parent_.random_, cluster->lbConfig(), cluster->lbPeakEwmaConfig(),
+          parent.thread_local_dispatcher_.timeSource());
+      peak_ewma_lb_ = peak_ewma_lb.get();
+      lb_ = std::move(peak_ewma_lb);
+      break;
+    }
     case LoadBalancerType::Random: {
       ASSERT(lb_factory_ == nullptr);
       lb_ = std::make_unique<RandomLoadBalancer>(priority_set_, parent_.local_priority_set_,
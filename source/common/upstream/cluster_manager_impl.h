@@ -29,6 +29,7 @@
 #include "common/config/subscription_factory_impl.h"
 #include "common/http/async_client_impl.h"
 #include "common/upstream/load_stats_reporter.h"
+#include "common/upstream/peak_ewma_lb.h"
 #include "common/upstream/priority_conn_pool_map.h"
 #include "common/upstream/upstream_impl.h"
 
@@ -346,6 +347,12 @@ private:
       const PrioritySet& prioritySet() override { return priority_set_; }
       ClusterInfoConstSharedPtr info() override { return cluster_info_; }
       LoadBalancer& loadBalancer() override { return *lb_; }
+      void putResponseTime(const HostDescription& host,
+                           std::chrono::microseconds response_time) override {
+        if (peak_ewma_lb_ != nullptr) {
+          peak_ewma_lb_->putResponseTime(host, response_time);
+        }
+      }
 
       ThreadLocalClusterManagerImpl& parent_;
       PrioritySetImpl priority_set_;
@@ -355,12 +362,30 @@ private:
       LoadBalancerFactorySharedPtr lb_factory_;
       // Current active LB.
       LoadBalancerPtr lb_;
+      // Set if lb_ is a peak EWMA LB, which is fed the response times of the cluster.
+      PeakEwmaLoadBalancer* peak_ewma_lb_{};
       ClusterInfoConstSharedPtr cluster_info_;
       Http::AsyncClientImpl http_async_client_;
     };
 
     using ClusterEntryPtr = std::unique_ptr<ClusterEntry>;
 
+    // What is needed to create the ClusterEntry of a cluster that has not been used on this thread
+    // yet, when thread local clusters are created on first use. Only the latest host set of each
+    // priority is kept, as a new ClusterEntry starts from empty host sets anyway.
+    struct PendingCluster {
+      struct HostSetUpdate {
+        PrioritySet::UpdateHostsParams update_hosts_params_;
+        LocalityWeightsConstSharedPtr locality_weights_;
+        uint64_t overprovisioning_factor_;
+      };
+
+      ClusterInfoConstSharedPtr cluster_info_;
+      LoadBalancerFactorySharedPtr lb_factory_;
+      // Ordered so that lower priorities are replayed first.
+      std::map<uint32_t, HostSetUpdate> host_sets_;
+    };
+
     ThreadLocalClusterManagerImpl(ClusterManagerImpl& parent, Event::Dispatcher& dispatcher,
                                   const absl::optional<std::string>& local_cluster_name);
     ~ThreadLocalClusterManagerImpl() override;
@@ -376,6 +401,12 @@ private:
                                  const HostVector& hosts_added, const HostVector& hosts_removed,
                                  uint64_t overprovisioning_factor);
     void onHostHealthFailure(const HostSharedPtr& host);
+    void addOrUpdateCluster(const ClusterInfoConstSharedPtr& cluster_info,
+                            const LoadBalancerFactorySharedPtr& lb_factory);
+    void removeCluster(const std::string& name);
+    // Returns the entry of the cluster, creating it first if the cluster has not been used on this
+    // thread yet. Returns nullptr for unknown clusters.
+    ClusterEntry* getOrCreateCluster(absl::string_view name);
 
     ConnPoolsContainer* getHttpConnPoolsContainer(const HostConstSharedPtr& host,
                                                   bool allocate = false);
@@ -383,6 +414,9 @@ private:
     ClusterManagerImpl& parent_;
     Event::Dispatcher& thread_local_dispatcher_;
     absl::flat_hash_map<std::string, ClusterEntryPtr> thread_local_clusters_;
+    // Clusters that have not been used on this thread yet. Empty unless thread local clusters are
+    // created on first use. A cluster is never in both maps.
+    absl::flat_hash_map<std::string, PendingCluster> pending_clusters_;
 
     // These maps are owned by the ThreadLocalClusterManagerImpl instead of the ClusterEntry
     // to prevent lifetime/ownership issues when a cluster is dynamically removed.
@@ -483,7 +517,7 @@ private:
   void postThreadLocalHealthFailure(const HostSharedPtr& host);
   void updateClusterCounts();
   void clusterWarmingToActive(const std::string& cluster_name);
-  void maybePrefetch(ThreadLocalClusterManagerImpl::ClusterEntryPtr& cluster_entry,
+  void maybePrefetch(ThreadLocalClusterManagerImpl::ClusterEntry& cluster_entry,
                      std::function<ConnectionPool::Instance*()> prefetch_pool);
 
   ClusterManagerFactory& factory_;
@@ -517,6 +551,9 @@ private:
   Http::Context& http_context_;
   Config::SubscriptionFactoryImpl subscription_factory_;
   ClusterSet primary_clusters_;
+  // Whether workers create the thread local state of a cluster on first use, instead of for every
+  // cluster on every CDS update. Latched at startup.
+  const bool lazy_thread_local_clusters_;
 };
 
 } // namespace Upstream
@@ -620,7 +620,10 @@ public:
         default_subset_(subset_config.default_subset()),
         locality_weight_aware_(subset_config.locality_weight_aware()),
         scale_locality_weight_(subset_config.scale_locality_weight()),
-        panic_mode_any_(subset_config.panic_mode_any()), list_as_any_(subset_config.list_as_any()) {
+        panic_mode_any_(subset_config.panic_mode_any()), list_as_any_(subset_config.list_as_any()),
+        lazy_subsets_(subset_config.lazy_subsets()),
+        lazy_subset_idle_timeout_(PROTOBUF_GET_MS_OR_DEFAULT(
+            subset_config, lazy_subset_idle_timeout, DefaultLazySubsetIdleTimeout.count())) {
     for (const auto& subset : subset_config.subset_selectors()) {
       if (!subset.keys().empty()) {
         subset_selectors_.emplace_back(std::make_shared<SubsetSelectorImpl>(
@@ -644,6 +647,12 @@ public:
   bool scaleLocalityWeight() const override { return scale_locality_weight_; }
   bool panicModeAny() const override { return panic_mode_any_; }
   bool listAsAny() const override { return list_as_any_; }
+  bool lazySubsets() const override { return lazy_subsets_; }
+  std::chrono::milliseconds lazySubsetIdleTimeout() const override {
+    return lazy_subset_idle_timeout_;
+  }
+
+  static constexpr std::chrono::milliseconds DefaultLazySubsetIdleTimeout{300000};
 
 private:
   const bool enabled_;
@@ -655,6 +664,8 @@ private:
   const bool scale_locality_weight_;
   const bool panic_mode_any_;
   const bool list_as_any_;
+  const bool lazy_subsets_;
+  const std::chrono::milliseconds lazy_subset_idle_timeout_;
 };
 
 } // namespace Upstream
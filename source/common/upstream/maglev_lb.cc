@@ -1,24 +1,56 @@
 #include "common/upstream/maglev_lb.h"
 
+#include <algorithm>
+
 #include "envoy/config/cluster/v3/cluster.pb.h"
 
+#include "common/runtime/runtime_features.h"
+
+#include "absl/container/flat_hash_map.h"
+
 namespace Envoy {
 namespace Upstream {
 
 MaglevTable::MaglevTable(const NormalizedHostWeightVector& normalized_host_weights,
                          double max_normalized_weight, uint64_t table_size,
-                         bool use_hostname_for_hashing, MaglevLoadBalancerStats& stats)
+                         bool use_hostname_for_hashing, MaglevLoadBalancerStats& stats,
+                         const MaglevTable* previous_table)
     : table_size_(table_size), stats_(stats) {
   // We can't do anything sensible with no hosts.
   if (normalized_host_weights.empty()) {
     return;
   }
 
+  if (previous_table != nullptr &&
+      (previous_table->table_size_ != table_size_ || previous_table->hosts_.empty())) {
+    previous_table = nullptr;
+  }
+
+  absl::flat_hash_map<const Host*, uint32_t> previous_indices;
+  if (previous_table != nullptr) {
+    previous_indices.reserve(previous_table->hosts_.size());
+    for (uint32_t i = 0; i < previous_table->hosts_.size(); i++) {
+      previous_indices.emplace(previous_table->hosts_[i].get(), i);
+    }
+  }
+
   // Implementation of pseudocode listing 1 in the paper (see header file for more info).
   std::vector<TableBuildEntry> table_build_entries;
   table_build_entries.reserve(normalized_host_weights.size());
+  uint64_t retained_hosts = 0;
   for (const auto& host_weight : normalized_host_weights) {
     const auto& host = host_weight.first;
+    const auto previous = previous_indices.find(host.get());
+    if (previous != previous_indices.end()) {
+      // The permutation only depends on the address, so there is no need to hash it again.
+      const Permutation& permutation = previous_table->permutations_[previous->second];
+      table_build_entries.emplace_back(host, permutation.offset_, permutation.skip_,
+                                       host_weight.second);
+      table_build_entries.back().previous_index_ = previous->second;
+      retained_hosts++;
+      continue;
+    }
+
     const std::string& address =
         use_hostname_for_hashing ? host->hostname() : host->address()->asString();
     ASSERT(!address.empty());
@@ -27,12 +59,48 @@ MaglevTable::MaglevTable(const NormalizedHostWeightVector& normalized_host_weigh
                                      host_weight.second);
   }
 
-  table_.resize(table_size_);
+  bool built = false;
+  if (previous_table != nullptr && table_build_entries.size() <= table_size_) {
+    const uint64_t changed_hosts = (table_build_entries.size() - retained_hosts) +
+                                   (previous_table->hosts_.size() - retained_hosts);
+    if (changed_hosts <= MaxIncrementalChangeRatio * table_build_entries.size()) {
+      built = buildIncrementally(*previous_table, table_build_entries);
+    }
+  }
+  if (!built) {
+    buildFull(table_build_entries, max_normalized_weight);
+  }
+
+  uint64_t min_entries_per_host = table_size_;
+  uint64_t max_entries_per_host = 0;
+  hosts_.reserve(table_build_entries.size());
+  permutations_.reserve(table_build_entries.size());
+  for (auto& entry : table_build_entries) {
+    min_entries_per_host = std::min(entry.count_, min_entries_per_host);
+    max_entries_per_host = std::max(entry.count_, max_entries_per_host);
+    hosts_.push_back(std::move(entry.host_));
+    permutations_.push_back({entry.offset_, entry.skip_});
+  }
+  stats_.min_entries_per_host_.set(min_entries_per_host);
+  stats_.max_entries_per_host_.set(max_entries_per_host);
+
+  if (ENVOY_LOG_CHECK_LEVEL(trace)) {
+    for (uint64_t i = 0; i < table_.size(); i++) {
+      const HostConstSharedPtr& host = hosts_[table_[i]];
+      ENVOY_LOG(trace, "maglev: i={} host={}", i,
+                use_hostname_for_hashing ? host->hostname() : host->address()->asString());
+    }
+  }
+}
+
+void MaglevTable::buildFull(std::vector<TableBuildEntry>& table_build_entries,
+                            double max_normalized_weight) {
+  table_.assign(table_size_, UnassignedSlot);
 
   // Iterate through the table build entries as many times as it takes to fill up the table.
   uint64_t table_index = 0;
   for (uint32_t iteration = 1; table_index < table_size_; ++iteration) {
-    for (uint64_t i = 0; i < table_build_entries.size() && table_index < table_size; i++) {
+    for (uint64_t i = 0; i < table_build_entries.size() && table_index < table_size_; i++) {
       TableBuildEntry& entry = table_build_entries[i];
       // To understand how target_weight_ and weight_ are used below, consider a host with weight
       // equal to max_normalized_weight. This would be picked on every single iteration. If it had
@@ -43,34 +111,113 @@ MaglevTable::MaglevTable(const NormalizedHostWeightVector& normalized_host_weigh
       }
       entry.target_weight_ += max_normalized_weight;
       uint64_t c = permutation(entry);
-      while (table_[c] != nullptr) {
+      while (table_[c] != UnassignedSlot) {
         entry.next_++;
         c = permutation(entry);
       }
 
-      table_[c] = entry.host_;
+      table_[c] = i;
       entry.next_++;
       entry.count_++;
       table_index++;
     }
   }
+}
 
-  uint64_t min_entries_per_host = table_size_;
-  uint64_t max_entries_per_host = 0;
+bool MaglevTable::buildIncrementally(const MaglevTable& previous_table,
+                                     std::vector<TableBuildEntry>& table_build_entries) {
+  // Every host gets one slot and the rest of the table is shared out in proportion to the host
+  // weights, handing the slots left over by rounding down to the largest remainders.
+  double weight_sum = 0;
   for (const auto& entry : table_build_entries) {
-    min_entries_per_host = std::min(entry.count_, min_entries_per_host);
-    max_entries_per_host = std::max(entry.count_, max_entries_per_host);
+    weight_sum += entry.weight_;
+  }
+  if (weight_sum <= 0) {
+    return false;
   }
-  stats_.min_entries_per_host_.set(min_entries_per_host);
-  stats_.max_entries_per_host_.set(max_entries_per_host);
 
-  if (ENVOY_LOG_CHECK_LEVEL(trace)) {
-    for (uint64_t i = 0; i < table_.size(); i++) {
-      ENVOY_LOG(trace, "maglev: i={} host={}", i,
-                use_hostname_for_hashing ? table_[i]->hostname()
-                                         : table_[i]->address()->asString());
+  const uint64_t spare_slots = table_size_ - table_build_entries.size();
+  uint64_t assigned_slots = 0;
+  std::vector<std::pair<double, uint32_t>> remainders;
+  remainders.reserve(table_build_entries.size());
+  for (uint32_t i = 0; i < table_build_entries.size(); i++) {
+    TableBuildEntry& entry = table_build_entries[i];
+    const double share = spare_slots * entry.weight_ / weight_sum;
+    const uint64_t whole_slots = static_cast<uint64_t>(share);
+    entry.target_count_ = whole_slots + 1;
+    assigned_slots += whole_slots;
+    remainders.emplace_back(share - whole_slots, i);
+  }
+  // Floating point rounding could in theory make the shares overshoot.
+  if (assigned_slots > spare_slots || spare_slots - assigned_slots > remainders.size()) {
+    return false;
+  }
+  const uint64_t leftover_slots = spare_slots - assigned_slots;
+  std::partial_sort(remainders.begin(), remainders.begin() + leftover_slots, remainders.end(),
+                    [](const std::pair<double, uint32_t>& a, const std::pair<double, uint32_t>& b) {
+                      return a.first > b.first || (a.first == b.first && a.second < b.second);
+                    });
+  for (uint64_t i = 0; i < leftover_slots; i++) {
+    table_build_entries[remainders[i].second].target_count_++;
+  }
+
+  std::vector<uint32_t> new_indices(previous_table.hosts_.size(), UnassignedSlot);
+  for (uint32_t i = 0; i < table_build_entries.size(); i++) {
+    if (table_build_entries[i].previous_index_ != UnassignedSlot) {
+      new_indices[table_build_entries[i].previous_index_] = i;
+    }
+  }
+
+  // Keep every slot whose host is still present and below its share of the table.
+  table_.resize(table_size_);
+  uint64_t free_slots = 0;
+  for (uint64_t c = 0; c < table_size_; c++) {
+    const uint32_t index = new_indices[previous_table.table_[c]];
+    if (index != UnassignedSlot &&
+        table_build_entries[index].count_ < table_build_entries[index].target_count_) {
+      table_[c] = index;
+      table_build_entries[index].count_++;
+    } else {
+      table_[c] = UnassignedSlot;
+      free_slots++;
+    }
+  }
+
+  // Hand the free slots out round robin to the hosts below their share, each walking its own
+  // permutation like a full build does. The targets add up to the table size, so the hosts below
+  // their share are short of exactly the number of free slots.
+  std::vector<uint32_t> below_target;
+  for (uint32_t i = 0; i < table_build_entries.size(); i++) {
+    if (table_build_entries[i].count_ < table_build_entries[i].target_count_) {
+      below_target.push_back(i);
     }
   }
+  while (free_slots > 0) {
+    ASSERT(!below_target.empty());
+    size_t still_below_target = 0;
+    for (const uint32_t index : below_target) {
+      if (free_slots == 0) {
+        break;
+      }
+      TableBuildEntry& entry = table_build_entries[index];
+      uint64_t c = permutation(entry);
+      while (table_[c] != UnassignedSlot) {
+        entry.next_++;
+        c = permutation(entry);
+      }
+
+      table_[c] = index;
+      entry.next_++;
+      entry.count_++;
+      free_slots--;
+      if (entry.count_ < entry.target_count_) {
+        below_target[still_below_target++] = index;
+      }
+    }
+    below_target.resize(still_below_target);
+  }
+
+  return true;
 }
 
 HostConstSharedPtr MaglevTable::chooseHost(uint64_t hash, uint32_t attempt) const {
@@ -85,7 +232,7 @@ HostConstSharedPtr MaglevTable::chooseHost(uint64_t hash, uint32_t attempt) cons
     hash ^= ~0ULL - attempt + 1;
   }
 
-  return table_[hash % table_size_];
+  return hosts_[table_[hash % table_size_]];
 }
 
 uint64_t MaglevTable::permutation(const TableBuildEntry& entry) {
@@ -115,6 +262,31 @@ MaglevLoadBalancer::MaglevLoadBalancer(
   }
 }
 
+ThreadAwareLoadBalancerBase::HashingLoadBalancerSharedPtr
+MaglevLoadBalancer::createLoadBalancer(uint32_t priority,
+                                       const NormalizedHostWeightVector& normalized_host_weights,
+                                       double /* min_normalized_weight */,
+                                       double max_normalized_weight) {
+  // Sized to the current priorities, so that the tables of priorities that have since been removed
+  // are released rather than reused if the priority is added back.
+  tables_.resize(priority_set_.hostSetsPerPriority().size());
+  const MaglevTable* previous_table =
+      Runtime::runtimeFeatureEnabled("envoy.reloadable_features.maglev_incremental_table_rebuild")
+          ? tables_[priority].get()
+          : nullptr;
+  auto maglev_table =
+      std::make_shared<MaglevTable>(normalized_host_weights, max_normalized_weight, table_size_,
+                                    use_hostname_for_hashing_, stats_, previous_table);
+  tables_[priority] = maglev_table;
+
+  if (hash_balance_factor_ == 0) {
+    return maglev_table;
+  }
+
+  return std::make_shared<BoundedLoadHashingLoadBalancer>(
+      maglev_table, std::move(normalized_host_weights), hash_balance_factor_);
+}
+
 MaglevLoadBalancerStats MaglevLoadBalancer::generateStats(Stats::Scope& scope) {
   return {ALL_MAGLEV_LOAD_BALANCER_STATS(POOL_GAUGE(scope))};
 }
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <limits>
+#include <memory>
+#include <vector>
+
 #include "envoy/common/random_generator.h"
 #include "envoy/config/cluster/v3/cluster.pb.h"
 #include "envoy/stats/scope.h"
@@ -30,13 +34,20 @@ struct MaglevLoadBalancerStats {
  * https://static.googleusercontent.com/media/research.google.com/en//pubs/archive/44824.pdf
  * section 3.4. Specifically, the algorithm shown in pseudocode listing 1 is implemented with a
  * fixed table size of 65537. This is the recommended table size in section 5.3.
+ *
+ * When a previous table is supplied, the permutation of every host that is still present is reused
+ * and, if only a small fraction of the hosts changed, the table is rebuilt incrementally: slots
+ * are kept by the host they were mapped to, up to its new share of the table, and only the
+ * remaining slots are reassigned by walking the permutation of the hosts that are below their
+ * share. The resulting table depends on the history of the host set, so two Envoys that saw
+ * different sequences of updates may map the same key to different hosts.
  */
 class MaglevTable : public ThreadAwareLoadBalancerBase::HashingLoadBalancer,
                     Logger::Loggable<Logger::Id::upstream> {
 public:
   MaglevTable(const NormalizedHostWeightVector& normalized_host_weights,
               double max_normalized_weight, uint64_t table_size, bool use_hostname_for_hashing,
-              MaglevLoadBalancerStats& stats);
+              MaglevLoadBalancerStats& stats, const MaglevTable* previous_table = nullptr);
 
   // ThreadAwareLoadBalancerBase::HashingLoadBalancer
   HostConstSharedPtr chooseHost(uint64_t hash, uint32_t attempt) const override;
@@ -44,7 +55,13 @@ public:
   // Recommended table size in section 5.3 of the paper.
   static const uint64_t DefaultTableSize = 65537;
 
+  // The table is rebuilt from scratch when more than this fraction of the hosts were added or
+  // removed since the previous table was built.
+  static constexpr double MaxIncrementalChangeRatio = 0.1;
+
 private:
+  static constexpr uint32_t UnassignedSlot = std::numeric_limits<uint32_t>::max();
+
   struct TableBuildEntry {
     TableBuildEntry(const HostConstSharedPtr& host, uint64_t offset, uint64_t skip, double weight)
         : host_(host), offset_(offset), skip_(skip), weight_(weight) {}
@@ -56,12 +73,27 @@ private:
     double target_weight_{};
     uint64_t next_{};
     uint64_t count_{};
+    // Only used by incremental builds.
+    uint64_t target_count_{};
+    uint32_t previous_index_{UnassignedSlot};
   };
 
+  struct Permutation {
+    uint64_t offset_;
+    uint64_t skip_;
+  };
+
+  void buildFull(std::vector<TableBuildEntry>& table_build_entries, double max_normalized_weight);
+  bool buildIncrementally(const MaglevTable& previous_table,
+                          std::vector<TableBuildEntry>& table_build_entries);
   uint64_t permutation(const TableBuildEntry& entry);
 
   const uint64_t table_size_;
-  std::vector<HostConstSharedPtr> table_;
+  // Each slot holds an index into hosts_.
+  std::vector<uint32_t> table_;
+  std::vector<HostConstSharedPtr> hosts_;
+  // Parallel to hosts_, retained so that the next table can be built from this one.
+  std::vector<Permutation> permutations_;
   MaglevLoadBalancerStats& stats_;
 };
 
@@ -83,19 +115,8 @@ public:
 private:
   // ThreadAwareLoadBalancerBase
   HashingLoadBalancerSharedPtr
-  createLoadBalancer(const NormalizedHostWeightVector& normalized_host_weights,
-                     double /* min_normalized_weight */, double max_normalized_weight) override {
-    HashingLoadBalancerSharedPtr maglev_lb =
-        std::make_shared<MaglevTable>(normalized_host_weights, max_normalized_weight, table_size_,
-                                      use_hostname_for_hashing_, stats_);
-
-    if (hash_balance_factor_ == 0) {
-      return maglev_lb;
-    }
-
-    return std::make_shared<BoundedLoadHashingLoadBalancer>(
-        maglev_lb, std::move(normalized_host_weights), hash_balance_factor_);
-  }
+  createLoadBalancer(uint32_t priority, const NormalizedHostWeightVector& normalized_host_weights,
+                     double /* min_normalized_weight */, double max_normalized_weight) override;
 
   static MaglevLoadBalancerStats generateStats(Stats::Scope& scope);
 
@@ -104,6 +125,9 @@ private:
   const uint64_t table_size_;
   const bool use_hostname_for_hashing_;
   const uint32_t hash_balance_factor_;
+  // The most recently built table of each priority, used as the base of incremental rebuilds.
+  // Only accessed on the main thread.
+  std::vector<std::shared_ptr<const MaglevTable>> tables_;
 };
 
 } // namespace Upstream
@@ -0,0 +1,148 @@
+#include "common/upstream/peak_ewma_lb.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "envoy/config/cluster/v3/cluster.pb.h"
+
+#include "common/protobuf/utility.h"
+
+#include "absl/container/flat_hash_set.h"
+
+namespace Envoy {
+namespace Upstream {
+
+namespace {
+
+// Cost of a host that has active requests but no response time yet. It is higher than the cost of
+// any host with a response time, so such hosts only get one request at a time.
+constexpr double NoLatencyPenalty = 1e15;
+
+} // namespace
+
+PeakEwmaLoadBalancer::PeakEwmaLoadBalancer(
+    const PrioritySet& priority_set, const PrioritySet* local_priority_set, ClusterStats& stats,
+    Runtime::Loader& runtime, Random::RandomGenerator& random,
+    const envoy::config::cluster::v3::Cluster::CommonLbConfig& common_config,
+    const absl::optional<envoy::config::cluster::v3::Cluster::PeakEwmaLbConfig>& peak_ewma_config,
+    TimeSource& time_source)
+    : ZoneAwareLoadBalancerBase(priority_set, local_priority_set, stats, runtime, random,
+                                common_config),
+      choice_count_(peak_ewma_config.has_value()
+                        ? PROTOBUF_GET_WRAPPED_OR_DEFAULT(peak_ewma_config.value(), choice_count, 2)
+                        : 2),
+      decay_time_us_(1000.0 * (peak_ewma_config.has_value()
+                                   ? PROTOBUF_GET_MS_OR_DEFAULT(peak_ewma_config.value(),
+                                                                decay_time,
+                                                                DefaultDecayTime.count())
+                                   : DefaultDecayTime.count())),
+      time_source_(time_source) {
+  for (const auto& host_set : priority_set.hostSetsPerPriority()) {
+    addHosts(host_set->hosts());
+  }
+
+  priority_set.addMemberUpdateCb(
+      [this](const HostVector& hosts_added, const HostVector& hosts_removed) -> void {
+        addHosts(hosts_added);
+        removeHosts(hosts_removed);
+      });
+}
+
+void PeakEwmaLoadBalancer::addHosts(const HostVector& hosts) {
+  for (const auto& host : hosts) {
+    latencies_.try_emplace(host.get());
+  }
+}
+
+void PeakEwmaLoadBalancer::removeHosts(const HostVector& hosts) {
+  if (hosts.empty()) {
+    return;
+  }
+
+  // The member update callback runs for each priority, so a host that moves to another priority is
+  // added to one and removed from the other in either order. Only forget hosts that are in no
+  // priority any more.
+  absl::flat_hash_set<const HostDescription*> current_hosts;
+  for (const auto& host_set : priority_set_.hostSetsPerPriority()) {
+    for (const auto& host : host_set->hosts()) {
+      current_hosts.insert(host.get());
+    }
+  }
+  for (const auto& host : hosts) {
+    if (!current_hosts.contains(host.get())) {
+      latencies_.erase(host.get());
+    }
+  }
+}
+
+void PeakEwmaLoadBalancer::putResponseTime(const HostDescription& host,
+                                           std::chrono::microseconds response_time) {
+  auto it = latencies_.find(&host);
+  if (it == latencies_.end()) {
+    return;
+  }
+
+  HostLatency& latency = it->second;
+  const MonotonicTime now = time_source_.monotonicTime();
+  // A zero response time would make the cost of the host zero however many requests it has.
+  const double response_time_us = std::max<double>(response_time.count(), 1);
+  if (response_time_us > latency.average_us_) {
+    latency.average_us_ = response_time_us;
+  } else {
+    const double weight = decayWeight(latency.last_update_, now);
+    latency.average_us_ = latency.average_us_ * weight + response_time_us * (1 - weight);
+  }
+  latency.last_update_ = now;
+}
+
+double PeakEwmaLoadBalancer::decayWeight(MonotonicTime last_update, MonotonicTime now) const {
+  const double elapsed_us =
+      std::chrono::duration_cast<std::chrono::microseconds>(now - last_update).count();
+  return std::exp(-std::max(elapsed_us, 0.0) / decay_time_us_);
+}
+
+double PeakEwmaLoadBalancer::cost(const Host& host, MonotonicTime now) const {
+  const uint64_t active_requests = host.stats().rq_active_.value();
+  const auto it = latencies_.find(&host);
+  if (it == latencies_.end() || it->second.average_us_ < 0) {
+    return active_requests == 0 ? 0 : NoLatencyPenalty + active_requests;
+  }
+
+  const HostLatency& latency = it->second;
+  return latency.average_us_ * decayWeight(latency.last_update_, now) * (active_requests + 1);
+}
+
+HostConstSharedPtr PeakEwmaLoadBalancer::peekAnotherHost(LoadBalancerContext*) {
+  // Like the least request load balancer, the pick depends on the active requests at the time of
+  // the pick, so it can't be predicted.
+  return nullptr;
+}
+
+HostConstSharedPtr PeakEwmaLoadBalancer::chooseHostOnce(LoadBalancerContext* context) {
+  const absl::optional<HostsSource> hosts_source = hostSourceToUse(context, random(false));
+  if (!hosts_source) {
+    return nullptr;
+  }
+
+  const HostVector& hosts_to_use = hostSourceToHosts(*hosts_source);
+  if (hosts_to_use.empty()) {
+    return nullptr;
+  }
+
+  const MonotonicTime now = time_source_.monotonicTime();
+  HostConstSharedPtr candidate_host = nullptr;
+  double candidate_cost = 0;
+  for (uint32_t choice_idx = 0; choice_idx < choice_count_; ++choice_idx) {
+    const HostSharedPtr& sampled_host = hosts_to_use[random_.random() % hosts_to_use.size()];
+    const double sampled_cost = cost(*sampled_host, now);
+    if (candidate_host == nullptr || sampled_cost < candidate_cost) {
+      candidate_host = sampled_host;
+      candidate_cost = sampled_cost;
+    }
+  }
+
+  return candidate_host;
+}
+
+} // namespace Upstream
+} // namespace Envoy
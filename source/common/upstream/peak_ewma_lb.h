@@ -0,0 +1,78 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include "envoy/common/time.h"
+#include "envoy/config/cluster/v3/cluster.pb.h"
+
+#include "common/upstream/load_balancer_impl.h"
+
+#include "absl/container/flat_hash_map.h"
+
+namespace Envoy {
+namespace Upstream {
+
+/**
+ * Peak EWMA load balancer, as used by Finagle and Linkerd. Each host has a cost that is the
+ * exponentially weighted moving average of its response times multiplied by its active requests
+ * plus one, and the host with the lowest cost out of choice_count randomly sampled hosts is picked.
+ * The average is sensitive to peaks: a response time above the average replaces it, while lower
+ * response times only pull it down over the decay time. The average also decays towards zero
+ * while a host is not picked, so that slow hosts are retried once in a while.
+ *
+ * Hosts that have no response time yet are picked while they have no active requests, and avoided
+ * while they do, so that they are probed one request at a time. Host weights are not taken into
+ * account.
+ *
+ * The averages are kept by each load balancer, which is only used by a single worker, so that
+ * workers do not contend on them. Each worker records its response times through
+ * ThreadLocalCluster::putResponseTime().
+ */
+class PeakEwmaLoadBalancer : public ZoneAwareLoadBalancerBase {
+public:
+  PeakEwmaLoadBalancer(
+      const PrioritySet& priority_set, const PrioritySet* local_priority_set, ClusterStats& stats,
+      Runtime::Loader& runtime, Random::RandomGenerator& random,
+      const envoy::config::cluster::v3::Cluster::CommonLbConfig& common_config,
+      const absl::optional<envoy::config::cluster::v3::Cluster::PeakEwmaLbConfig>&
+          peak_ewma_config,
+      TimeSource& time_source);
+
+  /**
+   * Record the response time of a request sent to a host. Response times of hosts that are not
+   * in the priority set are ignored.
+   * @param host supplies the host that the request was sent to.
+   * @param response_time supplies the time from when the request started being sent to the host
+   *                      to the end of the response.
+   */
+  void putResponseTime(const HostDescription& host, std::chrono::microseconds response_time);
+
+  // Upstream::LoadBalancerBase
+  HostConstSharedPtr chooseHostOnce(LoadBalancerContext* context) override;
+  HostConstSharedPtr peekAnotherHost(LoadBalancerContext* context) override;
+
+  static constexpr std::chrono::milliseconds DefaultDecayTime{10000};
+
+private:
+  struct HostLatency {
+    // The moving average of the response times in microseconds, or a negative value before the
+    // first response time.
+    double average_us_{-1};
+    MonotonicTime last_update_;
+  };
+
+  double decayWeight(MonotonicTime last_update, MonotonicTime now) const;
+  double cost(const Host& host, MonotonicTime now) const;
+  void addHosts(const HostVector& hosts);
+  void removeHosts(const HostVector& hosts);
+
+  const uint32_t choice_count_;
+  const double decay_time_us_;
+  TimeSource& time_source_;
+  // Keyed by the hosts of the priority set, which are kept alive by it.
+  absl::flat_hash_map<const HostDescription*, HostLatency> latencies_;
+};
+
+} // namespace Upstream
+} // namespace Envoy
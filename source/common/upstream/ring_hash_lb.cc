@@ -1,5 +1,6 @@
 #include "common/upstream/ring_hash_lb.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <iostream>
 #include <string>
@@ -8,6 +9,7 @@
 #include "envoy/config/cluster/v3/cluster.pb.h"
 
 #include "common/common/assert.h"
+#include "common/common/utility.h"
 #include "common/upstream/load_balancer_impl.h"
 
 #include "absl/container/inlined_vector.h"
@@ -50,52 +52,26 @@ RingHashLoadBalancerStats RingHashLoadBalancer::generateStats(Stats::Scope& scop
 }
 
 HostConstSharedPtr RingHashLoadBalancer::Ring::chooseHost(uint64_t h, uint32_t attempt) const {
-  if (ring_.empty()) {
+  if (hashes_.empty()) {
     return nullptr;
   }
 
-  // Ported from https://github.com/RJ/ketama/blob/master/libketama/ketama.c (ketama_get_server)
-  // I've generally kept the variable names to make the code easier to compare.
-  // NOTE: The algorithm depends on using signed integers for lowp, midp, and highp. Do not
-  //       change them!
-  int64_t lowp = 0;
-  int64_t highp = ring_.size();
-  int64_t midp = 0;
-  while (true) {
-    midp = (lowp + highp) / 2;
-
-    if (midp == static_cast<int64_t>(ring_.size())) {
-      midp = 0;
-      break;
-    }
-
-    uint64_t midval = ring_[midp].hash_;
-    uint64_t midval1 = midp == 0 ? 0 : ring_[midp - 1].hash_;
-
-    if (h <= midval && h > midval1) {
-      break;
-    }
-
-    if (midval < h) {
-      lowp = midp + 1;
-    } else {
-      highp = midp - 1;
-    }
-
-    if (lowp > highp) {
-      midp = 0;
-      break;
-    }
+  // Pick the first entry whose hash is at least h, wrapping around to the first entry past the
+  // end of the ring. This is the entry the ketama binary search
+  // (https://github.com/RJ/ketama/blob/master/libketama/ketama.c, ketama_get_server) picks.
+  uint64_t index = std::lower_bound(hashes_.begin(), hashes_.end(), h) - hashes_.begin();
+  if (index == hashes_.size()) {
+    index = 0;
   }
 
   // If a retry host predicate is being applied, behave as if this host was not in the ring.
-  // Note that this does not guarantee a different host: e.g., attempt == ring_.size() or
+  // Note that this does not guarantee a different host: e.g., attempt == ring size or
   // when the offset causes us to select the same host at another location in the ring.
   if (attempt > 0) {
-    midp = (midp + attempt) % ring_.size();
+    index = (index + attempt) % hashes_.size();
   }
 
-  return ring_[midp].host_;
+  return hosts_[host_indices_[index]];
 }
 
 using HashFunction = envoy::config::cluster::v3::Cluster::RingHashLbConfig::HashFunction;
@@ -120,9 +96,16 @@ RingHashLoadBalancer::Ring::Ring(const NormalizedHostWeightVector& normalized_ho
       std::min(std::ceil(min_normalized_weight * min_ring_size) / min_normalized_weight,
                static_cast<double>(max_ring_size));
 
-  // Reserve memory for the entire ring up front.
+  // Reserve memory for the entire ring up front. The ring is built as (hash, host index) pairs,
+  // which are sorted together and then split into the hash and host index arrays.
   const uint64_t ring_size = std::ceil(scale);
-  ring_.reserve(ring_size);
+  struct RingEntry {
+    uint64_t hash_;
+    uint32_t host_index_;
+  };
+  std::vector<RingEntry> ring;
+  ring.reserve(ring_size);
+  hosts_.reserve(normalized_host_weights.size());
 
   // Populate the hash ring by walking through the (host, weight) pairs in
   // normalized_host_weights, and generating (scale * weight) hashes for each host. Since these
@@ -152,45 +135,52 @@ RingHashLoadBalancer::Ring::Ring(const NormalizedHostWeightVector& normalized_ho
     const std::string& address_string =
         use_hostname_for_hashing ? host->hostname() : host->address()->asString();
     ASSERT(!address_string.empty());
+    const uint32_t host_index = hosts_.size();
+    hosts_.push_back(host);
 
     hash_key_buffer.assign(address_string.begin(), address_string.end());
     hash_key_buffer.emplace_back('_');
-    auto offset_start = hash_key_buffer.end();
+    const size_t offset_start = hash_key_buffer.size();
+    hash_key_buffer.resize(offset_start + StringUtil::MIN_ITOA_OUT_LEN);
 
     // As noted above: maintain current_hashes and target_hashes as running sums across the entire
     // host set. `i` is needed only to construct the hash key, and tally min/max hashes per host.
     target_hashes += scale * entry.second;
     uint64_t i = 0;
     while (current_hashes < target_hashes) {
-      const std::string i_str = absl::StrCat("", i);
-      hash_key_buffer.insert(offset_start, i_str.begin(), i_str.end());
-
+      const uint32_t i_len = StringUtil::itoa(hash_key_buffer.data() + offset_start,
+                                              StringUtil::MIN_ITOA_OUT_LEN, i);
       absl::string_view hash_key(static_cast<char*>(hash_key_buffer.data()),
-                                 hash_key_buffer.size());
+                                 offset_start + i_len);
 
       const uint64_t hash =
           (hash_function == HashFunction::Cluster_RingHashLbConfig_HashFunction_MURMUR_HASH_2)
               ? MurmurHash::murmurHash2(hash_key, MurmurHash::STD_HASH_SEED)
               : HashUtil::xxHash64(hash_key);
 
-      ENVOY_LOG(trace, "ring hash: hash_key={} hash={}", hash_key.data(), hash);
-      ring_.push_back({hash, host});
+      ENVOY_LOG(trace, "ring hash: hash_key={} hash={}", hash_key, hash);
+      ring.push_back({hash, host_index});
       ++i;
       ++current_hashes;
-      hash_key_buffer.erase(offset_start, hash_key_buffer.end());
     }
     min_hashes_per_host = std::min(i, min_hashes_per_host);
     max_hashes_per_host = std::max(i, max_hashes_per_host);
   }
 
-  std::sort(ring_.begin(), ring_.end(), [](const RingEntry& lhs, const RingEntry& rhs) -> bool {
+  std::sort(ring.begin(), ring.end(), [](const RingEntry& lhs, const RingEntry& rhs) -> bool {
     return lhs.hash_ < rhs.hash_;
   });
+  hashes_.reserve(ring.size());
+  host_indices_.reserve(ring.size());
+  for (const auto& entry : ring) {
+    hashes_.push_back(entry.hash_);
+    host_indices_.push_back(entry.host_index_);
+  }
   if (ENVOY_LOG_CHECK_LEVEL(trace)) {
-    for (const auto& entry : ring_) {
+    for (const auto& entry : ring) {
+      const auto& host = hosts_[entry.host_index_];
       ENVOY_LOG(trace, "ring hash: host={} hash={}",
-                use_hostname_for_hashing ? entry.host_->hostname()
-                                         : entry.host_->address()->asString(),
+                use_hostname_for_hashing ? host->hostname() : host->address()->asString(),
                 entry.hash_);
     }
   }
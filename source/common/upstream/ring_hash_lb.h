@@ -51,11 +51,6 @@ public:
 private:
   using HashFunction = envoy::config::cluster::v3::Cluster::RingHashLbConfig::HashFunction;
 
-  struct RingEntry {
-    uint64_t hash_;
-    HostConstSharedPtr host_;
-  };
-
   struct Ring : public HashingLoadBalancer {
     Ring(const NormalizedHostWeightVector& normalized_host_weights, double min_normalized_weight,
          uint64_t min_ring_size, uint64_t max_ring_size, HashFunction hash_function,
@@ -64,7 +59,12 @@ private:
     // ThreadAwareLoadBalancerBase::HashingLoadBalancer
     HostConstSharedPtr chooseHost(uint64_t hash, uint32_t attempt) const override;
 
-    std::vector<RingEntry> ring_;
+    // The ring is kept as a sorted array of hashes, searched on its own, and a parallel array of
+    // indices into hosts_. This takes 12 bytes per ring entry instead of a hash and a shared
+    // pointer per entry, and building the ring does not touch the host reference counts.
+    std::vector<uint64_t> hashes_;
+    std::vector<uint32_t> host_indices_;
+    std::vector<HostConstSharedPtr> hosts_;
 
     RingHashLoadBalancerStats& stats_;
   };
@@ -72,7 +72,8 @@ private:
 
   // ThreadAwareLoadBalancerBase
   HashingLoadBalancerSharedPtr
-  createLoadBalancer(const NormalizedHostWeightVector& normalized_host_weights,
+  createLoadBalancer(uint32_t /* priority */,
+                     const NormalizedHostWeightVector& normalized_host_weights,
                      double min_normalized_weight, double /* max_normalized_weight */) override {
     HashingLoadBalancerSharedPtr ring_hash_lb =
         std::make_shared<Ring>(normalized_host_weights, min_normalized_weight, min_ring_size_,
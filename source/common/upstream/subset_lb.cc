@@ -1,5 +1,6 @@
 #include "common/upstream/subset_lb.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "envoy/config/cluster/v3/cluster.pb.h"
@@ -28,7 +29,8 @@ SubsetLoadBalancer::SubsetLoadBalancer(
     const absl::optional<envoy::config::cluster::v3::Cluster::MaglevLbConfig>& lb_maglev_config,
     const absl::optional<envoy::config::cluster::v3::Cluster::LeastRequestLbConfig>&
         least_request_config,
-    const envoy::config::cluster::v3::Cluster::CommonLbConfig& common_config)
+    const envoy::config::cluster::v3::Cluster::CommonLbConfig& common_config,
+    TimeSource& time_source)
     : lb_type_(lb_type), lb_ring_hash_config_(lb_ring_hash_config),
       lb_maglev_config_(lb_maglev_config), least_request_config_(least_request_config),
       common_config_(common_config), stats_(stats), scope_(scope), runtime_(runtime),
@@ -38,7 +40,10 @@ SubsetLoadBalancer::SubsetLoadBalancer(
       subset_selectors_(subsets.subsetSelectors()), original_priority_set_(priority_set),
       original_local_priority_set_(local_priority_set),
       locality_weight_aware_(subsets.localityWeightAware()),
-      scale_locality_weight_(subsets.scaleLocalityWeight()), list_as_any_(subsets.listAsAny()) {
+      scale_locality_weight_(subsets.scaleLocalityWeight()), list_as_any_(subsets.listAsAny()),
+      lazy_subsets_(subsets.lazySubsets()),
+      lazy_subset_idle_timeout_(subsets.lazySubsetIdleTimeout()), time_source_(time_source),
+      last_idle_eviction_(time_source.monotonicTime()) {
   ASSERT(subsets.isEnabled());
 
   if (fallback_policy_ != envoy::config::cluster::v3::Cluster::LbSubsetConfig::NO_FALLBACK) {
@@ -82,6 +87,11 @@ SubsetLoadBalancer::SubsetLoadBalancer(
         // performed.
         rebuildSingle();
 
+        // Idle subsets are removed before updating the subsets, so that they aren't updated.
+        if (lazy_subsets_) {
+          evictIdleSubsets();
+        }
+
         if (hosts_added.empty() && hosts_removed.empty()) {
           // It's possible that metadata changed, without hosts being added nor removed.
           // If so we need to add any new subsets, remove unused ones, and regroup hosts into
@@ -382,7 +392,9 @@ HostConstSharedPtr SubsetLoadBalancer::tryChooseHostFromContext(LoadBalancerCont
   }
 
   // Route has metadata match criteria defined, see if we have a matching subset.
-  LbSubsetEntryPtr entry = findSubset(match_criteria->metadataMatchCriteria());
+  LbSubsetEntryPtr entry = lazy_subsets_
+                               ? findOrCreateLazySubset(match_criteria->metadataMatchCriteria())
+                               : findSubset(match_criteria->metadataMatchCriteria());
   if (entry == nullptr || !entry->active()) {
     // No matching subset or subset not active: use fallback policy.
     return nullptr;
@@ -432,6 +444,95 @@ SubsetLoadBalancer::LbSubsetEntryPtr SubsetLoadBalancer::findSubset(
   return nullptr;
 }
 
+// Finds the subset for the given metadata match criteria, creating it if a subset selector has
+// the same keys and any hosts match the criteria. Subsets without hosts are not kept, so that
+// requests for unknown values don't grow the subset tree, but each such request has to scan the
+// hosts again. The scan allocates nothing and stops at the first matching host.
+SubsetLoadBalancer::LbSubsetEntryPtr SubsetLoadBalancer::findOrCreateLazySubset(
+    const std::vector<Router::MetadataMatchCriterionConstSharedPtr>& match_criteria) {
+  LbSubsetEntryPtr entry = findSubset(match_criteria);
+  if (entry == nullptr || !entry->initialized()) {
+    if (!subsetSelectorMatches(match_criteria)) {
+      return nullptr;
+    }
+
+    SubsetMetadata kvs;
+    kvs.reserve(match_criteria.size());
+    for (const auto& match_criterion : match_criteria) {
+      kvs.emplace_back(match_criterion->name(), match_criterion->value().value());
+    }
+
+    // Building the subset's host sets and load balancers is far more expensive than this check.
+    if (!anyHostMatches(kvs)) {
+      return nullptr;
+    }
+
+    HostPredicate predicate = [this, kvs](const Host& host) -> bool {
+      return hostMatches(kvs, host);
+    };
+    ENVOY_LOG(debug, "subset lb: lazily creating load balancer for {}", describeMetadata(kvs));
+    entry = findOrCreateSubset(subsets_, kvs, 0);
+    entry->priority_subset_ = std::make_shared<PrioritySubsetImpl>(
+        *this, predicate, locality_weight_aware_, scale_locality_weight_);
+    stats_.lb_subsets_active_.inc();
+    stats_.lb_subsets_created_.inc();
+  }
+
+  const MonotonicTime now = time_source_.monotonicTime();
+  entry->last_selected_ = now;
+
+  // Host updates may be rare, so idle subsets are also evicted from here, at most once per idle
+  // timeout. The selected subset is kept alive by entry even if it is purged from the tree.
+  if (now - last_idle_eviction_ >= lazy_subset_idle_timeout_) {
+    evictIdleSubsets();
+    purgeEmptySubsets(subsets_);
+  }
+  return entry;
+}
+
+bool SubsetLoadBalancer::anyHostMatches(const SubsetMetadata& kvs) {
+  for (const auto& host_set : original_priority_set_.hostSetsPerPriority()) {
+    for (const auto& host : host_set->hosts()) {
+      if (hostMatches(kvs, *host)) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// Returns true if the keys of the given metadata match criteria (which must be lexically sorted by
+// key) are the keys of a subset selector.
+bool SubsetLoadBalancer::subsetSelectorMatches(
+    const std::vector<Router::MetadataMatchCriterionConstSharedPtr>& match_criteria) const {
+  for (const auto& subset_selector : subset_selectors_) {
+    const auto& keys = subset_selector->selectorKeys();
+    if (keys.size() == match_criteria.size() &&
+        std::equal(keys.begin(), keys.end(), match_criteria.begin(),
+                   [](const std::string& key,
+                      const Router::MetadataMatchCriterionConstSharedPtr& match_criterion) {
+                     return key == match_criterion->name();
+                   })) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Removes the load balancers of lazily created subsets that no request selected for the idle
+// timeout. Their entries are then removed by purgeEmptySubsets().
+void SubsetLoadBalancer::evictIdleSubsets() {
+  const MonotonicTime now = time_source_.monotonicTime();
+  last_idle_eviction_ = now;
+  forEachSubset(subsets_, [&](LbSubsetEntryPtr entry) {
+    if (entry->initialized() && now - entry->last_selected_ >= lazy_subset_idle_timeout_) {
+      entry->priority_subset_.reset();
+      stats_.lb_subsets_active_.dec();
+      stats_.lb_subsets_removed_.inc();
+    }
+  });
+}
+
 void SubsetLoadBalancer::updateFallbackSubset(uint32_t priority, const HostVector& hosts_added,
                                               const HostVector& hosts_removed) {
 
@@ -523,6 +624,16 @@ void SubsetLoadBalancer::update(uint32_t priority, const HostVector& hosts_added
                                 const HostVector& hosts_removed) {
   updateFallbackSubset(priority, hosts_added, hosts_removed);
 
+  if (lazy_subsets_) {
+    // Lazy subsets are only created by requests, so only the existing ones are updated.
+    forEachSubset(subsets_, [&](LbSubsetEntryPtr entry) {
+      if (entry->initialized()) {
+        entry->priority_subset_->update(priority, hosts_added, hosts_removed);
+      }
+    });
+    return;
+  }
+
   processSubsets(
       hosts_added, hosts_removed,
       [&](LbSubsetEntryPtr entry) {
@@ -778,8 +889,10 @@ SubsetLoadBalancer::PrioritySubsetImpl::PrioritySubsetImpl(const SubsetLoadBalan
 
   case LoadBalancerType::OriginalDst:
   case LoadBalancerType::ClusterProvided:
-    // LoadBalancerType::OriginalDst is blocked in the factory. LoadBalancerType::ClusterProvided
-    // is impossible because the subset LB returns a null load balancer from its factory.
+  case LoadBalancerType::PeakEwma:
+    // LoadBalancerType::OriginalDst and LoadBalancerType::PeakEwma are blocked in the factory.
+    // LoadBalancerType::ClusterProvided is impossible because the subset LB returns a null load
+    // balancer from its factory.
     NOT_REACHED_GCOVR_EXCL_LINE;
   }
 
@@ -1,10 +1,12 @@
 #pragma once
 
+#include <chrono>
 #include <functional>
 #include <map>
 #include <memory>
 #include <string>
 
+#include "envoy/common/time.h"
 #include "envoy/config/cluster/v3/cluster.pb.h"
 #include "envoy/runtime/runtime.h"
 #include "envoy/stats/scope.h"
@@ -32,7 +34,8 @@ public:
       const absl::optional<envoy::config::cluster::v3::Cluster::MaglevLbConfig>& lb_maglev_config,
       const absl::optional<envoy::config::cluster::v3::Cluster::LeastRequestLbConfig>&
           least_request_config,
-      const envoy::config::cluster::v3::Cluster::CommonLbConfig& common_config);
+      const envoy::config::cluster::v3::Cluster::CommonLbConfig& common_config,
+      TimeSource& time_source);
   ~SubsetLoadBalancer() override;
 
   // Upstream::LoadBalancer
@@ -191,6 +194,9 @@ private:
 
     // Only initialized if a match exists at this level.
     PrioritySubsetImplPtr priority_subset_;
+
+    // The last time a request selected this subset. Only used for lazily created subsets.
+    MonotonicTime last_selected_;
   };
 
   // Create filtered default subset (if necessary) and other subsets based on current hosts.
@@ -219,9 +225,16 @@ private:
   tryFindSelectorFallbackParams(LoadBalancerContext* context);
 
   bool hostMatches(const SubsetMetadata& kvs, const Host& host);
+  // Returns true if any host of the original priority set matches kvs.
+  bool anyHostMatches(const SubsetMetadata& kvs);
 
   LbSubsetEntryPtr
   findSubset(const std::vector<Router::MetadataMatchCriterionConstSharedPtr>& matches);
+  LbSubsetEntryPtr
+  findOrCreateLazySubset(const std::vector<Router::MetadataMatchCriterionConstSharedPtr>& matches);
+  bool subsetSelectorMatches(
+      const std::vector<Router::MetadataMatchCriterionConstSharedPtr>& matches) const;
+  void evictIdleSubsets();
 
   LbSubsetEntryPtr findOrCreateSubset(LbSubsetMap& subsets, const SubsetMetadata& kvs,
                                       uint32_t idx);
@@ -271,6 +284,11 @@ private:
   const bool locality_weight_aware_;
   const bool scale_locality_weight_;
   const bool list_as_any_;
+  const bool lazy_subsets_;
+  const std::chrono::milliseconds lazy_subset_idle_timeout_;
+  TimeSource& time_source_;
+  // When idle lazily created subsets were last evicted.
+  MonotonicTime last_idle_eviction_;
 
   friend class SubsetLoadBalancerDescribeMetadataTester;
 };
@@ -122,8 +122,9 @@ void ThreadAwareLoadBalancerBase::refresh() {
     double max_normalized_weight = 0.0;
     normalizeWeights(*host_set, per_priority_state->global_panic_, normalized_host_weights,
                      min_normalized_weight, max_normalized_weight);
-    per_priority_state->current_lb_ = createLoadBalancer(
-        std::move(normalized_host_weights), min_normalized_weight, max_normalized_weight);
+    per_priority_state->current_lb_ =
+        createLoadBalancer(priority, std::move(normalized_host_weights), min_normalized_weight,
+                           max_normalized_weight);
   }
 
   {
@@ -190,7 +191,7 @@ double ThreadAwareLoadBalancerBase::BoundedLoadHashingLoadBalancer::hostOverload
   // TODO(scheler): This will not work if rq_active cluster stat is disabled, need to detect
   // and alert the user if that's the case.
 
-  const uint32_t overall_active = host.cluster().stats().upstream_rq_active_.value();
+  const uint32_t overall_active = host.cluster().trafficStats().upstream_rq_active_.value();
   const uint32_t host_active = host.stats().rq_active_.value();
 
   const uint32_t total_slots = ((overall_active + 1) * hash_balance_factor_ + 99) / 100;
@@ -243,6 +244,11 @@ ThreadAwareLoadBalancerBase::BoundedLoadHashingLoadBalancer::chooseHost(uint64_t
     return host;
   }
 
+  // The hosts in normalized_host_weights_ all belong to the cluster of the hashed host, so its
+  // stats are the stats of the cluster being load balanced.
+  ClusterStats& stats = host->cluster().stats();
+  stats.lb_bounded_load_overflow_.inc();
+
   // When a host is overloaded, we choose the next host in a random manner rather than picking the
   // next one in the ring. The random sequence is seeded by the hash, so the same input gets the
   // same sequence of hosts all the time.
@@ -270,6 +276,7 @@ ThreadAwareLoadBalancerBase::BoundedLoadHashingLoadBalancer::chooseHost(uint64_t
 
   HostConstSharedPtr alt_host, least_overloaded_host = host;
   double least_overload_factor = overload_factor;
+  uint64_t probes = 0;
   for (uint32_t i = 0; i < num_hosts; i++) {
     // The random shuffle algorithm
     const uint32_t j = uniform_int(random, num_hosts - i);
@@ -283,8 +290,10 @@ ThreadAwareLoadBalancerBase::BoundedLoadHashingLoadBalancer::chooseHost(uint64_t
 
     const double alt_host_weight = normalized_host_weights_[k].second;
     overload_factor = hostOverloadFactor(*alt_host, alt_host_weight);
+    probes++;
 
     if (overload_factor <= 1.0) {
+      stats.lb_bounded_load_overflow_probes_.add(probes);
       ENVOY_LOG_MISC(debug,
                      "ThreadAwareLoadBalancerBase::BoundedLoadHashingLoadBalancer::chooseHost: "
                      "selected host #{}:{} (attempt:{})",
@@ -298,6 +307,8 @@ ThreadAwareLoadBalancerBase::BoundedLoadHashingLoadBalancer::chooseHost(uint64_t
     }
   }
 
+  stats.lb_bounded_load_overflow_probes_.add(probes);
+  stats.lb_bounded_load_all_hosts_overloaded_.inc();
   return least_overloaded_host;
 }
 
@@ -81,7 +81,7 @@ Http::FilterHeadersStatus ProxyFilter::decodeHeaders(Http::RequestHeaderMap& hea
 
   if (circuit_breaker_ == nullptr) {
     if (!should_use_dns_cache_circuit_breakers) {
-      cluster_info_->stats().upstream_rq_pending_overflow_.inc();
+      cluster_info_->trafficStats().upstream_rq_pending_overflow_.inc();
     }
     ENVOY_STREAM_LOG(debug, "pending request overflow", *this->decoder_callbacks_);
     this->decoder_callbacks_->sendLocalReply(
@@ -77,9 +77,9 @@ ClientImpl::ClientImpl(Upstream::HostConstSharedPtr host, Event::Dispatcher& dis
       flush_timer_(dispatcher.createTimer([this]() { flushBufferAndResetTimer(); })),
       time_source_(dispatcher.timeSource()), redis_command_stats_(redis_command_stats),
       scope_(scope) {
-  host->cluster().stats().upstream_cx_total_.inc();
+  host->cluster().trafficStats().upstream_cx_total_.inc();
   host->stats().cx_total_.inc();
-  host->cluster().stats().upstream_cx_active_.inc();
+  host->cluster().trafficStats().upstream_cx_active_.inc();
   host->stats().cx_active_.inc();
   connect_or_op_timer_->enableTimer(host->cluster().connectTimeout());
 }
@@ -87,7 +87,7 @@ ClientImpl::ClientImpl(Upstream::HostConstSharedPtr host, Event::Dispatcher& dis
 ClientImpl::~ClientImpl() {
   ASSERT(pending_requests_.empty());
   ASSERT(connection_->state() == Network::Connection::State::Closed);
-  host_->cluster().stats().upstream_cx_active_.dec();
+  host_->cluster().trafficStats().upstream_cx_active_.dec();
   host_->stats().cx_active_.dec();
 }
 
@@ -141,10 +141,10 @@ PoolRequest* ClientImpl::makeRequest(const RespValue& request, ClientCallbacks&
 void ClientImpl::onConnectOrOpTimeout() {
   putOutlierEvent(Upstream::Outlier::Result::LocalOriginTimeout);
   if (connected_) {
-    host_->cluster().stats().upstream_rq_timeout_.inc();
+    host_->cluster().trafficStats().upstream_rq_timeout_.inc();
     host_->stats().rq_timeout_.inc();
   } else {
-    host_->cluster().stats().upstream_cx_connect_timeout_.inc();
+    host_->cluster().trafficStats().upstream_cx_connect_timeout_.inc();
     host_->stats().cx_connect_fail_.inc();
   }
 
@@ -156,7 +156,7 @@ void ClientImpl::onData(Buffer::Instance& data) {
     decoder_->decode(data);
   } catch (ProtocolError&) {
     putOutlierEvent(Upstream::Outlier::Result::ExtOriginRequestFailed);
-    host_->cluster().stats().upstream_cx_protocol_error_.inc();
+    host_->cluster().trafficStats().upstream_cx_protocol_error_.inc();
     host_->stats().rq_error_.inc();
     connection_->close(Network::ConnectionCloseType::NoFlush);
   }
@@ -185,7 +185,7 @@ void ClientImpl::onEvent(Network::ConnectionEvent event) {
       if (!request.canceled_) {
         request.callbacks_.onFailure();
       } else {
-        host_->cluster().stats().upstream_rq_cancelled_.inc();
+        host_->cluster().trafficStats().upstream_rq_cancelled_.inc();
       }
       pending_requests_.pop_front();
     }
@@ -198,7 +198,7 @@ void ClientImpl::onEvent(Network::ConnectionEvent event) {
   }
 
   if (event == Network::ConnectionEvent::RemoteClose && !connected_) {
-    host_->cluster().stats().upstream_cx_connect_fail_.inc();
+    host_->cluster().trafficStats().upstream_cx_connect_fail_.inc();
     host_->stats().cx_connect_fail_.inc();
   }
 }
@@ -221,7 +221,7 @@ void ClientImpl::onRespValue(RespValuePtr&& value) {
   // result in closing the connection.
   pending_requests_.pop_front();
   if (canceled) {
-    host_->cluster().stats().upstream_rq_cancelled_.inc();
+    host_->cluster().trafficStats().upstream_rq_cancelled_.inc();
   } else if (config_.enableRedirection() && (value->type() == Common::Redis::RespType::Error)) {
     std::vector<absl::string_view> err = StringUtil::splitToken(value->asString(), " ", false);
     bool redirected = false;
@@ -233,9 +233,9 @@ void ClientImpl::onRespValue(RespValuePtr&& value) {
         bool redirect_succeeded = callbacks.onRedirection(std::move(value), std::string(err[2]),
                                                           err[0] == RedirectionResponse::get().ASK);
         if (redirect_succeeded) {
-          host_->cluster().stats().upstream_internal_redirect_succeeded_total_.inc();
+          host_->cluster().trafficStats().upstream_internal_redirect_succeeded_total_.inc();
         } else {
-          host_->cluster().stats().upstream_internal_redirect_failed_total_.inc();
+          host_->cluster().trafficStats().upstream_internal_redirect_failed_total_.inc();
         }
       }
     }
@@ -271,14 +271,14 @@ ClientImpl::PendingRequest::PendingRequest(ClientImpl& parent, ClientCallbacks&
     command_request_timer_ = parent_.redis_command_stats_->createCommandTimer(
         parent_.scope_, command_, parent_.time_source_);
   }
-  parent.host_->cluster().stats().upstream_rq_total_.inc();
+  parent.host_->cluster().trafficStats().upstream_rq_total_.inc();
   parent.host_->stats().rq_total_.inc();
-  parent.host_->cluster().stats().upstream_rq_active_.inc();
+  parent.host_->cluster().trafficStats().upstream_rq_active_.inc();
   parent.host_->stats().rq_active_.inc();
 }
 
 ClientImpl::PendingRequest::~PendingRequest() {
-  parent_.host_->cluster().stats().upstream_rq_active_.dec();
+  parent_.host_->cluster().trafficStats().upstream_rq_active_.dec();
   parent_.host_->stats().rq_active_.dec();
 }
 
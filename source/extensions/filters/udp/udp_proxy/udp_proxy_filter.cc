@@ -91,7 +91,7 @@ void UdpProxyFilter::ClusterInfo::onData(Network::UdpRecvData& data) {
              ->resourceManager(Upstream::ResourcePriority::Default)
              .connections()
              .canCreate()) {
-      cluster_.info()->stats().upstream_cx_overflow_.inc();
+      cluster_.info()->trafficStats().upstream_cx_overflow_.inc();
       return;
     }
 
@@ -251,7 +251,7 @@ void UdpProxyFilter::ActiveSession::write(const Buffer::Instance& buffer) {
     cluster_.cluster_stats_.sess_tx_errors_.inc();
   } else {
     cluster_.cluster_stats_.sess_tx_datagrams_.inc();
-    cluster_.cluster_.info()->stats().upstream_cx_tx_bytes_total_.add(buffer_length);
+    cluster_.cluster_.info()->trafficStats().upstream_cx_tx_bytes_total_.add(buffer_length);
   }
 }
 
@@ -264,7 +264,7 @@ void UdpProxyFilter::ActiveSession::processPacket(Network::Address::InstanceCons
   const uint64_t buffer_length = buffer->length();
 
   cluster_.cluster_stats_.sess_rx_datagrams_.inc();
-  cluster_.cluster_.info()->stats().upstream_cx_rx_bytes_total_.add(buffer_length);
+  cluster_.cluster_.info()->trafficStats().upstream_cx_rx_bytes_total_.add(buffer_length);
 
   Network::UdpSendData data{addresses_.local_->ip(), *addresses_.peer_, *buffer};
   const Api::IoCallUint64Result rc = cluster_.filter_.read_callbacks_->udpListener().send(data);
@@ -19,6 +19,7 @@
 #include "common/config/utility.h"
 #include "common/network/socket_interface.h"
 #include "common/network/utility.h"
+#include "common/runtime/runtime_features.h"
 #include "common/stats/symbol_table_impl.h"
 
 #include "absl/strings/str_join.h"
@@ -81,6 +82,12 @@ void UdpStatsdSink::flush(Stats::MetricSnapshot& snapshot) {
   // TODO(efimki): Add support of text readouts stats.
 }
 
+bool UdpStatsdSink::flushChangedMetricsOnly() const {
+  // Statsd servers keep the last value of a gauge, and a counter delta of zero is a no-op.
+  return Runtime::runtimeFeatureEnabled(
+      "envoy.reloadable_features.statsd_flush_changed_metrics_only");
+}
+
 void UdpStatsdSink::writeBuffer(Buffer::OwnedImpl& buffer, Writer& writer,
                                 const std::string& statsd_metric) const {
   if (statsd_metric.length() >= buffer_size_) {
@@ -176,6 +183,11 @@ void TcpStatsdSink::flush(Stats::MetricSnapshot& snapshot) {
   tls_sink.endFlush(true);
 }
 
+bool TcpStatsdSink::flushChangedMetricsOnly() const {
+  return Runtime::runtimeFeatureEnabled(
+      "envoy.reloadable_features.statsd_flush_changed_metrics_only");
+}
+
 TcpStatsdSink::TlsSink::TlsSink(TcpStatsdSink& parent, Event::Dispatcher& dispatcher)
     : parent_(parent), dispatcher_(dispatcher) {}
 
@@ -272,7 +284,7 @@ void TcpStatsdSink::TlsSink::write(Buffer::Instance& buffer) {
   //       since if we stay over, the other threads will eventually kill their connections too.
   // TODO(mattklein123): The use of the stat is somewhat of a hack, and should be replaced with
   // real flow control callbacks once they are available.
-  if (parent_.cluster_info_->stats().upstream_cx_tx_bytes_buffered_.value() >
+  if (parent_.cluster_info_->trafficStats().upstream_cx_tx_bytes_buffered_.value() >
       MAX_BUFFERED_STATS_BYTES) {
     if (connection_) {
       connection_->close(Network::ConnectionCloseType::NoFlush);
@@ -292,11 +304,12 @@ void TcpStatsdSink::TlsSink::write(Buffer::Instance& buffer) {
 
     connection_ = std::move(info.connection_);
     connection_->addConnectionCallbacks(*this);
-    connection_->setConnectionStats({parent_.cluster_info_->stats().upstream_cx_rx_bytes_total_,
-                                     parent_.cluster_info_->stats().upstream_cx_rx_bytes_buffered_,
-                                     parent_.cluster_info_->stats().upstream_cx_tx_bytes_total_,
-                                     parent_.cluster_info_->stats().upstream_cx_tx_bytes_buffered_,
-                                     &parent_.cluster_info_->stats().bind_errors_, nullptr});
+    Upstream::ClusterTrafficStats& traffic_stats = parent_.cluster_info_->trafficStats();
+    connection_->setConnectionStats({traffic_stats.upstream_cx_rx_bytes_total_,
+                                     traffic_stats.upstream_cx_rx_bytes_buffered_,
+                                     traffic_stats.upstream_cx_tx_bytes_total_,
+                                     traffic_stats.upstream_cx_tx_bytes_buffered_,
+                                     &traffic_stats.bind_errors_, nullptr});
     connection_->connect();
   }
 
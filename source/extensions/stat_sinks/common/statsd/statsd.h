@@ -56,6 +56,7 @@ public:
 
   // Stats::Sink
   void flush(Stats::MetricSnapshot& snapshot) override;
+  bool flushChangedMetricsOnly() const override;
   void onHistogramComplete(const Stats::Histogram& histogram, uint64_t value) override;
 
   bool getUseTagForTest() { return use_tag_; }
@@ -104,6 +105,7 @@ public:
 
   // Stats::Sink
   void flush(Stats::MetricSnapshot& snapshot) override;
+  bool flushChangedMetricsOnly() const override;
   void onHistogramComplete(const Stats::Histogram& histogram, uint64_t value) override {
     // For statsd histograms are all timers.
     tls_->getTyped<TlsSink>().onTimespanComplete(histogram.name(),
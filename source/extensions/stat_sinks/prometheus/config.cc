@@ -0,0 +1,40 @@
+#include "extensions/stat_sinks/prometheus/config.h"
+
+#include <memory>
+
+#include "envoy/config/metrics/v3/stats.pb.h"
+#include "envoy/config/metrics/v3/stats.pb.validate.h"
+#include "envoy/registry/registry.h"
+
+#include "extensions/stat_sinks/prometheus/prometheus.h"
+#include "extensions/stat_sinks/well_known_names.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace StatSinks {
+namespace Prometheus {
+
+Stats::SinkPtr
+PrometheusSinkFactory::createStatsSink(const Protobuf::Message& config,
+                                       Server::Configuration::ServerFactoryContext& server) {
+  const auto& prometheus_sink =
+      MessageUtil::downcastAndValidate<const envoy::config::metrics::v3::PrometheusSink&>(
+          config, server.messageValidationContext().staticValidationVisitor());
+  return std::make_unique<PrometheusSink>(server.admin(), prometheus_sink.used_only());
+}
+
+ProtobufTypes::MessagePtr PrometheusSinkFactory::createEmptyConfigProto() {
+  return std::make_unique<envoy::config::metrics::v3::PrometheusSink>();
+}
+
+std::string PrometheusSinkFactory::name() const { return StatsSinkNames::get().Prometheus; }
+
+/**
+ * Static registration for the prometheus sink factory. @see RegisterFactory.
+ */
+REGISTER_FACTORY(PrometheusSinkFactory, Server::Configuration::StatsSinkFactory);
+
+} // namespace Prometheus
+} // namespace StatSinks
+} // namespace Extensions
+} // namespace Envoy
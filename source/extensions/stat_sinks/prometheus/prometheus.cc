@@ -0,0 +1,121 @@
+#include "extensions/stat_sinks/prometheus/prometheus.h"
+
+#include <vector>
+
+#include "common/buffer/buffer_impl.h"
+#include "common/http/headers.h"
+
+#include "extensions/compression/gzip/compressor/zlib_compressor_impl.h"
+
+#include "server/admin/prometheus_stats.h"
+
+#include "absl/strings/ascii.h"
+#include "absl/strings/match.h"
+#include "absl/strings/str_split.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace StatSinks {
+namespace Prometheus {
+
+namespace {
+
+// The rendering is compressed once per flush for all scrapers, so favor the compression ratio.
+constexpr int64_t GzipWindowBits = 15 | 16; // Largest window, with a gzip header and trailer.
+constexpr uint64_t GzipMemoryLevel = 8;
+constexpr uint64_t GzipChunkSize = 64 * 1024;
+
+class RenderingFragment : public Buffer::BufferFragment {
+public:
+  explicit RenderingFragment(std::shared_ptr<const std::string> rendering)
+      : rendering_(std::move(rendering)) {}
+
+  // Buffer::BufferFragment
+  const void* data() const override { return rendering_->data(); }
+  size_t size() const override { return rendering_->size(); }
+  void done() override { delete this; }
+
+private:
+  const std::shared_ptr<const std::string> rendering_;
+};
+
+} // namespace
+
+PrometheusSink::PrometheusSink(Server::Admin& admin, bool used_only) : used_only_(used_only) {
+  ENVOY_LOG(debug, "adding /stats/prometheus/cached endpoint");
+  admin.addHandler("/stats/prometheus/cached",
+                   "print server stats rendered at the last flush in prometheus format",
+                   MAKE_ADMIN_HANDLER(handlerCachedPrometheusStats), false, false);
+}
+
+Http::Code PrometheusSink::handlerCachedPrometheusStats(absl::string_view,
+                                                        Http::ResponseHeaderMap& response_headers,
+                                                        Buffer::Instance& response,
+                                                        Server::AdminStream& admin_stream) {
+  if (rendering_ == nullptr) {
+    response.add("stats have not been flushed yet\n");
+    return Http::Code::ServiceUnavailable;
+  }
+
+  response_headers.addReferenceKey(Http::CustomHeaders::get().Vary,
+                                   Http::CustomHeaders::get().VaryValues.AcceptEncoding);
+  const auto accept_encoding =
+      admin_stream.getRequestHeaders().get(Http::CustomHeaders::get().AcceptEncoding);
+  if (!accept_encoding.empty() && acceptsGzip(accept_encoding[0]->value().getStringView())) {
+    response_headers.addReferenceKey(Http::CustomHeaders::get().ContentEncoding,
+                                     Http::CustomHeaders::get().ContentEncodingValues.Gzip);
+    addRendering(gzip_rendering_, response);
+  } else {
+    addRendering(rendering_, response);
+  }
+  return Http::Code::OK;
+}
+
+void PrometheusSink::flush(Stats::MetricSnapshot& snapshot) {
+  Buffer::OwnedImpl buffer;
+  Server::PrometheusStatsFormatter::statsAsPrometheus(snapshot, buffer, used_only_);
+  rendering_ = std::make_shared<const std::string>(buffer.toString());
+
+  Compression::Gzip::Compressor::ZlibCompressorImpl compressor(GzipChunkSize);
+  compressor.init(Compression::Gzip::Compressor::ZlibCompressorImpl::CompressionLevel::Standard,
+                  Compression::Gzip::Compressor::ZlibCompressorImpl::CompressionStrategy::Standard,
+                  GzipWindowBits, GzipMemoryLevel);
+  compressor.compress(buffer, Envoy::Compression::Compressor::State::Finish);
+  gzip_rendering_ = std::make_shared<const std::string>(buffer.toString());
+}
+
+bool PrometheusSink::acceptsGzip(absl::string_view accept_encoding) {
+  for (absl::string_view coding : absl::StrSplit(accept_encoding, ',')) {
+    std::vector<absl::string_view> params = absl::StrSplit(coding, ';');
+    const absl::string_view name = absl::StripAsciiWhitespace(params[0]);
+    if (!absl::EqualsIgnoreCase(name, Http::CustomHeaders::get().AcceptEncodingValues.Gzip) &&
+        name != Http::CustomHeaders::get().AcceptEncodingValues.Wildcard) {
+      continue;
+    }
+    // A zero quality value, e.g. "gzip;q=0", means the coding is not acceptable.
+    bool rejected = false;
+    for (size_t i = 1; i < params.size(); ++i) {
+      const absl::string_view param = absl::StripAsciiWhitespace(params[i]);
+      if (absl::StartsWithIgnoreCase(param, "q=")) {
+        const absl::string_view quality = absl::StripTrailingAsciiWhitespace(param.substr(2));
+        rejected = !quality.empty() && quality.find_first_not_of("0.") == absl::string_view::npos;
+      }
+    }
+    if (!rejected) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void PrometheusSink::addRendering(const RenderingSharedPtr& rendering,
+                                  Buffer::Instance& response) {
+  if (!rendering->empty()) {
+    response.addBufferFragment(*new RenderingFragment(rendering));
+  }
+}
+
+} // namespace Prometheus
+} // namespace StatSinks
+} // namespace Extensions
+} // namespace Envoy
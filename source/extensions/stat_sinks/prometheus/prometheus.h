@@ -0,0 +1,57 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "envoy/server/admin.h"
+#include "envoy/stats/sink.h"
+
+#include "common/common/logger.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace StatSinks {
+namespace Prometheus {
+
+/**
+ * Renders the stats in the Prometheus text exposition format once per flush, and serves the last
+ * rendering from the /stats/prometheus/cached admin endpoint. The rendering is also gzip
+ * compressed once per flush, so scrapers that accept gzip get the compressed copy without any
+ * per-scrape work. Both flush() and the admin handler run on the main thread.
+ */
+class PrometheusSink : public Stats::Sink, public Logger::Loggable<Logger::Id::admin> {
+public:
+  PrometheusSink(Server::Admin& admin, bool used_only);
+
+  Http::Code handlerCachedPrometheusStats(absl::string_view path_and_query,
+                                          Http::ResponseHeaderMap& response_headers,
+                                          Buffer::Instance& response,
+                                          Server::AdminStream& admin_stream);
+
+  // Stats::Sink
+  void flush(Stats::MetricSnapshot& snapshot) override;
+  void onHistogramComplete(const Stats::Histogram&, uint64_t) override {}
+
+  /**
+   * @return whether the value of an accept-encoding request header allows a gzip response.
+   */
+  static bool acceptsGzip(absl::string_view accept_encoding);
+
+private:
+  using RenderingSharedPtr = std::shared_ptr<const std::string>;
+
+  /**
+   * Appends a rendering to a response without copying it. The rendering is kept alive until the
+   * response has been written, even if a flush replaces it in the meantime.
+   */
+  static void addRendering(const RenderingSharedPtr& rendering, Buffer::Instance& response);
+
+  const bool used_only_;
+  RenderingSharedPtr rendering_;
+  RenderingSharedPtr gzip_rendering_;
+};
+
+} // namespace Prometheus
+} // namespace StatSinks
+} // namespace Extensions
+} // namespace Envoy
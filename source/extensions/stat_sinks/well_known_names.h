@@ -22,6 +22,8 @@ public:
   const std::string MetricsService = "envoy.stat_sinks.metrics_service";
   // Hystrix sink
   const std::string Hystrix = "envoy.stat_sinks.hystrix";
+  // Prometheus sink serving the stats rendered at the last flush
+  const std::string Prometheus = "envoy.stat_sinks.prometheus";
   // WebAssembly sink
   const std::string Wasm = "envoy.stat_sinks.wasm";
 };
@@ -1,8 +1,12 @@
 #include "extensions/transport_sockets/tls/io_handle_bio.h"
 
+#include <algorithm>
+
 #include "envoy/buffer/buffer.h"
 #include "envoy/network/io_handle.h"
 
+#include "common/buffer/buffer_impl.h"
+
 #include "openssl/bio.h"
 #include "openssl/err.h"
 
@@ -13,11 +17,25 @@ namespace Tls {
 
 namespace {
 
+// State hung off BIO::ptr.
+struct IoHandleBioState {
+  IoHandleBioState(Envoy::Network::IoHandle* io_handle, uint64_t read_ahead_size)
+      : io_handle_(io_handle), read_ahead_size_(read_ahead_size) {}
+
+  Envoy::Network::IoHandle* const io_handle_;
+  const uint64_t read_ahead_size_;
+  // Bytes read from the IoHandle but not yet consumed by BIO_read().
+  Envoy::Buffer::OwnedImpl read_ahead_buffer_;
+};
+
 // NOLINTNEXTLINE(readability-identifier-naming)
-inline Envoy::Network::IoHandle* bio_io_handle(BIO* bio) {
-  return reinterpret_cast<Envoy::Network::IoHandle*>(bio->ptr);
+inline IoHandleBioState* bio_state(BIO* bio) {
+  return reinterpret_cast<IoHandleBioState*>(bio->ptr);
 }
 
+// NOLINTNEXTLINE(readability-identifier-naming)
+inline Envoy::Network::IoHandle* bio_io_handle(BIO* bio) { return bio_state(bio)->io_handle_; }
+
 // NOLINTNEXTLINE(readability-identifier-naming)
 int io_handle_new(BIO* bio) {
   bio->init = 0;
@@ -40,6 +58,8 @@ int io_handle_free(BIO* bio) {
     bio->init = 0;
     bio->flags = 0;
   }
+  delete bio_state(bio);
+  bio->ptr = nullptr;
   return 1;
 }
 
@@ -49,19 +69,43 @@ int io_handle_read(BIO* b, char* out, int outl) {
     return 0;
   }
 
-  Envoy::Buffer::RawSlice slice;
-  slice.mem_ = out;
-  slice.len_ = outl;
-  auto result = bio_io_handle(b)->readv(outl, &slice, 1);
+  IoHandleBioState* state = bio_state(b);
+  if (state->read_ahead_size_ == 0) {
+    Envoy::Buffer::RawSlice slice;
+    slice.mem_ = out;
+    slice.len_ = outl;
+    auto result = state->io_handle_->readv(outl, &slice, 1);
+    BIO_clear_retry_flags(b);
+    if (!result.ok()) {
+      auto err = result.err_->getErrorCode();
+      if (err == Api::IoError::IoErrorCode::Again || err == Api::IoError::IoErrorCode::Interrupt) {
+        BIO_set_retry_read(b);
+      }
+      return -1;
+    }
+    return result.rc_;
+  }
+
   BIO_clear_retry_flags(b);
-  if (!result.ok()) {
-    auto err = result.err_->getErrorCode();
-    if (err == Api::IoError::IoErrorCode::Again || err == Api::IoError::IoErrorCode::Interrupt) {
-      BIO_set_retry_read(b);
+  Envoy::Buffer::OwnedImpl& buffer = state->read_ahead_buffer_;
+  if (buffer.length() == 0) {
+    auto result = state->io_handle_->read(
+        buffer, std::max(static_cast<uint64_t>(outl), state->read_ahead_size_));
+    if (!result.ok()) {
+      auto err = result.err_->getErrorCode();
+      if (err == Api::IoError::IoErrorCode::Again || err == Api::IoError::IoErrorCode::Interrupt) {
+        BIO_set_retry_read(b);
+      }
+      return -1;
+    }
+    if (result.rc_ == 0) {
+      return 0;
     }
-    return -1;
   }
-  return result.rc_;
+  const uint64_t bytes_to_copy = std::min(static_cast<uint64_t>(outl), buffer.length());
+  buffer.copyOut(0, bytes_to_copy, out);
+  buffer.drain(bytes_to_copy);
+  return static_cast<int>(bytes_to_copy);
 }
 
 // NOLINTNEXTLINE(readability-identifier-naming)
@@ -101,6 +145,9 @@ long io_handle_ctrl(BIO* b, int cmd, long num, void*) {
   case BIO_CTRL_FLUSH:
     ret = 1;
     break;
+  case BIO_CTRL_PENDING:
+    ret = b->ptr != nullptr ? static_cast<long>(bio_state(b)->read_ahead_buffer_.length()) : 0;
+    break;
   default:
     ret = 0;
     break;
@@ -122,7 +169,7 @@ const BIO_METHOD* BIO_s_io_handle(void) { return &methods_io_handlep; }
 } // namespace
 
 // NOLINTNEXTLINE(readability-identifier-naming)
-BIO* BIO_new_io_handle(Envoy::Network::IoHandle* io_handle) {
+BIO* BIO_new_io_handle(Envoy::Network::IoHandle* io_handle, uint64_t read_ahead_size) {
   BIO* b;
 
   b = BIO_new(BIO_s_io_handle());
@@ -130,7 +177,7 @@ BIO* BIO_new_io_handle(Envoy::Network::IoHandle* io_handle) {
 
   // Initialize the BIO
   b->num = -1;
-  b->ptr = io_handle;
+  b->ptr = new IoHandleBioState(io_handle, read_ahead_size);
   b->shutdown = 0;
   b->init = 1;
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 #include "envoy/network/io_handle.h"
 
 #include "openssl/bio.h"
@@ -12,9 +14,14 @@ namespace Tls {
 /**
  * Creates a custom BIO that can read from/write to an IoHandle. It's equivalent to a socket BIO
  * but instead of relying on access to an fd, it relies on IoHandle APIs for all interactions.
+ *
+ * If read_ahead_size is non-zero, reads pull up to that many bytes from the IoHandle at once and
+ * serve subsequent BIO reads from memory. BoringSSL reads the header and the body of each TLS
+ * record separately, so this turns two readv() calls per record into one per read_ahead_size
+ * bytes. BIO_pending() returns the number of bytes read ahead but not yet consumed.
  */
 // NOLINTNEXTLINE(readability-identifier-naming)
-BIO* BIO_new_io_handle(Envoy::Network::IoHandle* io_handle);
+BIO* BIO_new_io_handle(Envoy::Network::IoHandle* io_handle, uint64_t read_ahead_size = 0);
 
 } // namespace Tls
 } // namespace TransportSockets
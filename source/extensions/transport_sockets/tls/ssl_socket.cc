@@ -74,7 +74,11 @@ void SslSocket::setTransportSocketCallbacks(Network::TransportSocketCallbacks& c
   BIO* bio;
   if (Runtime::runtimeFeatureEnabled("envoy.reloadable_features.tls_use_io_handle_bio")) {
     // Use custom BIO that reads from/writes to IoHandle
-    bio = BIO_new_io_handle(&callbacks_->ioHandle());
+    bio = BIO_new_io_handle(
+        &callbacks_->ioHandle(),
+        Runtime::runtimeFeatureEnabled("envoy.reloadable_features.tls_io_handle_bio_read_ahead")
+            ? ReadAheadSize
+            : 0);
   } else {
     // TODO(fcoras): remove once the io_handle_bio proves to be stable
     bio = BIO_new_socket(callbacks_->ioHandle().fdDoNotUse(), 0);
@@ -177,6 +181,8 @@ void SslSocket::onPrivateKeyMethodComplete() {
   if (action == PostIoAction::Close) {
     ENVOY_CONN_LOG(debug, "async handshake completion error", callbacks_->connection());
     callbacks_->connection().close(Network::ConnectionCloseType::FlushWrite);
+  } else if (info_->state() == Ssl::SocketState::HandshakeComplete) {
+    resumeReadIfReadAheadPending();
   }
 }
 
@@ -191,6 +197,14 @@ void SslSocket::onFailure() { drainErrorQueue(); }
 
 PostIoAction SslSocket::doHandshake() { return info_->doHandshake(); }
 
+void SslSocket::resumeReadIfReadAheadPending() {
+  // Ciphertext that the BIO read ahead while the handshake was completed outside of doRead()
+  // will not trigger another read event, so schedule a read for it.
+  if (BIO_pending(SSL_get_rbio(rawSsl())) > 0) {
+    callbacks_->setReadBufferReady();
+  }
+}
+
 void SslSocket::drainErrorQueue() {
   bool saw_error = false;
   bool saw_counted_error = false;
@@ -226,6 +240,7 @@ Network::IoResult SslSocket::doWrite(Buffer::Instance& write_buffer, bool end_st
     if (action == PostIoAction::Close || info_->state() != Ssl::SocketState::HandshakeComplete) {
       return {action, 0, false};
     }
+    resumeReadIfReadAheadPending();
   }
 
   uint64_t bytes_to_write;
@@ -76,6 +76,10 @@ protected:
   SSL* rawSsl() const { return info_->ssl_.get(); }
 
 private:
+  // Bytes of ciphertext the IoHandle BIO reads from the socket at once. Large enough to hold a
+  // full TLS record plus the header of the next one.
+  static constexpr uint64_t ReadAheadSize = 32768;
+
   struct ReadResult {
     bool commit_slice_{};
     absl::optional<int> error_;
@@ -83,6 +87,7 @@ private:
   ReadResult sslReadIntoSlice(Buffer::RawSlice& slice);
 
   Network::PostIoAction doHandshake();
+  void resumeReadIfReadAheadPending();
   void drainErrorQueue();
   void shutdownSsl();
   bool isThreadSafe() const {
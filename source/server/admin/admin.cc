@@ -188,6 +188,10 @@ AdminImpl::AdminImpl(const std::string& profile_path, Server::Instance& server)
            MAKE_ADMIN_HANDLER(logs_handler_.handlerLogging), false, true},
           {"/memory", "print current allocation/heap usage",
            MAKE_ADMIN_HANDLER(server_info_handler_.handlerMemory), false, false},
+          {"/memory/clusters", "print the stats and hosts held by each cluster",
+           MAKE_ADMIN_HANDLER(clusters_handler_.handlerClustersMemory), false, false},
+          {"/memory/listeners", "print the stats held by each listener",
+           MAKE_ADMIN_HANDLER(listeners_handler_.handlerListenersMemory), false, false},
           {"/quitquitquit", "exit the server",
            MAKE_ADMIN_HANDLER(server_cmd_handler_.handlerQuitQuitQuit), false, true},
           {"/reset_counters", "reset all counters to zero",
@@ -59,6 +59,37 @@ Http::Code ClustersHandler::handlerClusters(absl::string_view url,
   return Http::Code::OK;
 }
 
+Http::Code ClustersHandler::handlerClustersMemory(absl::string_view, Http::ResponseHeaderMap&,
+                                                  Buffer::Instance& response, AdminStream&) {
+  for (const auto& [name, cluster_ref] : server_.clusterManager().clusters()) {
+    const Upstream::Cluster& cluster = cluster_ref.get();
+    const std::string& cluster_name = cluster.info()->name();
+    Utility::addStatsFootprintAsText(cluster_name, cluster.info()->statsScope(), response);
+
+    uint64_t hosts = 0;
+    uint64_t host_stats = 0;
+    uint64_t host_metadata_bytes = 0;
+    for (const auto& host_set : cluster.prioritySet().hostSetsPerPriority()) {
+      for (const auto& host : host_set->hosts()) {
+        ++hosts;
+        host_stats += host->counters().size() + host->gauges().size();
+        const auto metadata = host->metadata();
+        if (metadata != nullptr) {
+          host_metadata_bytes += metadata->SpaceUsedLong();
+        }
+      }
+    }
+    response.add(fmt::format("{}::host_sets::{}\n", cluster_name,
+                             cluster.prioritySet().hostSetsPerPriority().size()));
+    response.add(fmt::format("{}::hosts::{}\n", cluster_name, hosts));
+    response.add(fmt::format("{}::host_stats::{}\n", cluster_name, host_stats));
+    response.add(fmt::format("{}::host_metadata_bytes::{}\n", cluster_name, host_metadata_bytes));
+    response.add(fmt::format("{}::metadata_bytes::{}\n", cluster_name,
+                             cluster.info()->metadata().SpaceUsedLong()));
+  }
+  return Http::Code::OK;
+}
+
 // Helper method that ensures that we've setting flags based on all the health flag values on the
 // host.
 void setHealthFlag(Upstream::Host::HealthFlag flag, const Upstream::Host& host,
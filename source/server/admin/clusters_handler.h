@@ -22,6 +22,10 @@ public:
                              Http::ResponseHeaderMap& response_headers, Buffer::Instance& response,
                              AdminStream&);
 
+  Http::Code handlerClustersMemory(absl::string_view path_and_query,
+                                   Http::ResponseHeaderMap& response_headers,
+                                   Buffer::Instance& response, AdminStream&);
+
 private:
   void addOutlierInfo(const std::string& cluster_name,
                       const Upstream::Outlier::Detector* outlier_detector,
@@ -53,6 +53,17 @@ Http::Code ListenersHandler::handlerListenerInfo(absl::string_view url,
   return Http::Code::OK;
 }
 
+Http::Code ListenersHandler::handlerListenersMemory(absl::string_view, Http::ResponseHeaderMap&,
+                                                    Buffer::Instance& response, AdminStream&) {
+  for (const auto& listener : server_.listenerManager().listeners()) {
+    const std::string& listener_name = listener.get().name();
+    Utility::addStatsFootprintAsText(listener_name, listener.get().listenerScope(), response);
+    response.add(fmt::format("{}::access_logs::{}\n", listener_name,
+                             listener.get().accessLogs().size()));
+  }
+  return Http::Code::OK;
+}
+
 void ListenersHandler::writeListenersAsJson(Buffer::Instance& response) {
   envoy::admin::v3::Listeners listeners;
   for (const auto& listener : server_.listenerManager().listeners()) {
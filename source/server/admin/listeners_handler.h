@@ -26,6 +26,10 @@ public:
                                  Http::ResponseHeaderMap& response_headers,
                                  Buffer::Instance& response, AdminStream&);
 
+  Http::Code handlerListenersMemory(absl::string_view path_and_query,
+                                    Http::ResponseHeaderMap& response_headers,
+                                    Buffer::Instance& response, AdminStream&);
+
 private:
   /**
    * Helper methods for the /listeners url handler.
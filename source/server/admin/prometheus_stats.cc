@@ -3,7 +3,9 @@
 #include "common/common/empty_string.h"
 #include "common/common/macros.h"
 #include "common/stats/histogram_impl.h"
+#include "common/stats/symbol_table_impl.h"
 
+#include "absl/strings/ascii.h"
 #include "absl/strings/str_cat.h"
 
 namespace Envoy {
@@ -11,21 +13,102 @@ namespace Server {
 
 namespace {
 
-const std::regex& promRegex() { CONSTRUCT_ON_FIRST_USE(std::regex, "[^a-zA-Z0-9_]"); }
 const std::regex& namespaceRegex() {
   CONSTRUCT_ON_FIRST_USE(std::regex, "^[a-zA-Z_][a-zA-Z0-9]*$");
 }
 
 /**
- * Take a string and sanitize it according to Prometheus conventions.
+ * Take a string and sanitize it according to Prometheus conventions, appending the result to
+ * output.
  */
-std::string sanitizeName(const std::string& name) {
+void appendSanitizedName(absl::string_view name, std::string& output) {
   // The name must match the regex [a-zA-Z_][a-zA-Z0-9_]* as required by
   // prometheus. Refer to https://prometheus.io/docs/concepts/data_model/.
   // The initial [a-zA-Z_] constraint is always satisfied by the namespace prefix.
-  return std::regex_replace(name, promRegex(), "_");
+  const size_t start = output.size();
+  output.append(name.data(), name.size());
+  for (size_t i = start; i < output.size(); ++i) {
+    if (!absl::ascii_isalnum(output[i])) {
+      output[i] = '_';
+    }
+  }
+}
+
+std::string sanitizeName(absl::string_view name) {
+  std::string sanitized;
+  appendSanitizedName(name, sanitized);
+  return sanitized;
 }
 
+/**
+ * Accumulates the response in a reusable string, which is moved into the response buffer in
+ * chunks rather than a buffer slice and a temporary string or two per line. Most tag names and
+ * values are shared by many stats, so their string forms are cached by StatName for the duration
+ * of one response.
+ */
+class PrometheusOutput {
+public:
+  PrometheusOutput(Buffer::Instance& response) : response_(response) {
+    buffer_.reserve(ChunkSize);
+  }
+
+  std::string& buffer() { return buffer_; }
+
+  /**
+   * Append the tags of a metric in the form produced by PrometheusStatsFormatter::formattedTags().
+   * @return whether the metric has any tags.
+   */
+  bool appendTags(const Stats::Metric& metric, std::string& output) {
+    bool first = true;
+    const Stats::SymbolTable& symbol_table = metric.constSymbolTable();
+    metric.iterateTagStatNames([this, &symbol_table, &first, &output](
+                                   Stats::StatName name, Stats::StatName value) -> bool {
+      if (!first) {
+        output.push_back(',');
+      }
+      first = false;
+      absl::StrAppend(&output, cachedString(symbol_table, name, true), "=\"",
+                      cachedString(symbol_table, value, false), "\"");
+      return true;
+    });
+    return !first;
+  }
+
+  // Move the buffered output to the response if a full chunk has accumulated.
+  void maybeFlush() {
+    if (buffer_.size() >= ChunkSize) {
+      flush();
+    }
+  }
+
+  void flush() {
+    response_.add(buffer_);
+    buffer_.clear();
+  }
+
+private:
+  static constexpr size_t ChunkSize = 64 * 1024;
+
+  const std::string& cachedString(const Stats::SymbolTable& symbol_table,
+                                  Stats::StatName stat_name, bool sanitize) {
+    Stats::StatNameHashMap<std::string>& cache = sanitize ? tag_names_ : tag_values_;
+    auto it = cache.find(stat_name);
+    if (it == cache.end()) {
+      const std::string str = symbol_table.toString(stat_name);
+      it = cache.emplace(stat_name, sanitize ? sanitizeName(str) : str).first;
+    }
+    return it->second;
+  }
+
+  Buffer::Instance& response_;
+  std::string buffer_;
+  // Keyed by StatNames owned by the metrics being output, which outlive this object. There is a
+  // single symbol table for all the stats in the admin interface, so equal StatNames decode to
+  // equal strings.
+  Stats::StatNameHashMap<std::string> tag_names_;
+  Stats::StatNameHashMap<std::string> tag_values_;
+};
+
 /*
  * Determine whether a metric has never been emitted and choose to
  * not show it if we only wanted used metrics.
@@ -48,25 +131,37 @@ struct MetricLessThan {
   }
 };
 
+// Access the metric in an element of a store's list of metrics, or of a MetricSnapshot.
+template <class StatType> const StatType* metricPtr(const Stats::RefcountPtr<StatType>& metric) {
+  return metric.get();
+}
+template <class StatType>
+const StatType* metricPtr(const std::reference_wrapper<const StatType>& metric) {
+  return &metric.get();
+}
+const Stats::Counter* metricPtr(const Stats::MetricSnapshot::CounterSnapshot& counter) {
+  return &counter.counter_.get();
+}
+
 /**
  * Processes a stat type (counter, gauge, histogram) by generating all output lines, sorting
  * them by tag-extracted metric name, and then outputting them in the correct sorted order into
  * response.
  *
- * @param response The buffer to put the output into.
+ * @param output The output to append to.
  * @param used_only Whether to only output stats that are used.
  * @param regex A filter on which stats to output.
  * @param metrics The metrics to output stats for. This must contain all stats of the given type
  *        to be included in the same output.
- * @param generate_output A function which returns the output text for this metric.
+ * @param generate_output A function which appends the output text for this metric.
  * @param type The name of the prometheus metric type for used in TYPE annotations.
  */
-template <class StatType>
+template <class StatType, class MetricCollection>
 uint64_t outputStatType(
-    Buffer::Instance& response, const bool used_only, const absl::optional<std::regex>& regex,
-    const std::vector<Stats::RefcountPtr<StatType>>& metrics,
-    const std::function<std::string(
-        const StatType& metric, const std::string& prefixed_tag_extracted_name)>& generate_output,
+    PrometheusOutput& output, const bool used_only, const absl::optional<std::regex>& regex,
+    const MetricCollection& metrics,
+    const std::function<void(const StatType& metric, const std::string& prefixed_tag_extracted_name,
+                             PrometheusOutput& output)>& generate_output,
     absl::string_view type) {
 
   /*
@@ -95,27 +190,28 @@ uint64_t outputStatType(
   // interface. If this assumption changes, the name comparisons in this function
   // will have to change to compare to convert all StatNames to strings before
   // comparison.
-  const Stats::SymbolTable& global_symbol_table = metrics.front()->constSymbolTable();
+  const Stats::SymbolTable& global_symbol_table = metricPtr(metrics.front())->constSymbolTable();
 
   // Sorted collection of metrics sorted by their tagExtractedName, to satisfy the requirements
   // of the exposition format.
   std::map<Stats::StatName, StatTypeUnsortedCollection, Stats::StatNameLessThan> groups(
       global_symbol_table);
 
-  for (const auto& metric : metrics) {
+  for (const auto& element : metrics) {
+    const StatType* metric = metricPtr(element);
     ASSERT(&global_symbol_table == &metric->constSymbolTable());
 
     if (!shouldShowMetric(*metric, used_only, regex)) {
       continue;
     }
 
-    groups[metric->tagExtractedStatName()].push_back(metric.get());
+    groups[metric->tagExtractedStatName()].push_back(metric);
   }
 
   for (auto& group : groups) {
     const std::string prefixed_tag_extracted_name =
         PrometheusStatsFormatter::metricName(global_symbol_table.toString(group.first));
-    response.add(fmt::format("# TYPE {0} {1}\n", prefixed_tag_extracted_name, type));
+    absl::StrAppend(&output.buffer(), "# TYPE ", prefixed_tag_extracted_name, " ", type, "\n");
 
     // Sort before producing the final output to satisfy the "preferred" ordering from the
     // prometheus spec: metrics will be sorted by their tags' textual representation, which will
@@ -123,37 +219,41 @@ uint64_t outputStatType(
     std::sort(group.second.begin(), group.second.end(), MetricLessThan());
 
     for (const auto& metric : group.second) {
-      response.add(generate_output(*metric, prefixed_tag_extracted_name));
+      generate_output(*metric, prefixed_tag_extracted_name, output);
+      output.maybeFlush();
     }
-    response.add("\n");
+    output.buffer().push_back('\n');
   }
   return groups.size();
 }
 
 /*
- * Return the prometheus output for a numeric Stat (Counter or Gauge).
+ * Append the prometheus output for a numeric Stat (Counter or Gauge).
  */
 template <class StatType>
-std::string generateNumericOutput(const StatType& metric,
-                                  const std::string& prefixed_tag_extracted_name) {
-  const std::string tags = PrometheusStatsFormatter::formattedTags(metric.tags());
-  return fmt::format("{0}{{{1}}} {2}\n", prefixed_tag_extracted_name, tags, metric.value());
+void generateNumericOutput(const StatType& metric, const std::string& prefixed_tag_extracted_name,
+                           PrometheusOutput& output) {
+  std::string& buffer = output.buffer();
+  absl::StrAppend(&buffer, prefixed_tag_extracted_name, "{");
+  output.appendTags(metric, buffer);
+  absl::StrAppend(&buffer, "} ", metric.value(), "\n");
 }
 
 /*
- * Returns the prometheus output for a histogram. The output is a multi-line string (with embedded
- * newlines) that contains all the individual bucket counts and sum/count for a single histogram
- * (metric_name plus all tags).
+ * Append the prometheus output for a histogram. The output is multiple lines that contain all the
+ * individual bucket counts and sum/count for a single histogram (metric_name plus all tags).
  */
-std::string generateHistogramOutput(const Stats::ParentHistogram& histogram,
-                                    const std::string& prefixed_tag_extracted_name) {
-  const std::string tags = PrometheusStatsFormatter::formattedTags(histogram.tags());
-  const std::string hist_tags = histogram.tags().empty() ? EMPTY_STRING : (tags + ",");
+void generateHistogramOutput(const Stats::ParentHistogram& histogram,
+                             const std::string& prefixed_tag_extracted_name,
+                             PrometheusOutput& output) {
+  std::string tags;
+  const bool has_tags = output.appendTags(histogram, tags);
+  const char* hist_tags_separator = has_tags ? "," : "";
 
   const Stats::HistogramStatistics& stats = histogram.cumulativeStatistics();
   Stats::ConstSupportedBuckets& supported_buckets = stats.supportedBuckets();
   const std::vector<uint64_t>& computed_buckets = stats.computedBuckets();
-  std::string output;
+  auto out = std::back_inserter(output.buffer());
   for (size_t i = 0; i < supported_buckets.size(); ++i) {
     double bucket = supported_buckets[i];
     uint64_t value = computed_buckets[i];
@@ -162,19 +262,17 @@ std::string generateHistogramOutput(const Stats::ParentHistogram& histogram,
     // 'g' operator which prints the number in general fixed point format or scientific format
     // with precision 50 to round the number up to 32 significant digits in fixed point format
     // which should cover pretty much all cases
-    output.append(fmt::format("{0}_bucket{{{1}le=\"{2:.32g}\"}} {3}\n", prefixed_tag_extracted_name,
-                              hist_tags, bucket, value));
+    fmt::format_to(out, "{0}_bucket{{{1}{2}le=\"{3:.32g}\"}} {4}\n", prefixed_tag_extracted_name,
+                   tags, hist_tags_separator, bucket, value);
   }
 
-  output.append(fmt::format("{0}_bucket{{{1}le=\"+Inf\"}} {2}\n", prefixed_tag_extracted_name,
-                            hist_tags, stats.sampleCount()));
-  output.append(fmt::format("{0}_sum{{{1}}} {2:.32g}\n", prefixed_tag_extracted_name, tags,
-                            stats.sampleSum()));
-  output.append(fmt::format("{0}_count{{{1}}} {2}\n", prefixed_tag_extracted_name, tags,
-                            stats.sampleCount()));
-
-  return output;
-};
+  fmt::format_to(out, "{0}_bucket{{{1}{2}le=\"+Inf\"}} {3}\n", prefixed_tag_extracted_name, tags,
+                 hist_tags_separator, stats.sampleCount());
+  fmt::format_to(out, "{0}_sum{{{1}}} {2:.32g}\n", prefixed_tag_extracted_name, tags,
+                 stats.sampleSum());
+  fmt::format_to(out, "{0}_count{{{1}}} {2}\n", prefixed_tag_extracted_name, tags,
+                 stats.sampleCount());
+}
 
 absl::flat_hash_set<std::string>& prometheusNamespaces() {
   MUTABLE_CONSTRUCT_ON_FIRST_USE(absl::flat_hash_set<std::string>);
@@ -214,16 +312,38 @@ uint64_t PrometheusStatsFormatter::statsAsPrometheus(
     const std::vector<Stats::ParentHistogramSharedPtr>& histograms, Buffer::Instance& response,
     const bool used_only, const absl::optional<std::regex>& regex) {
 
+  PrometheusOutput output(response);
   uint64_t metric_name_count = 0;
   metric_name_count += outputStatType<Stats::Counter>(
-      response, used_only, regex, counters, generateNumericOutput<Stats::Counter>, "counter");
+      output, used_only, regex, counters, generateNumericOutput<Stats::Counter>, "counter");
+
+  metric_name_count += outputStatType<Stats::Gauge>(output, used_only, regex, gauges,
+                                                    generateNumericOutput<Stats::Gauge>, "gauge");
+
+  metric_name_count += outputStatType<Stats::ParentHistogram>(
+      output, used_only, regex, histograms, generateHistogramOutput, "histogram");
+
+  output.flush();
+  return metric_name_count;
+}
+
+uint64_t PrometheusStatsFormatter::statsAsPrometheus(Stats::MetricSnapshot& snapshot,
+                                                     Buffer::Instance& response,
+                                                     const bool used_only) {
+  PrometheusOutput output(response);
+  const absl::optional<std::regex> regex;
+  uint64_t metric_name_count = 0;
+  metric_name_count +=
+      outputStatType<Stats::Counter>(output, used_only, regex, snapshot.counters(),
+                                     generateNumericOutput<Stats::Counter>, "counter");
 
-  metric_name_count += outputStatType<Stats::Gauge>(response, used_only, regex, gauges,
+  metric_name_count += outputStatType<Stats::Gauge>(output, used_only, regex, snapshot.gauges(),
                                                     generateNumericOutput<Stats::Gauge>, "gauge");
 
   metric_name_count += outputStatType<Stats::ParentHistogram>(
-      response, used_only, regex, histograms, generateHistogramOutput, "histogram");
+      output, used_only, regex, snapshot.histograms(), generateHistogramOutput, "histogram");
 
+  output.flush();
   return metric_name_count;
 }
 
@@ -5,6 +5,7 @@
 
 #include "envoy/buffer/buffer.h"
 #include "envoy/stats/histogram.h"
+#include "envoy/stats/sink.h"
 #include "envoy/stats/stats.h"
 
 namespace Envoy {
@@ -26,6 +27,14 @@ public:
                                     const std::vector<Stats::ParentHistogramSharedPtr>& histograms,
                                     Buffer::Instance& response, const bool used_only,
                                     const absl::optional<std::regex>& regex);
+  /**
+   * Appends the counters, gauges and histograms of a stats snapshot to the response in the same
+   * format as the overload above.
+   * @return uint64_t total number of metric types inserted in response.
+   */
+  static uint64_t statsAsPrometheus(Stats::MetricSnapshot& snapshot, Buffer::Instance& response,
+                                    const bool used_only);
+
   /**
    * Format the given tags, returning a string as a comma-separated list
    * of <tag_name>="<tag_value>" pairs.
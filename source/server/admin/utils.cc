@@ -68,6 +68,36 @@ absl::optional<std::string> queryParam(const Http::Utility::QueryParams& params,
                                             : absl::nullopt;
 }
 
+namespace {
+
+template <class StatType>
+uint64_t countStats(const Stats::Scope& scope, uint64_t& name_bytes) {
+  uint64_t count = 0;
+  scope.iterate(Stats::IterateFn<StatType>([&count, &name_bytes](
+                                               const Stats::RefcountPtr<StatType>& metric) {
+    ++count;
+    name_bytes += metric->statName().size() + metric->tagExtractedStatName().size();
+    return true;
+  }));
+  return count;
+}
+
+} // namespace
+
+void addStatsFootprintAsText(absl::string_view name, const Stats::Scope& scope,
+                             Buffer::Instance& response) {
+  uint64_t name_bytes = 0;
+  response.add(fmt::format("{}::stats_counters::{}\n", name,
+                           countStats<Stats::Counter>(scope, name_bytes)));
+  response.add(
+      fmt::format("{}::stats_gauges::{}\n", name, countStats<Stats::Gauge>(scope, name_bytes)));
+  response.add(fmt::format("{}::stats_histograms::{}\n", name,
+                           countStats<Stats::Histogram>(scope, name_bytes)));
+  response.add(fmt::format("{}::stats_text_readouts::{}\n", name,
+                           countStats<Stats::TextReadout>(scope, name_bytes)));
+  response.add(fmt::format("{}::stat_name_bytes::{}\n", name, name_bytes));
+}
+
 } // namespace Utility
 } // namespace Server
 } // namespace Envoy
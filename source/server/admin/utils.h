@@ -4,6 +4,7 @@
 
 #include "envoy/admin/v3/server_info.pb.h"
 #include "envoy/init/manager.h"
+#include "envoy/stats/scope.h"
 
 #include "common/http/codes.h"
 #include "common/http/header_map_impl.h"
@@ -26,6 +27,14 @@ absl::optional<std::string> formatParam(const Http::Utility::QueryParams& params
 absl::optional<std::string> queryParam(const Http::Utility::QueryParams& params,
                                        const std::string& key);
 
+/**
+ * Appends the number of stats of each type in a scope, and the bytes taken by their symbolized
+ * names, as <name>::stats_<type>::<count> and <name>::stat_name_bytes::<bytes> lines. This
+ * attributes the memory of a scope's stats to the cluster or listener owning it.
+ */
+void addStatsFootprintAsText(absl::string_view name, const Stats::Scope& scope,
+                             Buffer::Instance& response);
+
 } // namespace Utility
 } // namespace Server
 } // namespace Envoy
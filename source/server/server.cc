@@ -1,10 +1,12 @@
 #include "server/server.h"
 
+#include <algorithm>
 #include <csignal>
 #include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "envoy/admin/v3/config_dump.pb.h"
 #include "envoy/common/exception.h"
@@ -23,6 +25,7 @@
 
 #include "common/api/api_impl.h"
 #include "common/api/os_sys_calls_impl.h"
+#include "common/buffer/buffer_impl.h"
 #include "common/common/enum_to_int.h"
 #include "common/common/mutex_tracer_impl.h"
 #include "common/common/utility.h"
@@ -37,6 +40,7 @@
 #include "common/network/tcp_listener_impl.h"
 #include "common/protobuf/utility.h"
 #include "common/router/rds_impl.h"
+#include "common/runtime/runtime_features.h"
 #include "common/runtime/runtime_impl.h"
 #include "common/singleton/manager_impl.h"
 #include "common/stats/thread_local_store.h"
@@ -147,11 +151,14 @@ void InstanceImpl::failHealthcheck(bool fail) {
   server_stats_->live_.set(live_.load());
 }
 
-MetricSnapshotImpl::MetricSnapshotImpl(Stats::Store& store) {
+MetricSnapshotImpl::MetricSnapshotImpl(Stats::Store& store, bool track_changes) {
   snapped_counters_ = store.counters();
   counters_.reserve(snapped_counters_.size());
   for (const auto& counter : snapped_counters_) {
     counters_.push_back({counter->latch(), *counter});
+    if (track_changes && counters_.back().delta_ > 0) {
+      changed_metrics_.counters_.push_back(counters_.back());
+    }
   }
 
   snapped_gauges_ = store.gauges();
@@ -159,12 +166,20 @@ MetricSnapshotImpl::MetricSnapshotImpl(Stats::Store& store) {
   for (const auto& gauge : snapped_gauges_) {
     ASSERT(gauge->importMode() != Stats::Gauge::ImportMode::Uninitialized);
     gauges_.push_back(*gauge);
+    // Gauges are latched even if no sink is interested in changes, so that a sink opting in later
+    // does not see every gauge updated since the server started as changed.
+    if (gauge->latchChanged() && track_changes) {
+      changed_metrics_.gauges_.push_back(*gauge);
+    }
   }
 
   snapped_histograms_ = store.histograms();
   histograms_.reserve(snapped_histograms_.size());
   for (const auto& histogram : snapped_histograms_) {
     histograms_.push_back(*histogram);
+    if (track_changes && histogram->intervalStatistics().sampleCount() > 0) {
+      changed_metrics_.histograms_.push_back(*histogram);
+    }
   }
 
   snapped_text_readouts_ = store.textReadouts();
@@ -180,9 +195,19 @@ void InstanceUtil::flushMetricsToSinks(const std::list<Stats::SinkPtr>& sinks,
   // NOTE: Even if there are no sinks, creating the snapshot has the important property that it
   //       latches all counters on a periodic basis. The hot restart code assumes this is being
   //       done so this should not be removed.
-  MetricSnapshotImpl snapshot(store);
+  // Ask each sink only once per flush, as the answer may come from a runtime lookup.
+  std::vector<bool> changed_metrics_only;
+  changed_metrics_only.reserve(sinks.size());
+  for (const auto& sink : sinks) {
+    changed_metrics_only.push_back(sink->flushChangedMetricsOnly());
+  }
+  const bool track_changes =
+      std::find(changed_metrics_only.begin(), changed_metrics_only.end(), true) !=
+      changed_metrics_only.end();
+  MetricSnapshotImpl snapshot(store, track_changes);
+  auto changed_only = changed_metrics_only.begin();
   for (const auto& sink : sinks) {
-    sink->flush(snapshot);
+    sink->flush(*changed_only++ ? snapshot.changedMetrics() : snapshot);
   }
 }
 
@@ -211,6 +236,17 @@ void InstanceImpl::updateServerStats() {
                                        parent_stats.parent_memory_allocated_);
   server_stats_->memory_heap_size_.set(Memory::Stats::totalCurrentlyReserved());
   server_stats_->memory_physical_size_.set(Memory::Stats::totalPhysicalBytes());
+  // The slice cache runtime guard is re-evaluated on every stats update so that it can be flipped
+  // without a restart.
+  Buffer::SliceAllocator::setCacheEnabled(
+      Runtime::runtimeFeatureEnabled("envoy.reloadable_features.buffer_slice_cache"));
+  const Buffer::SliceAllocator::Stats slice_cache_stats = Buffer::SliceAllocator::stats();
+  server_stats_->buffer_slice_cache_hits_.add(slice_cache_stats.hits_ - last_slice_cache_hits_);
+  server_stats_->buffer_slice_cache_misses_.add(slice_cache_stats.misses_ -
+                                                last_slice_cache_misses_);
+  last_slice_cache_hits_ = slice_cache_stats.hits_;
+  last_slice_cache_misses_ = slice_cache_stats.misses_;
+  server_stats_->buffer_slice_cache_retained_bytes_.set(slice_cache_stats.retained_bytes_);
   server_stats_->parent_connections_.set(parent_stats.parent_connections_);
   server_stats_->total_connections_.set(listener_manager_->numConnections() +
                                         parent_stats.parent_connections_);
@@ -333,6 +369,9 @@ void InstanceImpl::initialize(const Options& options,
   stats_store_.setTagProducer(Config::Utility::createTagProducer(bootstrap_));
   stats_store_.setStatsMatcher(Config::Utility::createStatsMatcher(bootstrap_));
   stats_store_.setHistogramSettings(Config::Utility::createHistogramSettings(bootstrap_));
+  const auto& sharded_counter_names = bootstrap_.stats_config().sharded_counter_names();
+  stats_store_.setShardedCounterNames(
+      std::vector<std::string>(sharded_counter_names.begin(), sharded_counter_names.end()));
 
   const std::string server_stats_prefix = "server.";
   server_stats_ = std::make_unique<ServerStats>(
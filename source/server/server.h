@@ -57,6 +57,9 @@ namespace Server {
   COUNTER(envoy_bug_failures)                                                                      \
   COUNTER(dynamic_unknown_fields)                                                                  \
   COUNTER(static_unknown_fields)                                                                   \
+  COUNTER(buffer_slice_cache_hits)                                                                 \
+  COUNTER(buffer_slice_cache_misses)                                                               \
+  GAUGE(buffer_slice_cache_retained_bytes, NeverImport)                                            \
   GAUGE(concurrency, NeverImport)                                                                  \
   GAUGE(days_until_first_cert_expiring, Accumulate)                                                \
   GAUGE(seconds_until_first_ocsp_response_expiring, Accumulate)                                    \
@@ -320,6 +323,9 @@ private:
   time_t original_start_time_;
   Stats::StoreRoot& stats_store_;
   std::unique_ptr<ServerStats> server_stats_;
+  // Buffer::SliceAllocator totals as of the last stats update, used to latch deltas into counters.
+  uint64_t last_slice_cache_hits_{};
+  uint64_t last_slice_cache_misses_{};
   Assert::ActionRegistrationPtr assert_action_registration_;
   Assert::ActionRegistrationPtr envoy_bug_action_registration_;
   ThreadLocal::Instance& thread_local_;
@@ -383,7 +389,13 @@ private:
 //                     copying and probably be a cleaner API in general.
 class MetricSnapshotImpl : public Stats::MetricSnapshot {
 public:
-  explicit MetricSnapshotImpl(Stats::Store& store);
+  /**
+   * Snapshot all metrics in a store, latching its counters and gauges.
+   * @param store supplies the store to snapshot.
+   * @param track_changes supplies whether to also collect the metrics that changed since the
+   *        previous snapshot, for sinks that only flush those.
+   */
+  explicit MetricSnapshotImpl(Stats::Store& store, bool track_changes = false);
 
   // Stats::MetricSnapshot
   const std::vector<CounterSnapshot>& counters() override { return counters_; }
@@ -397,7 +409,37 @@ public:
     return text_readouts_;
   }
 
+  /**
+   * @return a view of the snapshot with only the metrics that changed since the previous snapshot.
+   *         Only populated if the snapshot was taken with track_changes set.
+   */
+  Stats::MetricSnapshot& changedMetrics() { return changed_metrics_; }
+
 private:
+  class ChangedMetrics : public Stats::MetricSnapshot {
+  public:
+    explicit ChangedMetrics(MetricSnapshotImpl& parent) : parent_(parent) {}
+
+    // Stats::MetricSnapshot
+    const std::vector<CounterSnapshot>& counters() override { return counters_; }
+    const std::vector<std::reference_wrapper<const Stats::Gauge>>& gauges() override {
+      return gauges_;
+    }
+    const std::vector<std::reference_wrapper<const Stats::ParentHistogram>>&
+    histograms() override {
+      return histograms_;
+    }
+    const std::vector<std::reference_wrapper<const Stats::TextReadout>>& textReadouts() override {
+      // Text readouts carry no record of whether they changed.
+      return parent_.textReadouts();
+    }
+
+    MetricSnapshotImpl& parent_;
+    std::vector<CounterSnapshot> counters_;
+    std::vector<std::reference_wrapper<const Stats::Gauge>> gauges_;
+    std::vector<std::reference_wrapper<const Stats::ParentHistogram>> histograms_;
+  };
+
   std::vector<Stats::CounterSharedPtr> snapped_counters_;
   std::vector<CounterSnapshot> counters_;
   std::vector<Stats::GaugeSharedPtr> snapped_gauges_;
@@ -406,6 +448,7 @@ private:
   std::vector<std::reference_wrapper<const Stats::ParentHistogram>> histograms_;
   std::vector<Stats::TextReadoutSharedPtr> snapped_text_readouts_;
   std::vector<std::reference_wrapper<const Stats::TextReadout>> text_readouts_;
+  ChangedMetrics changed_metrics_{*this};
 };
 
 } // namespace Server
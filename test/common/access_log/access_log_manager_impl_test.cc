@@ -11,6 +11,7 @@
 #include "test/test_common/test_time.h"
 #include "test/test_common/utility.h"
 
+#include "absl/container/flat_hash_map.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
@@ -158,9 +159,9 @@ TEST_F(AccessLogManagerImplTest, FlushToLogFileOnDemand) {
 
   EXPECT_CALL(*timer, enableTimer(timeout_40ms_, _));
 
-  // The first write to a given file will start the flush thread. Because AccessManagerImpl::write
-  // holds the write_lock_ when the thread is started, the thread will flush on its first loop, once
-  // it obtains the write_lock_. Perform a write to get all that out of the way.
+  // The first write to a given file will start the flush thread. Because AccessLogFileImpl::write
+  // adds the data before the thread is started, the thread will flush on its first loop. Perform a
+  // write to get all that out of the way.
   EXPECT_CALL(*file_, write_(_))
       .WillOnce(Invoke([](absl::string_view data) -> Api::IoCallSizeResult {
         return Filesystem::resultSuccess<ssize_t>(static_cast<ssize_t>(data.length()));
@@ -443,6 +444,48 @@ TEST_F(AccessLogManagerImplTest, BigDataChunkShouldBeFlushedWithoutTimer) {
   EXPECT_CALL(*file_, close_()).WillOnce(Return(ByMove(Filesystem::resultSuccess<bool>(true))));
 }
 
+TEST_F(AccessLogManagerImplTest, ConcurrentWritesAreAllFlushed) {
+  EXPECT_CALL(*file_, open_(_)).WillOnce(Return(ByMove(Filesystem::resultSuccess<bool>(true))));
+  AccessLogFileSharedPtr log_file = access_log_manager_.createAccessLog("foo");
+
+  constexpr uint32_t NumThreads = 8;
+  constexpr uint32_t NumWritesPerThread = 1000;
+  Thread::MutexBasicLockable data_lock;
+  absl::flat_hash_map<char, std::string> written;
+  EXPECT_CALL(*file_, write_(_))
+      .WillRepeatedly(Invoke([&](absl::string_view data) -> Api::IoCallSizeResult {
+        Thread::LockGuard lock(data_lock);
+        for (const char c : data) {
+          written[c].push_back(c);
+        }
+        return Filesystem::resultSuccess<ssize_t>(static_cast<ssize_t>(data.length()));
+      }));
+
+  std::vector<Thread::ThreadPtr> threads;
+  for (uint32_t i = 0; i < NumThreads; i++) {
+    threads.push_back(thread_factory_.createThread([&log_file, i]() {
+      const std::string line(1, static_cast<char>('a' + i));
+      for (uint32_t j = 0; j < NumWritesPerThread; j++) {
+        log_file->write(line);
+      }
+    }));
+  }
+  for (Thread::ThreadPtr& thread : threads) {
+    thread->join();
+  }
+  log_file->flush();
+
+  EXPECT_EQ(NumThreads * NumWritesPerThread, store_.counter("filesystem.write_buffered").value());
+  {
+    Thread::LockGuard lock(data_lock);
+    EXPECT_EQ(NumThreads, written.size());
+    for (uint32_t i = 0; i < NumThreads; i++) {
+      EXPECT_EQ(NumWritesPerThread, written[static_cast<char>('a' + i)].size());
+    }
+  }
+  EXPECT_CALL(*file_, close_()).WillOnce(Return(ByMove(Filesystem::resultSuccess<bool>(true))));
+}
+
 TEST_F(AccessLogManagerImplTest, ReopenAllFiles) {
   EXPECT_CALL(dispatcher_, createTimer_(_)).WillRepeatedly(ReturnNew<NiceMock<Event::MockTimer>>());
 
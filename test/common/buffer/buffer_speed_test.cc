@@ -1,3 +1,5 @@
+#include <vector>
+
 #include "common/buffer/buffer_impl.h"
 #include "common/common/assert.h"
 
@@ -36,6 +38,30 @@ static void bufferCreate(benchmark::State& state) {
 }
 BENCHMARK(bufferCreate)->Arg(1)->Arg(4096)->Arg(16384)->Arg(65536);
 
+// Test the allocation and release of batches of slices. Single-page slices and slices sized for a
+// 16KiB read are recycled through the per-thread slice cache; 64KiB slices always go to the heap
+// and serve as a baseline.
+static void sliceCreateDestroy(benchmark::State& state) {
+  const uint64_t size = state.range(0);
+  const uint64_t batch_size = state.range(1);
+  std::vector<Buffer::SlicePtr> slices;
+  slices.reserve(batch_size);
+  for (auto _ : state) {
+    for (uint64_t i = 0; i < batch_size; i++) {
+      slices.emplace_back(Buffer::OwnedSlice::create(size));
+    }
+    slices.clear();
+  }
+  benchmark::DoNotOptimize(slices.size());
+}
+BENCHMARK(sliceCreateDestroy)
+    ->Args({1, 1})
+    ->Args({1, 32})
+    ->Args({16384, 1})
+    ->Args({16384, 8})
+    ->Args({65536, 1})
+    ->Args({65536, 8});
+
 // Grow an OwnedImpl in very small amounts.
 static void bufferAddSmallIncrement(benchmark::State& state) {
   const std::string data("a");
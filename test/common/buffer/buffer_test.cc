@@ -1,4 +1,5 @@
 #include <limits>
+#include <vector>
 
 #include "envoy/common/exception.h"
 
@@ -191,6 +192,117 @@ TEST_F(OwnedSliceTest, Drain) {
   EXPECT_EQ(original_size, slice->reservableSize());
 }
 
+TEST_F(OwnedSliceTest, RecyclesCachedSizes) {
+  // Hold one block so that the thread's cache is guaranteed to have room for the next free.
+  auto held = OwnedSlice::create(100);
+  auto slice = OwnedSlice::create(100);
+  const void* original_data = slice->data();
+  slice.reset();
+
+  const SliceAllocator::Stats before = SliceAllocator::stats();
+  slice = OwnedSlice::create(100);
+  EXPECT_EQ(original_data, slice->data());
+  EXPECT_EQ(0, slice->dataSize());
+  const SliceAllocator::Stats after = SliceAllocator::stats();
+  EXPECT_EQ(before.hits_ + 1, after.hits_);
+  EXPECT_EQ(before.misses_, after.misses_);
+  EXPECT_EQ(before.retained_bytes_ - 4096, after.retained_bytes_);
+}
+
+TEST_F(OwnedSliceTest, RecyclesReadReservationSize) {
+  // A 16KiB read reservation is backed by exactly five pages.
+  auto held = OwnedSlice::create(16384);
+  auto slice = OwnedSlice::create(16384);
+  EXPECT_EQ(20480 - sizeof(OwnedSlice), slice->reservableSize());
+  const void* original_data = slice->data();
+  slice.reset();
+
+  const SliceAllocator::Stats before = SliceAllocator::stats();
+  slice = OwnedSlice::create(16384);
+  EXPECT_EQ(original_data, slice->data());
+  const SliceAllocator::Stats after = SliceAllocator::stats();
+  EXPECT_EQ(before.hits_ + 1, after.hits_);
+  EXPECT_EQ(before.retained_bytes_ - 20480, after.retained_bytes_);
+}
+
+TEST_F(OwnedSliceTest, CapacityForAllocation) {
+  for (uint64_t allocation_size : {4096, 20480, 40960, 81920}) {
+    const uint64_t capacity = OwnedSlice::capacityForAllocation(allocation_size);
+    auto held = OwnedSlice::create(capacity);
+    auto slice = OwnedSlice::create(capacity);
+    EXPECT_EQ(capacity, slice->reservableSize());
+    slice.reset();
+
+    const SliceAllocator::Stats before = SliceAllocator::stats();
+    slice = OwnedSlice::create(capacity);
+    const SliceAllocator::Stats after = SliceAllocator::stats();
+    EXPECT_EQ(before.hits_ + 1, after.hits_);
+    EXPECT_EQ(before.retained_bytes_ - allocation_size, after.retained_bytes_);
+  }
+}
+
+TEST_F(OwnedSliceTest, DrainTrackerFreesAnotherSlice) {
+  auto held = OwnedSlice::create(100);
+  auto slice = OwnedSlice::create(100);
+  SlicePtr large = OwnedSlice::create(65536);
+  slice->addDrainTracker([&large]() { large.reset(); });
+  const void* original_data = slice->data();
+
+  // Freeing the large slice from the drain tracker must not change the size the outer slice is
+  // returned to the allocator with.
+  slice.reset();
+  EXPECT_EQ(nullptr, large);
+  const SliceAllocator::Stats before = SliceAllocator::stats();
+  slice = OwnedSlice::create(100);
+  EXPECT_EQ(original_data, slice->data());
+  const SliceAllocator::Stats after = SliceAllocator::stats();
+  EXPECT_EQ(before.hits_ + 1, after.hits_);
+  EXPECT_EQ(before.retained_bytes_ - 4096, after.retained_bytes_);
+}
+
+TEST_F(OwnedSliceTest, LargeSlicesBypassCache) {
+  const SliceAllocator::Stats before = SliceAllocator::stats();
+  OwnedSlice::create(65536).reset();
+  const SliceAllocator::Stats after = SliceAllocator::stats();
+  EXPECT_EQ(before.hits_, after.hits_);
+  EXPECT_EQ(before.misses_, after.misses_);
+  EXPECT_EQ(before.retained_bytes_, after.retained_bytes_);
+}
+
+TEST_F(OwnedSliceTest, CacheRetentionIsBounded) {
+  const uint64_t max_cached = SliceAllocator::MaxRetainedBytesPerSize / 4096;
+  const uint64_t num_slices = max_cached + 8;
+  std::vector<SlicePtr> slices;
+  // Allocating more slices than the cache can hold empties it; freeing them refills it to the limit.
+  for (uint64_t i = 0; i < num_slices; i++) {
+    slices.emplace_back(OwnedSlice::create(100));
+  }
+  slices.clear();
+
+  const SliceAllocator::Stats before = SliceAllocator::stats();
+  for (uint64_t i = 0; i < num_slices; i++) {
+    slices.emplace_back(OwnedSlice::create(100));
+  }
+  const SliceAllocator::Stats after = SliceAllocator::stats();
+  EXPECT_EQ(before.hits_ + max_cached, after.hits_);
+  EXPECT_EQ(before.misses_ + 8, after.misses_);
+  EXPECT_EQ(before.retained_bytes_ - SliceAllocator::MaxRetainedBytesPerSize,
+            after.retained_bytes_);
+}
+
+TEST_F(OwnedSliceTest, CacheDisabled) {
+  // Make sure the thread's cache has a block of the right size before disabling it.
+  OwnedSlice::create(100).reset();
+  SliceAllocator::setCacheEnabled(false);
+  const SliceAllocator::Stats before = SliceAllocator::stats();
+  OwnedSlice::create(100).reset();
+  const SliceAllocator::Stats after = SliceAllocator::stats();
+  SliceAllocator::setCacheEnabled(true);
+  EXPECT_EQ(before.hits_, after.hits_);
+  EXPECT_EQ(before.misses_, after.misses_);
+  EXPECT_EQ(before.retained_bytes_, after.retained_bytes_);
+}
+
 TEST(UnownedSliceTest, CreateDelete) {
   constexpr char input[] = "hello world";
   bool release_callback_called = false;
@@ -7,6 +7,7 @@
 #include "test/test_common/test_runtime.h"
 #include "test/test_common/utility.h"
 
+#include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
 namespace Envoy {
@@ -157,6 +158,40 @@ TEST(Utility, ParseRegex) {
   }
 }
 
+TEST(GoogleReSet, InvalidRegex) {
+  EXPECT_THROW_WITH_REGEX(GoogleReSet({"/foo", "(+invalid)"}), EnvoyException,
+                          "Invalid regex '\\(\\+invalid\\)': .+");
+}
+
+TEST(GoogleReSet, CompileOutOfMemory) {
+  std::vector<std::string> regexes;
+  for (int i = 0; i < 1000; i++) {
+    regexes.push_back("/route" + std::to_string(i) +
+                      "/[a-z]{1,30}/[0-9]{1,30}/[a-f]{1,30}/[g-z]{1,30}");
+  }
+  EXPECT_THROW_WITH_MESSAGE(GoogleReSet{regexes}, EnvoyException,
+                            "unable to compile regex set: out of memory");
+}
+
+TEST(GoogleReSet, FullMatch) {
+  const GoogleReSet set({"/foo/.*", "/foo/bar", "/[a-z]+/[0-9]+", "/baz"});
+  std::vector<int> matches;
+
+  EXPECT_TRUE(set.match("/foo/bar", matches));
+  EXPECT_THAT(matches, testing::UnorderedElementsAre(0, 1));
+
+  EXPECT_TRUE(set.match("/foo/123", matches));
+  EXPECT_THAT(matches, testing::UnorderedElementsAre(0, 2));
+
+  // Matches must cover the whole value, as with Utility::parseRegex().
+  EXPECT_TRUE(set.match("/foo/barbaz", matches));
+  EXPECT_THAT(matches, testing::ElementsAre(0));
+  EXPECT_TRUE(set.match("/baz/", matches));
+  EXPECT_THAT(matches, testing::IsEmpty());
+  EXPECT_TRUE(set.match("prefix/baz", matches));
+  EXPECT_THAT(matches, testing::IsEmpty());
+}
+
 } // namespace
 } // namespace Regex
 } // namespace Envoy
@@ -146,10 +146,12 @@ TEST_F(ThreadAsyncPtrTest, ThreadSpammer) {
 TEST_F(ThreadAsyncPtrTest, Null) {
   AtomicPtr<std::string, AtomicPtrAllocMode::DeleteOnDestruct> str;
   uint32_t calls = 0;
+  EXPECT_TRUE(str.isNull());
   EXPECT_EQ(nullptr, str.get([&calls]() -> std::string* {
     ++calls;
     return nullptr;
   }));
+  EXPECT_TRUE(str.isNull());
   EXPECT_EQ(nullptr, str.get([&calls]() -> std::string* {
     ++calls;
     return nullptr;
@@ -160,6 +162,7 @@ TEST_F(ThreadAsyncPtrTest, Null) {
     return new std::string("x");
   }));
   EXPECT_EQ(3, calls);
+  EXPECT_FALSE(str.isNull());
   EXPECT_EQ("x", *str.get([&calls]() -> std::string* {
     ++calls;
     return nullptr;
@@ -3,6 +3,7 @@
 
 #include "test/common/stream_info/test_util.h"
 #include "test/mocks/http/mocks.h"
+#include "test/test_common/test_runtime.h"
 
 #include "benchmark/benchmark.h"
 
@@ -10,7 +11,8 @@ namespace Envoy {
 
 namespace {
 
-std::unique_ptr<Envoy::Formatter::JsonFormatterImpl> makeJsonFormatter(bool typed) {
+std::unique_ptr<Envoy::Formatter::JsonFormatterImpl> makeJsonFormatter(bool typed,
+                                                                        bool direct_serialization) {
   ProtobufWkt::Struct JsonLogFormat;
   const std::string format_yaml = R"EOF(
     remote_address: '%DOWNSTREAM_REMOTE_ADDRESS_WITHOUT_PORT%'
@@ -25,9 +27,23 @@ std::unique_ptr<Envoy::Formatter::JsonFormatterImpl> makeJsonFormatter(bool type
     user-agent: '%REQ(USER-AGENT)%'
   )EOF";
   TestUtility::loadFromYaml(format_yaml, JsonLogFormat);
+  TestScopedRuntime scoped_runtime;
+  Runtime::LoaderSingleton::getExisting()->mergeValues(
+      {{"envoy.reloadable_features.json_access_log_direct_serialization",
+        direct_serialization ? "true" : "false"}});
   return std::make_unique<Envoy::Formatter::JsonFormatterImpl>(JsonLogFormat, typed, false);
 }
 
+Http::TestRequestHeaderMapImpl makeRequestHeaders() {
+  return {{":method", "GET"},
+          {":authority", "www.example.com"},
+          {":path", "/static/js/app.js?v=20201018"},
+          {"x-forwarded-proto", "https"},
+          {"referer", "https://www.example.com/products/category/item?id=123456"},
+          {"user-agent", "Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko) "
+                         "Chrome/86.0.4240.75 Safari/537.36"}};
+}
+
 std::unique_ptr<Envoy::TestStreamInfo> makeStreamInfo() {
   auto stream_info = std::make_unique<Envoy::TestStreamInfo>();
   stream_info->setDownstreamRemoteAddress(
@@ -50,7 +66,7 @@ static void BM_AccessLogFormatter(benchmark::State& state) {
       std::make_unique<Envoy::Formatter::FormatterImpl>(LogFormat, false);
 
   size_t output_bytes = 0;
-  Http::TestRequestHeaderMapImpl request_headers;
+  Http::TestRequestHeaderMapImpl request_headers = makeRequestHeaders();
   Http::TestResponseHeaderMapImpl response_headers;
   Http::TestResponseTrailerMapImpl response_trailers;
   std::string body;
@@ -60,16 +76,18 @@ static void BM_AccessLogFormatter(benchmark::State& state) {
             .length();
   }
   benchmark::DoNotOptimize(output_bytes);
+  state.SetBytesProcessed(output_bytes);
 }
 BENCHMARK(BM_AccessLogFormatter);
 
 // NOLINTNEXTLINE(readability-identifier-naming)
 static void BM_JsonAccessLogFormatter(benchmark::State& state) {
   std::unique_ptr<Envoy::TestStreamInfo> stream_info = makeStreamInfo();
-  std::unique_ptr<Envoy::Formatter::JsonFormatterImpl> json_formatter = makeJsonFormatter(false);
+  std::unique_ptr<Envoy::Formatter::JsonFormatterImpl> json_formatter =
+      makeJsonFormatter(false, state.range(0));
 
   size_t output_bytes = 0;
-  Http::TestRequestHeaderMapImpl request_headers;
+  Http::TestRequestHeaderMapImpl request_headers = makeRequestHeaders();
   Http::TestResponseHeaderMapImpl response_headers;
   Http::TestResponseTrailerMapImpl response_trailers;
   std::string body;
@@ -80,17 +98,19 @@ static void BM_JsonAccessLogFormatter(benchmark::State& state) {
             .length();
   }
   benchmark::DoNotOptimize(output_bytes);
+  state.SetBytesProcessed(output_bytes);
 }
-BENCHMARK(BM_JsonAccessLogFormatter);
+// Arg 0 serializes the log line through a ProtobufWkt::Struct, arg 1 writes it directly.
+BENCHMARK(BM_JsonAccessLogFormatter)->Arg(0)->Arg(1);
 
 // NOLINTNEXTLINE(readability-identifier-naming)
 static void BM_TypedJsonAccessLogFormatter(benchmark::State& state) {
   std::unique_ptr<Envoy::TestStreamInfo> stream_info = makeStreamInfo();
   std::unique_ptr<Envoy::Formatter::JsonFormatterImpl> typed_json_formatter =
-      makeJsonFormatter(true);
+      makeJsonFormatter(true, state.range(0));
 
   size_t output_bytes = 0;
-  Http::TestRequestHeaderMapImpl request_headers;
+  Http::TestRequestHeaderMapImpl request_headers = makeRequestHeaders();
   Http::TestResponseHeaderMapImpl response_headers;
   Http::TestResponseTrailerMapImpl response_trailers;
   std::string body;
@@ -101,7 +121,8 @@ static void BM_TypedJsonAccessLogFormatter(benchmark::State& state) {
             .length();
   }
   benchmark::DoNotOptimize(output_bytes);
+  state.SetBytesProcessed(output_bytes);
 }
-BENCHMARK(BM_TypedJsonAccessLogFormatter);
+BENCHMARK(BM_TypedJsonAccessLogFormatter)->Arg(0)->Arg(1);
 
 } // namespace Envoy
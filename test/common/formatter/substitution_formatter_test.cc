@@ -19,6 +19,7 @@
 #include "test/mocks/ssl/mocks.h"
 #include "test/mocks/stream_info/mocks.h"
 #include "test/test_common/printers.h"
+#include "test/test_common/test_runtime.h"
 #include "test/test_common/threadsafe_singleton_injector.h"
 #include "test/test_common/utility.h"
 
@@ -1863,6 +1864,130 @@ TEST(SubstitutionFormatterTest, JsonFormatterTypedFilterStateTest) {
             fields.at("test_obj").struct_value().fields().at("inner_key").string_value());
 }
 
+// The direct JSON writer should produce the same log line as serializing a Struct, other than in
+// the order of the keys.
+TEST(SubstitutionFormatterTest, JsonFormatterDirectSerializationMatchesStruct) {
+  NiceMock<StreamInfo::MockStreamInfo> stream_info;
+  Http::TestRequestHeaderMapImpl request_headers{
+      {":method", "GET"},
+      {"x-escaped", "a \"quoted\" <value> with \\ and \t\x7f"},
+      {"x-unicode", "caf\xc3\xa9 \xe2\x80\xa8"}};
+  Http::TestResponseHeaderMapImpl response_headers;
+  Http::TestResponseTrailerMapImpl response_trailers;
+  std::string body;
+  stream_info.response_code_ = 200;
+
+  envoy::config::core::v3::Metadata metadata;
+  populateMetadataTestData(metadata);
+  EXPECT_CALL(stream_info, dynamicMetadata()).WillRepeatedly(ReturnRef(metadata));
+  EXPECT_CALL(Const(stream_info), dynamicMetadata()).WillRepeatedly(ReturnRef(metadata));
+
+  ProtobufWkt::Struct key_mapping;
+  TestUtility::loadFromYaml(R"EOF(
+    method: '%REQ(:METHOD)%'
+    escaped: '%REQ(X-ESCAPED)%'
+    unicode: '%REQ(X-UNICODE)%'
+    missing: '%REQ(X-MISSING)%'
+    code: '%RESPONSE_CODE%'
+    combined: '%REQ(:METHOD)% %REQ(X-MISSING)% %RESPONSE_CODE%'
+    "key \"<with>\" escapes": plain
+    metadata: '%DYNAMIC_METADATA(com.test)%'
+    nested:
+      code: '%RESPONSE_CODE%'
+      missing: '%REQ(X-MISSING)%'
+  )EOF",
+                            key_mapping);
+
+  for (const bool preserve_types : {false, true}) {
+    for (const bool omit_empty_values : {false, true}) {
+      SCOPED_TRACE(absl::StrCat("preserve_types: ", preserve_types,
+                                " omit_empty_values: ", omit_empty_values));
+      std::string json[2];
+      for (const bool direct_serialization : {false, true}) {
+        TestScopedRuntime scoped_runtime;
+        Runtime::LoaderSingleton::getExisting()->mergeValues(
+            {{"envoy.reloadable_features.json_access_log_direct_serialization",
+              direct_serialization ? "true" : "false"}});
+        JsonFormatterImpl formatter(key_mapping, preserve_types, omit_empty_values);
+        json[direct_serialization] =
+            formatter.format(request_headers, response_headers, response_trailers, stream_info,
+                             body);
+      }
+
+      ProtobufWkt::Struct expected;
+      MessageUtil::loadFromJson(json[0], expected);
+      ProtobufWkt::Struct actual;
+      MessageUtil::loadFromJson(json[1], actual);
+      EXPECT_TRUE(TestUtility::protoEqual(expected, actual)) << json[0] << json[1];
+      EXPECT_EQ(json[0].size(), json[1].size());
+      EXPECT_EQ('\n', json[1].back());
+    }
+  }
+}
+
+TEST(SubstitutionFormatterTest, JsonFormatterDirectSerializationOutput) {
+  NiceMock<StreamInfo::MockStreamInfo> stream_info;
+  Http::TestRequestHeaderMapImpl request_headers{{"x-value", "<\"a\\b\">\n"}};
+  Http::TestResponseHeaderMapImpl response_headers;
+  Http::TestResponseTrailerMapImpl response_trailers;
+  std::string body;
+  stream_info.response_code_ = 503;
+
+  ProtobufWkt::Struct key_mapping;
+  TestUtility::loadFromYaml(R"EOF(
+    value: '%REQ(X-VALUE)%'
+    missing: '%REQ(X-MISSING)%'
+    code: '%RESPONSE_CODE%'
+    nested:
+      empty: '%REQ(X-MISSING)%'
+  )EOF",
+                            key_mapping);
+
+  TestScopedRuntime scoped_runtime;
+  Runtime::LoaderSingleton::getExisting()->mergeValues(
+      {{"envoy.reloadable_features.json_access_log_direct_serialization", "true"}});
+  {
+    JsonFormatterImpl formatter(key_mapping, false, false);
+    EXPECT_EQ("{\"code\":\"503\",\"missing\":\"-\",\"nested\":{\"empty\":\"-\"},"
+              "\"value\":\"\\u003c\\\"a\\\\b\\\"\\u003e\\n\"}\n",
+              formatter.format(request_headers, response_headers, response_trailers, stream_info,
+                               body));
+  }
+  {
+    JsonFormatterImpl formatter(key_mapping, true, true);
+    EXPECT_EQ("{\"code\":503,\"nested\":{},"
+              "\"value\":\"\\u003c\\\"a\\\\b\\\"\\u003e\\n\"}\n",
+              formatter.format(request_headers, response_headers, response_trailers, stream_info,
+                               body));
+  }
+}
+
+// Lines formatted after an unusually long one are unaffected by the output size hint, whether or
+// not it is enabled.
+TEST(SubstitutionFormatterTest, FormatterOutputSizeHint) {
+  NiceMock<StreamInfo::MockStreamInfo> stream_info;
+  Http::TestResponseHeaderMapImpl response_headers;
+  Http::TestResponseTrailerMapImpl response_trailers;
+  std::string body;
+  const std::string long_value(16384, 'a');
+  Http::TestRequestHeaderMapImpl long_request_headers{{"x-value", long_value}};
+  Http::TestRequestHeaderMapImpl short_request_headers{{"x-value", "b"}};
+
+  for (const bool use_output_size_hint : {false, true}) {
+    SCOPED_TRACE(absl::StrCat("use_output_size_hint: ", use_output_size_hint));
+    TestScopedRuntime scoped_runtime;
+    Runtime::LoaderSingleton::getExisting()->mergeValues(
+        {{"envoy.reloadable_features.access_log_output_size_hint",
+          use_output_size_hint ? "true" : "false"}});
+    FormatterImpl formatter("[%REQ(X-VALUE)%]", false);
+    EXPECT_EQ(absl::StrCat("[", long_value, "]"),
+              formatter.format(long_request_headers, response_headers, response_trailers,
+                               stream_info, body));
+    EXPECT_EQ("[b]", formatter.format(short_request_headers, response_headers, response_trailers,
+                                      stream_info, body));
+  }
+}
+
 // Test new specifier (PLAIN/TYPED) of FilterState. Ensure that after adding additional specifier,
 // the FilterState can call the serializeAsProto or serializeAsString methods correctly.
 TEST(SubstitutionFormatterTest, FilterStateSpeciferTest) {
@@ -616,6 +616,19 @@ TEST(HeaderIsValidTest, ValidHeaderValuesAreAccepted) {
   EXPECT_TRUE(HeaderUtility::headerValueIsValid("Some Other Value"));
 }
 
+// Long values are checked in 16 byte blocks where SIMD is available; place each character at every
+// position of a value spanning several blocks and a tail.
+TEST(HeaderIsValidTest, LongHeaderValues) {
+  for (int c = 0; c < 256; c++) {
+    const bool valid = c == '\t' || (c >= 0x20 && c != 0x7f);
+    for (size_t position = 0; position < 40; position++) {
+      std::string value(40, 'a');
+      value[position] = static_cast<char>(c);
+      EXPECT_EQ(valid, HeaderUtility::headerValueIsValid(value)) << c << " at " << position;
+    }
+  }
+}
+
 TEST(HeaderIsValidTest, AuthorityIsValid) {
   EXPECT_TRUE(HeaderUtility::authorityIsValid("strangebutlegal$-%&'"));
   EXPECT_FALSE(HeaderUtility::authorityIsValid("illegal{}"));
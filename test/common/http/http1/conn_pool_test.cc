@@ -161,7 +161,7 @@ struct ActiveTestRequest {
       : parent_(parent), client_index_(client_index) {
     uint64_t active_rq_observed =
         parent_.cluster_->resourceManager(Upstream::ResourcePriority::Default).requests().count();
-    uint64_t current_rq_total = parent_.cluster_->stats_.upstream_rq_total_.value();
+    uint64_t current_rq_total = parent_.cluster_->traffic_stats_.upstream_rq_total_.value();
     if (type == Type::CreateConnection) {
       parent.conn_pool_->expectClientCreate();
     }
@@ -185,7 +185,7 @@ struct ActiveTestRequest {
           Network::ConnectionEvent::Connected);
     }
     if (type != Type::Pending) {
-      EXPECT_EQ(current_rq_total + 1, parent_.cluster_->stats_.upstream_rq_total_.value());
+      EXPECT_EQ(current_rq_total + 1, parent_.cluster_->traffic_stats_.upstream_rq_total_.value());
       EXPECT_EQ(active_rq_observed + 1,
                 parent_.cluster_->resourceManager(Upstream::ResourcePriority::Default)
                     .requests()
@@ -410,7 +410,7 @@ TEST_F(Http1ConnPoolImplTest, MaxPendingRequests) {
   conn_pool_->test_clients_[0].connection_->raiseEvent(Network::ConnectionEvent::RemoteClose);
   dispatcher_.clearDeferredDeleteList();
 
-  EXPECT_EQ(1U, cluster_->stats_.upstream_rq_pending_overflow_.value());
+  EXPECT_EQ(1U, cluster_->traffic_stats_.upstream_rq_pending_overflow_.value());
 }
 
 /**
@@ -433,8 +433,8 @@ TEST_F(Http1ConnPoolImplTest, ConnectFailure) {
   EXPECT_CALL(*conn_pool_, onClientDestroy());
   dispatcher_.clearDeferredDeleteList();
 
-  EXPECT_EQ(1U, cluster_->stats_.upstream_cx_connect_fail_.value());
-  EXPECT_EQ(1U, cluster_->stats_.upstream_rq_pending_failure_eject_.value());
+  EXPECT_EQ(1U, cluster_->traffic_stats_.upstream_cx_connect_fail_.value());
+  EXPECT_EQ(1U, cluster_->traffic_stats_.upstream_rq_pending_failure_eject_.value());
 }
 
 /**
@@ -522,9 +522,9 @@ TEST_F(Http1ConnPoolImplTest, ConnectTimeout) {
   EXPECT_CALL(*conn_pool_, onClientDestroy()).Times(2);
   dispatcher_.clearDeferredDeleteList();
 
-  EXPECT_EQ(0U, cluster_->stats_.upstream_rq_total_.value());
-  EXPECT_EQ(2U, cluster_->stats_.upstream_cx_connect_fail_.value());
-  EXPECT_EQ(2U, cluster_->stats_.upstream_cx_connect_timeout_.value());
+  EXPECT_EQ(0U, cluster_->traffic_stats_.upstream_rq_total_.value());
+  EXPECT_EQ(2U, cluster_->traffic_stats_.upstream_cx_connect_fail_.value());
+  EXPECT_EQ(2U, cluster_->traffic_stats_.upstream_cx_connect_timeout_.value());
 }
 
 /**
@@ -620,7 +620,7 @@ TEST_F(Http1ConnPoolImplTest, MaxConnections) {
   NiceMock<MockResponseDecoder> outer_decoder2;
   ConnPoolCallbacks callbacks2;
   handle = conn_pool_->newStream(outer_decoder2, callbacks2);
-  EXPECT_EQ(1U, cluster_->stats_.upstream_cx_overflow_.value());
+  EXPECT_EQ(1U, cluster_->traffic_stats_.upstream_cx_overflow_.value());
   EXPECT_EQ(1U, cluster_->circuit_breakers_stats_.cx_open_.value());
 
   EXPECT_NE(nullptr, handle);
@@ -678,7 +678,7 @@ TEST_F(Http1ConnPoolImplTest, ConnectionCloseWithoutHeader) {
   NiceMock<MockResponseDecoder> outer_decoder2;
   ConnPoolCallbacks callbacks2;
   handle = conn_pool_->newStream(outer_decoder2, callbacks2);
-  EXPECT_EQ(1U, cluster_->stats_.upstream_cx_overflow_.value());
+  EXPECT_EQ(1U, cluster_->traffic_stats_.upstream_cx_overflow_.value());
 
   EXPECT_NE(nullptr, handle);
 
@@ -755,7 +755,7 @@ TEST_F(Http1ConnPoolImplTest, ConnectionCloseHeader) {
   inner_decoder->decodeHeaders(std::move(response_headers), true);
   dispatcher_.clearDeferredDeleteList();
 
-  EXPECT_EQ(0U, cluster_->stats_.upstream_cx_destroy_with_active_rq_.value());
+  EXPECT_EQ(0U, cluster_->traffic_stats_.upstream_cx_destroy_with_active_rq_.value());
 }
 
 /**
@@ -790,7 +790,7 @@ TEST_F(Http1ConnPoolImplTest, ProxyConnectionCloseHeader) {
   inner_decoder->decodeHeaders(std::move(response_headers), true);
   dispatcher_.clearDeferredDeleteList();
 
-  EXPECT_EQ(0U, cluster_->stats_.upstream_cx_destroy_with_active_rq_.value());
+  EXPECT_EQ(0U, cluster_->traffic_stats_.upstream_cx_destroy_with_active_rq_.value());
 }
 
 /**
@@ -828,7 +828,7 @@ TEST_F(Http1ConnPoolImplTest, ProxyConnectionCloseHeaderLegacy) {
   inner_decoder->decodeHeaders(std::move(response_headers), true);
   dispatcher_.clearDeferredDeleteList();
 
-  EXPECT_EQ(0U, cluster_->stats_.upstream_cx_destroy_with_active_rq_.value());
+  EXPECT_EQ(0U, cluster_->traffic_stats_.upstream_cx_destroy_with_active_rq_.value());
 }
 
 /**
@@ -862,7 +862,7 @@ TEST_F(Http1ConnPoolImplTest, Http10NoConnectionKeepAlive) {
   inner_decoder->decodeHeaders(std::move(response_headers), true);
   dispatcher_.clearDeferredDeleteList();
 
-  EXPECT_EQ(0U, cluster_->stats_.upstream_cx_destroy_with_active_rq_.value());
+  EXPECT_EQ(0U, cluster_->traffic_stats_.upstream_cx_destroy_with_active_rq_.value());
 }
 
 /**
@@ -899,7 +899,7 @@ TEST_F(Http1ConnPoolImplTest, Http10NoConnectionKeepAliveLegacy) {
   inner_decoder->decodeHeaders(std::move(response_headers), true);
   dispatcher_.clearDeferredDeleteList();
 
-  EXPECT_EQ(0U, cluster_->stats_.upstream_cx_destroy_with_active_rq_.value());
+  EXPECT_EQ(0U, cluster_->traffic_stats_.upstream_cx_destroy_with_active_rq_.value());
 }
 
 /**
@@ -934,8 +934,8 @@ TEST_F(Http1ConnPoolImplTest, MaxRequestsPerConnection) {
   inner_decoder->decodeHeaders(std::move(response_headers), true);
   dispatcher_.clearDeferredDeleteList();
 
-  EXPECT_EQ(0U, cluster_->stats_.upstream_cx_destroy_with_active_rq_.value());
-  EXPECT_EQ(1U, cluster_->stats_.upstream_cx_max_requests_.value());
+  EXPECT_EQ(0U, cluster_->traffic_stats_.upstream_cx_destroy_with_active_rq_.value());
+  EXPECT_EQ(1U, cluster_->traffic_stats_.upstream_cx_max_requests_.value());
 }
 
 TEST_F(Http1ConnPoolImplTest, ConcurrentConnections) {
@@ -957,7 +957,7 @@ TEST_F(Http1ConnPoolImplTest, ConcurrentConnections) {
   r1.completeResponse(false);
   conn_pool_->expectAndRunUpstreamReady();
   r3.startRequest();
-  EXPECT_EQ(3U, cluster_->stats_.upstream_rq_total_.value());
+  EXPECT_EQ(3U, cluster_->traffic_stats_.upstream_rq_total_.value());
 
   r2.completeResponse(false);
   r3.completeResponse(false);
@@ -968,8 +968,8 @@ TEST_F(Http1ConnPoolImplTest, ConcurrentConnections) {
   conn_pool_->test_clients_[0].connection_->raiseEvent(Network::ConnectionEvent::RemoteClose);
   dispatcher_.clearDeferredDeleteList();
 
-  EXPECT_EQ(2U, cluster_->stats_.upstream_cx_destroy_.value());
-  EXPECT_EQ(2U, cluster_->stats_.upstream_cx_destroy_remote_.value());
+  EXPECT_EQ(2U, cluster_->traffic_stats_.upstream_cx_destroy_.value());
+  EXPECT_EQ(2U, cluster_->traffic_stats_.upstream_cx_destroy_remote_.value());
 }
 
 TEST_F(Http1ConnPoolImplTest, DrainCallback) {
@@ -982,7 +982,7 @@ TEST_F(Http1ConnPoolImplTest, DrainCallback) {
   ActiveTestRequest r1(*this, 0, ActiveTestRequest::Type::CreateConnection);
   ActiveTestRequest r2(*this, 0, ActiveTestRequest::Type::Pending);
   r2.handle_->cancel(Envoy::ConnectionPool::CancelPolicy::Default);
-  EXPECT_EQ(1U, cluster_->stats_.upstream_rq_total_.value());
+  EXPECT_EQ(1U, cluster_->traffic_stats_.upstream_rq_total_.value());
 
   EXPECT_CALL(drained, ready());
   r1.startRequest();
@@ -1052,8 +1052,8 @@ TEST_F(Http1ConnPoolImplTest, RemoteCloseToCompleteResponse) {
   conn_pool_->test_clients_[0].connection_->raiseEvent(Network::ConnectionEvent::RemoteClose);
   dispatcher_.clearDeferredDeleteList();
 
-  EXPECT_EQ(1U, cluster_->stats_.upstream_cx_destroy_.value());
-  EXPECT_EQ(1U, cluster_->stats_.upstream_cx_destroy_remote_.value());
+  EXPECT_EQ(1U, cluster_->traffic_stats_.upstream_cx_destroy_.value());
+  EXPECT_EQ(1U, cluster_->traffic_stats_.upstream_cx_destroy_remote_.value());
 }
 
 TEST_F(Http1ConnPoolImplTest, NoActiveConnectionsByDefault) {
@@ -1093,13 +1093,13 @@ TEST_F(Http1ConnPoolImplTest, PendingRequestIsConsideredActive) {
 
   EXPECT_CALL(*conn_pool_, onClientDestroy());
   r1.handle_->cancel(Envoy::ConnectionPool::CancelPolicy::Default);
-  EXPECT_EQ(0U, cluster_->stats_.upstream_rq_total_.value());
+  EXPECT_EQ(0U, cluster_->traffic_stats_.upstream_rq_total_.value());
   conn_pool_->drainConnections();
   conn_pool_->test_clients_[0].connection_->raiseEvent(Network::ConnectionEvent::RemoteClose);
   dispatcher_.clearDeferredDeleteList();
 
-  EXPECT_EQ(1U, cluster_->stats_.upstream_cx_destroy_.value());
-  EXPECT_EQ(1U, cluster_->stats_.upstream_cx_destroy_local_.value());
+  EXPECT_EQ(1U, cluster_->traffic_stats_.upstream_cx_destroy_.value());
+  EXPECT_EQ(1U, cluster_->traffic_stats_.upstream_cx_destroy_local_.value());
 }
 
 } // namespace
@@ -26,6 +26,7 @@
 #include "test/test_common/network_utility.h"
 #include "test/test_common/printers.h"
 #include "test/test_common/simulated_time_system.h"
+#include "test/test_common/test_runtime.h"
 #include "test/test_common/threadsafe_singleton_injector.h"
 #include "test/test_common/utility.h"
 
@@ -1116,6 +1117,55 @@ TEST_P(ConnectionImplTest, WatermarkFuzzing) {
   disconnect(true);
 }
 
+// A write that the kernel only partially accepts means the socket send buffer is full, so the
+// raw buffer socket should wait for the next write event instead of retrying the write.
+TEST_P(ConnectionImplTest, ShortWriteWaitsForNextWriteEvent) {
+  setUpBasicConnection();
+  connect();
+
+  {
+    NiceMock<Api::MockOsSysCalls> os_sys_calls;
+    TestThreadsafeSingletonInjector<Api::OsSysCallsImpl> os_calls(&os_sys_calls);
+    EXPECT_CALL(os_sys_calls, writev(_, _, _))
+        .WillOnce(Invoke([](os_fd_t, const iovec* iov, int iovcnt) -> Api::SysCallSizeResult {
+          EXPECT_EQ(1, iovcnt);
+          EXPECT_EQ(11, iov[0].iov_len);
+          return {5, 0};
+        }));
+    Buffer::OwnedImpl data("hello world");
+    client_connection_->write(data, false);
+    dispatcher_->run(Event::Dispatcher::RunType::NonBlock);
+  }
+
+  disconnect(false);
+}
+
+// With the runtime guard disabled, a short write is followed by another write attempt.
+TEST_P(ConnectionImplTest, ShortWriteRetriesWithRuntimeGuardDisabled) {
+  TestScopedRuntime scoped_runtime;
+  Runtime::LoaderSingleton::getExisting()->mergeValues(
+      {{"envoy.reloadable_features.raw_buffer_socket_stop_on_short_write", "false"}});
+  setUpBasicConnection();
+  connect();
+
+  {
+    NiceMock<Api::MockOsSysCalls> os_sys_calls;
+    TestThreadsafeSingletonInjector<Api::OsSysCallsImpl> os_calls(&os_sys_calls);
+    EXPECT_CALL(os_sys_calls, writev(_, _, _))
+        .WillOnce(Invoke([](os_fd_t, const iovec*, int) -> Api::SysCallSizeResult {
+          return {5, 0};
+        }))
+        .WillOnce(Invoke([](os_fd_t, const iovec*, int) -> Api::SysCallSizeResult {
+          return {-1, SOCKET_ERROR_AGAIN};
+        }));
+    Buffer::OwnedImpl data("hello world");
+    client_connection_->write(data, false);
+    dispatcher_->run(Event::Dispatcher::RunType::NonBlock);
+  }
+
+  disconnect(false);
+}
+
 TEST_P(ConnectionImplTest, BindTest) {
   std::string address_string = TestUtility::getIpv4Loopback();
   if (GetParam() == Network::Address::IpVersion::v4) {
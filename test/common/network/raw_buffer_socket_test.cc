@@ -0,0 +1,193 @@
+#include <string>
+#include <vector>
+
+#include "common/buffer/buffer_impl.h"
+#include "common/network/io_socket_error_impl.h"
+#include "common/network/raw_buffer_socket.h"
+
+#include "test/mocks/network/io_handle.h"
+#include "test/mocks/network/mocks.h"
+#include "test/test_common/test_runtime.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using testing::_;
+using testing::ElementsAre;
+using testing::Invoke;
+using testing::NiceMock;
+using testing::Return;
+using testing::ReturnRef;
+
+namespace Envoy {
+namespace Network {
+namespace {
+
+Api::IoCallUint64Result ioResult(uint64_t rc) {
+  return Api::IoCallUint64Result(rc, Api::IoErrorPtr(nullptr, [](Api::IoError*) {}));
+}
+
+Api::IoCallUint64Result eagainResult() {
+  return Api::IoCallUint64Result(0, Api::IoErrorPtr(IoSocketError::getIoSocketEagainInstance(),
+                                                    IoSocketError::deleteIoError));
+}
+
+// Read sizes that exactly fill buffer slices of 20KiB, 40KiB and 80KiB.
+constexpr uint64_t ReadSize20K = 20480 - sizeof(Buffer::OwnedSlice);
+constexpr uint64_t ReadSize40K = 40960 - sizeof(Buffer::OwnedSlice);
+constexpr uint64_t ReadSize80K = 81920 - sizeof(Buffer::OwnedSlice);
+
+class RawBufferSocketTest : public testing::Test {
+protected:
+  RawBufferSocketTest() {
+    ON_CALL(callbacks_, ioHandle()).WillByDefault(ReturnRef(io_handle_));
+    raw_buffer_socket_.setTransportSocketCallbacks(callbacks_);
+  }
+
+  NiceMock<MockIoHandle> io_handle_;
+  NiceMock<MockTransportSocketCallbacks> callbacks_;
+  RawBufferSocket raw_buffer_socket_;
+};
+
+// The read size doubles from filling a 20K slice up to filling an 80K slice while every read
+// fills the requested size.
+TEST_F(RawBufferSocketTest, ReadSizeGrowsWhileReadsFillRequest) {
+  std::vector<uint64_t> read_sizes;
+  EXPECT_CALL(io_handle_, read(_, _))
+      .Times(5)
+      .WillRepeatedly(Invoke([&](Buffer::Instance& buffer, uint64_t max_length) {
+        read_sizes.push_back(max_length);
+        if (read_sizes.size() == 5) {
+          return eagainResult();
+        }
+        buffer.add(std::string(max_length, 'a'));
+        return ioResult(max_length);
+      }));
+
+  Buffer::OwnedImpl buffer;
+  const IoResult result = raw_buffer_socket_.doRead(buffer);
+  EXPECT_EQ(PostIoAction::KeepOpen, result.action_);
+  EXPECT_EQ(ReadSize20K + ReadSize40K + 2 * ReadSize80K, result.bytes_processed_);
+  EXPECT_EQ(ReadSize20K + ReadSize40K + 2 * ReadSize80K, buffer.length());
+  EXPECT_THAT(read_sizes,
+              ElementsAre(ReadSize20K, ReadSize40K, ReadSize80K, ReadSize80K, ReadSize80K));
+  // Each read filled a new slice exactly.
+  EXPECT_EQ(4, buffer.getRawSlices().size());
+}
+
+// A read that does not fill the requested size keeps the current read size.
+TEST_F(RawBufferSocketTest, ReadSizeKeptAfterPartialRead) {
+  std::vector<uint64_t> read_sizes;
+  EXPECT_CALL(io_handle_, read(_, _))
+      .Times(3)
+      .WillRepeatedly(Invoke([&](Buffer::Instance& buffer, uint64_t max_length) {
+        read_sizes.push_back(max_length);
+        if (read_sizes.size() == 3) {
+          return eagainResult();
+        }
+        buffer.add(std::string(100, 'a'));
+        return ioResult(100);
+      }));
+
+  Buffer::OwnedImpl buffer;
+  const IoResult result = raw_buffer_socket_.doRead(buffer);
+  EXPECT_EQ(200, result.bytes_processed_);
+  EXPECT_THAT(read_sizes, ElementsAre(ReadSize20K, ReadSize20K, ReadSize20K));
+}
+
+// The read size is capped by the room left under the buffer limit, but never below the initial
+// read size.
+TEST_F(RawBufferSocketTest, ReadSizeCappedByBufferLimit) {
+  EXPECT_CALL(callbacks_.connection_, bufferLimit()).WillRepeatedly(Return(100000));
+  std::vector<uint64_t> read_sizes;
+  EXPECT_CALL(io_handle_, read(_, _))
+      .Times(5)
+      .WillRepeatedly(Invoke([&](Buffer::Instance& buffer, uint64_t max_length) {
+        read_sizes.push_back(max_length);
+        if (read_sizes.size() == 5) {
+          return eagainResult();
+        }
+        buffer.add(std::string(max_length, 'a'));
+        return ioResult(max_length);
+      }));
+
+  Buffer::OwnedImpl buffer;
+  raw_buffer_socket_.doRead(buffer);
+  // After the first two reads, 100000 - ReadSize20K - ReadSize40K bytes are left, then the initial
+  // read size as the minimum.
+  EXPECT_THAT(read_sizes, ElementsAre(ReadSize20K, ReadSize40K, 100000 - ReadSize20K - ReadSize40K,
+                                      ReadSize20K, ReadSize20K));
+}
+
+// The read size stays at 16K when the runtime feature is disabled.
+TEST_F(RawBufferSocketTest, ReadSizeGrowthDisabled) {
+  TestScopedRuntime scoped_runtime;
+  Runtime::LoaderSingleton::getExisting()->mergeValues(
+      {{"envoy.reloadable_features.raw_buffer_socket_grow_read_size", "false"}});
+  RawBufferSocket raw_buffer_socket;
+  raw_buffer_socket.setTransportSocketCallbacks(callbacks_);
+
+  std::vector<uint64_t> read_sizes;
+  EXPECT_CALL(io_handle_, read(_, _))
+      .Times(3)
+      .WillRepeatedly(Invoke([&](Buffer::Instance& buffer, uint64_t max_length) {
+        read_sizes.push_back(max_length);
+        if (read_sizes.size() == 3) {
+          return eagainResult();
+        }
+        buffer.add(std::string(max_length, 'a'));
+        return ioResult(max_length);
+      }));
+
+  Buffer::OwnedImpl buffer;
+  raw_buffer_socket.doRead(buffer);
+  EXPECT_THAT(read_sizes, ElementsAre(16384, 16384, 16384));
+}
+
+// A write that the kernel only partially accepts ends the write loop. Writes go through
+// IoHandle::write(), so that IoHandle implementations that override it are not bypassed.
+TEST_F(RawBufferSocketTest, ShortWriteEndsWriteLoop) {
+  EXPECT_CALL(io_handle_, writev(_, _)).Times(0);
+  EXPECT_CALL(io_handle_, write(_)).WillOnce(Invoke([](Buffer::Instance& buffer) {
+    EXPECT_EQ(11, buffer.length());
+    buffer.drain(5);
+    return ioResult(5);
+  }));
+
+  Buffer::OwnedImpl buffer("hello world");
+  const IoResult result = raw_buffer_socket_.doWrite(buffer, false);
+  EXPECT_EQ(PostIoAction::KeepOpen, result.action_);
+  EXPECT_EQ(5, result.bytes_processed_);
+  EXPECT_EQ(" world", buffer.toString());
+}
+
+// A write that is fully accepted continues with the rest of the buffer.
+TEST_F(RawBufferSocketTest, FullWriteContinuesWriteLoop) {
+  Buffer::OwnedImpl buffer;
+  for (int i = 0; i < 17; i++) {
+    // Each fragment ends up in its own slice so that more than one writev() is needed.
+    Buffer::OwnedImpl slice(std::string(4096, 'a'));
+    buffer.move(slice);
+  }
+
+  // Like IoSocketHandleImpl::write(), each write takes at most the first 16 slices.
+  EXPECT_CALL(io_handle_, write(_))
+      .WillOnce(Invoke([](Buffer::Instance& buffer) {
+        buffer.drain(16 * 4096);
+        return ioResult(16 * 4096);
+      }))
+      .WillOnce(Invoke([](Buffer::Instance& buffer) {
+        EXPECT_EQ(4096, buffer.length());
+        buffer.drain(4096);
+        return ioResult(4096);
+      }));
+
+  const IoResult result = raw_buffer_socket_.doWrite(buffer, false);
+  EXPECT_EQ(PostIoAction::KeepOpen, result.action_);
+  EXPECT_EQ(17 * 4096, result.bytes_processed_);
+  EXPECT_EQ(0, buffer.length());
+}
+
+} // namespace
+} // namespace Network
+} // namespace Envoy
@@ -28,6 +28,7 @@
 #include "test/mocks/upstream/retry_priority_factory.h"
 #include "test/mocks/upstream/test_retry_host_predicate_factory.h"
 #include "test/test_common/environment.h"
+#include "test/test_common/logging.h"
 #include "test/test_common/printers.h"
 #include "test/test_common/registry.h"
 #include "test/test_common/test_runtime.h"
@@ -580,6 +581,119 @@ virtual_hosts:
             config.route(genHeaders("bat5.com", " ", "CONNECT"), 0)->routeEntry()->clusterName());
 }
 
+// The path match index and regex set must select the same route as evaluating every route in
+// order.
+TEST_F(RouteMatcherTest, PathMatchIndexPreservesRouteOrder) {
+  const std::string yaml = R"EOF(
+virtual_hosts:
+- name: local_service
+  domains: ["*"]
+  routes:
+  - match: { prefix: "/api/v1/", headers: [{ name: x-canary, exact_match: "true" }] }
+    route: { cluster: canary }
+  - match: { path: "/api/v1/users" }
+    route: { cluster: users_exact }
+  - match: { safe_regex: { google_re2: {}, regex: "/api/v1/users/[0-9]+" } }
+    route: { cluster: user_by_id }
+  - match: { prefix: "/api/v1/users" }
+    route: { cluster: users }
+  - match: { safe_regex: { google_re2: {}, regex: "/api/v[0-9]/orders/.*" } }
+    route: { cluster: orders }
+  - match: { prefix: "/API/V2/", case_sensitive: false }
+    route: { cluster: v2 }
+  - match: { prefix: "/api/" }
+    route: { cluster: api }
+  - match: { path: "/api/v1/users/42" }
+    route: { cluster: shadowed }
+  - match: { prefix: "" }
+    route: { cluster: default }
+  )EOF";
+
+  const std::vector<std::pair<std::string, std::string>> requests{
+      {"/api/v1/users", "users_exact"},
+      {"/api/v1/users?limit=10", "users_exact"},
+      {"/api/v1/users/42", "user_by_id"},
+      {"/api/v1/users/abc", "users"},
+      {"/api/v1/usersettings", "users"},
+      {"/api/v2/things", "v2"},
+      {"/Api/v2/things", "v2"},
+      {"/apix", "default"},
+      {"/api/v1/orders#fragment", "api"},
+      {"/api/v1/orders/7?expand=true", "orders"},
+      {"/api/v2/orders/7", "orders"},
+      {"/api", "default"},
+      {"/", "default"},
+  };
+
+  for (const auto& [path_match_index, regex_set] :
+       std::vector<std::pair<std::string, std::string>>{
+           {"true", "true"}, {"true", "false"}, {"false", "false"}}) {
+    TestScopedRuntime scoped_runtime;
+    Runtime::LoaderSingleton::getExisting()->mergeValues(
+        {{"envoy.reloadable_features.route_path_match_index", path_match_index},
+         {"envoy.reloadable_features.route_regex_set_prefilter", regex_set}});
+    TestConfigImpl config(parseRouteConfigurationFromYaml(yaml), factory_context_, false);
+
+    for (const auto& [path, cluster] : requests) {
+      Http::TestRequestHeaderMapImpl headers = genHeaders("www.lyft.com", path, "GET");
+      EXPECT_EQ(cluster, config.route(headers, 0)->routeEntry()->clusterName()) << path;
+    }
+    Http::TestRequestHeaderMapImpl canary_headers =
+        genHeaders("www.lyft.com", "/api/v1/users", "GET");
+    canary_headers.addCopy("x-canary", "true");
+    EXPECT_EQ("canary", config.route(canary_headers, 0)->routeEntry()->clusterName());
+  }
+}
+
+// Regex routes are checked one by one when RE2 runs out of memory compiling them into one set.
+TEST_F(RouteMatcherTest, RegexSetCompileFailure) {
+  // Each of these regexes is small, but RE2 cannot compile a few hundred of them into one set
+  // within its default memory budget.
+  const int num_routes = 1000;
+  std::string yaml = R"EOF(
+virtual_hosts:
+- name: regexes
+  domains: ["*"]
+  routes:
+)EOF";
+  for (int i = 0; i < num_routes; i++) {
+    yaml += fmt::format(R"EOF(
+  - match:
+      safe_regex:
+        google_re2: {{ max_program_size: 1000 }}
+        regex: "/route{0}/[a-z]{{1,30}}/[0-9]{{1,30}}/[a-f]{{1,30}}/[g-z]{{1,30}}"
+    route: {{ cluster: cluster{0} }}
+)EOF",
+                        i);
+  }
+  yaml += R"EOF(
+  - match: { prefix: "/" }
+    route: { cluster: default }
+)EOF";
+
+  TestScopedRuntime scoped_runtime;
+  Runtime::LoaderSingleton::getExisting()->mergeValues(
+      {{"envoy.reloadable_features.route_path_match_index", "true"},
+       {"envoy.reloadable_features.route_regex_set_prefilter", "true"}});
+  std::unique_ptr<TestConfigImpl> config;
+  EXPECT_LOG_CONTAINS(
+      "warn", "unable to pre-filter the 1000 regex routes of virtual host 'regexes'",
+      config = std::make_unique<TestConfigImpl>(parseRouteConfigurationFromYaml(yaml),
+                                                factory_context_, false));
+
+  EXPECT_EQ("cluster0",
+            config->route(genHeaders("www.lyft.com", "/route0/abc/123/abc/ghi", "GET"), 0)
+                ->routeEntry()
+                ->clusterName());
+  EXPECT_EQ("cluster999",
+            config->route(genHeaders("www.lyft.com", "/route999/z/0/f/z?query", "GET"), 0)
+                ->routeEntry()
+                ->clusterName());
+  EXPECT_EQ("default", config->route(genHeaders("www.lyft.com", "/route999/z/0/f", "GET"), 0)
+                           ->routeEntry()
+                           ->clusterName());
+}
+
 TEST_F(RouteMatcherTest, TestRoutes) {
   const std::string yaml = R"EOF(
 virtual_hosts:
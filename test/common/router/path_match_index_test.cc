@@ -0,0 +1,96 @@
+#include "common/router/path_match_index.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Router {
+namespace {
+
+using testing::ElementsAre;
+using testing::IsEmpty;
+using testing::UnorderedElementsAre;
+
+PathMatchIndex::Candidates find(const PathMatchIndex& index, absl::string_view path) {
+  PathMatchIndex::Candidates candidates;
+  index.find(path, candidates);
+  return candidates;
+}
+
+TEST(PathMatchIndexTest, Empty) {
+  PathMatchIndex index;
+  EXPECT_THAT(find(index, "/"), IsEmpty());
+  EXPECT_THAT(find(index, ""), IsEmpty());
+}
+
+TEST(PathMatchIndexTest, EmptyPrefixMatchesEverything) {
+  PathMatchIndex index;
+  index.addPrefix("", 0);
+  EXPECT_THAT(find(index, ""), ElementsAre(0));
+  EXPECT_THAT(find(index, "/foo"), ElementsAre(0));
+}
+
+TEST(PathMatchIndexTest, NestedPrefixes) {
+  PathMatchIndex index;
+  index.addPrefix("/api/v1/users", 0);
+  index.addPrefix("/api/", 1);
+  index.addPrefix("/api/v1/", 2);
+  index.addPrefix("/apx", 3);
+
+  EXPECT_THAT(find(index, "/api/v1/users/42"), UnorderedElementsAre(0, 1, 2));
+  EXPECT_THAT(find(index, "/api/v1/user"), UnorderedElementsAre(1, 2));
+  EXPECT_THAT(find(index, "/api/v2"), ElementsAre(1));
+  EXPECT_THAT(find(index, "/apx/"), ElementsAre(3));
+  EXPECT_THAT(find(index, "/ap"), IsEmpty());
+  EXPECT_THAT(find(index, "/other"), IsEmpty());
+}
+
+TEST(PathMatchIndexTest, ExactPaths) {
+  PathMatchIndex index;
+  index.addExact("/foo/bar", 0);
+  index.addExact("/foo", 1);
+  index.addPrefix("/foo", 2);
+
+  EXPECT_THAT(find(index, "/foo/bar"), UnorderedElementsAre(0, 2));
+  EXPECT_THAT(find(index, "/foo"), UnorderedElementsAre(1, 2));
+  EXPECT_THAT(find(index, "/foo/"), ElementsAre(2));
+  EXPECT_THAT(find(index, "/foo/bar/baz"), ElementsAre(2));
+  EXPECT_THAT(find(index, "/fo"), IsEmpty());
+}
+
+TEST(PathMatchIndexTest, DuplicateMatchers) {
+  PathMatchIndex index;
+  index.addPrefix("/foo", 0);
+  index.addPrefix("/foo", 1);
+  index.addExact("/foo", 2);
+  index.addExact("/foo", 3);
+
+  EXPECT_THAT(find(index, "/foo"), UnorderedElementsAre(0, 1, 2, 3));
+  EXPECT_THAT(find(index, "/foobar"), UnorderedElementsAre(0, 1));
+}
+
+// Insertion order must not affect how edges are split.
+TEST(PathMatchIndexTest, SplitEdges) {
+  PathMatchIndex index;
+  index.addPrefix("/shelves/shelf_10/", 0);
+  index.addPrefix("/shelves/shelf_1/", 1);
+  index.addPrefix("/shelves/", 2);
+  index.addExact("/shelves/shelf_1", 3);
+
+  EXPECT_THAT(find(index, "/shelves/shelf_10/route"), UnorderedElementsAre(0, 2));
+  EXPECT_THAT(find(index, "/shelves/shelf_1/route"), UnorderedElementsAre(1, 2));
+  EXPECT_THAT(find(index, "/shelves/shelf_1"), UnorderedElementsAre(2, 3));
+  EXPECT_THAT(find(index, "/shelves/shelf_2/route"), ElementsAre(2));
+}
+
+TEST(PathMatchIndexTest, AppendsToCandidates) {
+  PathMatchIndex index;
+  index.addPrefix("/", 5);
+  PathMatchIndex::Candidates candidates{1, 7};
+  index.find("/foo", candidates);
+  EXPECT_THAT(candidates, ElementsAre(1, 7, 5));
+}
+
+} // namespace
+} // namespace Router
+} // namespace Envoy
@@ -58,6 +58,7 @@ using testing::Matcher;
 using testing::MockFunction;
 using testing::NiceMock;
 using testing::Property;
+using testing::Ref;
 using testing::Return;
 using testing::ReturnRef;
 using testing::StartsWith;
@@ -4806,6 +4807,170 @@ TEST_F(RouterTest, AltStatName) {
                     .value());
 }
 
+// Response times are fed to the cluster when it uses the peak EWMA load balancer.
+TEST_F(RouterTest, PeakEwmaResponseTime) {
+  cm_.thread_local_cluster_.cluster_.info_->lb_type_ = Upstream::LoadBalancerType::PeakEwma;
+
+  NiceMock<Http::MockRequestEncoder> encoder;
+  Http::ResponseDecoder* response_decoder = nullptr;
+  EXPECT_CALL(cm_.conn_pool_, newStream(_, _))
+      .WillOnce(Invoke(
+          [&](Http::ResponseDecoder& decoder,
+              Http::ConnectionPool::Callbacks& callbacks) -> Http::ConnectionPool::Cancellable* {
+            response_decoder = &decoder;
+            callbacks.onPoolReady(encoder, cm_.conn_pool_.host_, upstream_stream_info_);
+            return nullptr;
+          }));
+  expectResponseTimerCreate();
+
+  Http::TestRequestHeaderMapImpl headers;
+  HttpTestUtility::addDefaultHeaders(headers);
+  router_.decodeHeaders(headers, true);
+
+  EXPECT_CALL(cm_.thread_local_cluster_, putResponseTime(Ref(*cm_.conn_pool_.host_), _));
+  Http::ResponseHeaderMapPtr response_headers(
+      new Http::TestResponseHeaderMapImpl{{":status", "200"}});
+  response_decoder->decodeHeaders(std::move(response_headers), true);
+  EXPECT_TRUE(verifyHostUpstreamStats(1, 0));
+}
+
+// A global timeout is reported to a peak EWMA cluster as taking at least the timeout.
+TEST_F(RouterTest, PeakEwmaResponseTimeOnTimeout) {
+  cm_.thread_local_cluster_.cluster_.info_->lb_type_ = Upstream::LoadBalancerType::PeakEwma;
+
+  NiceMock<Http::MockRequestEncoder> encoder;
+  EXPECT_CALL(cm_.conn_pool_, newStream(_, _))
+      .WillOnce(Invoke(
+          [&](Http::ResponseDecoder&,
+              Http::ConnectionPool::Callbacks& callbacks) -> Http::ConnectionPool::Cancellable* {
+            callbacks.onPoolReady(encoder, cm_.conn_pool_.host_, upstream_stream_info_);
+            return nullptr;
+          }));
+  expectResponseTimerCreate();
+
+  Http::TestRequestHeaderMapImpl headers;
+  HttpTestUtility::addDefaultHeaders(headers);
+  router_.decodeHeaders(headers, true);
+
+  // The timer fired late, so the elapsed time is reported.
+  test_time_.advanceTimeWait(std::chrono::milliseconds(12));
+  EXPECT_CALL(cm_.thread_local_cluster_,
+              putResponseTime(Ref(*cm_.conn_pool_.host_), std::chrono::microseconds(12000)));
+  EXPECT_CALL(callbacks_, encodeHeaders_(_, false));
+  response_timeout_->invokeCallback();
+}
+
+// A per try timeout is reported to a peak EWMA cluster as taking at least the per try timeout.
+TEST_F(RouterTest, PeakEwmaResponseTimeOnPerTryTimeout) {
+  cm_.thread_local_cluster_.cluster_.info_->lb_type_ = Upstream::LoadBalancerType::PeakEwma;
+
+  NiceMock<Http::MockRequestEncoder> encoder;
+  EXPECT_CALL(cm_.conn_pool_, newStream(_, _))
+      .WillOnce(Invoke(
+          [&](Http::ResponseDecoder&,
+              Http::ConnectionPool::Callbacks& callbacks) -> Http::ConnectionPool::Cancellable* {
+            callbacks.onPoolReady(encoder, cm_.conn_pool_.host_, upstream_stream_info_);
+            return nullptr;
+          }));
+  expectPerTryTimerCreate();
+  expectResponseTimerCreate();
+
+  Http::TestRequestHeaderMapImpl headers{{"x-envoy-upstream-rq-per-try-timeout-ms", "5"}};
+  HttpTestUtility::addDefaultHeaders(headers);
+  router_.decodeHeaders(headers, true);
+
+  test_time_.advanceTimeWait(std::chrono::milliseconds(3));
+  EXPECT_CALL(cm_.thread_local_cluster_,
+              putResponseTime(Ref(*cm_.conn_pool_.host_), std::chrono::microseconds(5000)));
+  EXPECT_CALL(callbacks_, encodeHeaders_(_, false));
+  per_try_timeout_->invokeCallback();
+}
+
+// An upstream reset is reported to a peak EWMA cluster as if the request had timed out.
+TEST_F(RouterTest, PeakEwmaResponseTimeOnReset) {
+  cm_.thread_local_cluster_.cluster_.info_->lb_type_ = Upstream::LoadBalancerType::PeakEwma;
+
+  NiceMock<Http::MockRequestEncoder> encoder;
+  EXPECT_CALL(cm_.conn_pool_, newStream(_, _))
+      .WillOnce(Invoke(
+          [&](Http::ResponseDecoder&,
+              Http::ConnectionPool::Callbacks& callbacks) -> Http::ConnectionPool::Cancellable* {
+            callbacks.onPoolReady(encoder, cm_.conn_pool_.host_, upstream_stream_info_);
+            return nullptr;
+          }));
+  expectResponseTimerCreate();
+
+  Http::TestRequestHeaderMapImpl headers;
+  HttpTestUtility::addDefaultHeaders(headers);
+  router_.decodeHeaders(headers, true);
+
+  test_time_.advanceTimeWait(std::chrono::milliseconds(2));
+  EXPECT_CALL(cm_.thread_local_cluster_,
+              putResponseTime(Ref(*cm_.conn_pool_.host_), std::chrono::microseconds(10000)));
+  EXPECT_CALL(callbacks_, encodeHeaders_(_, false));
+  encoder.stream_.resetStream(Http::StreamResetReason::RemoteReset);
+}
+
+// The response time reported to a peak EWMA cluster starts when the request is sent upstream, not
+// when the downstream request completed.
+TEST_F(RouterTest, PeakEwmaResponseTimeFromUpstreamRequestStart) {
+  cm_.thread_local_cluster_.cluster_.info_->lb_type_ = Upstream::LoadBalancerType::PeakEwma;
+
+  NiceMock<Http::MockRequestEncoder> encoder;
+  Http::ResponseDecoder* response_decoder = nullptr;
+  Http::ConnectionPool::Callbacks* conn_pool_callbacks = nullptr;
+  EXPECT_CALL(cm_.conn_pool_, newStream(_, _))
+      .WillOnce(Invoke(
+          [&](Http::ResponseDecoder& decoder,
+              Http::ConnectionPool::Callbacks& callbacks) -> Http::ConnectionPool::Cancellable* {
+            response_decoder = &decoder;
+            conn_pool_callbacks = &callbacks;
+            return nullptr;
+          }));
+  expectResponseTimerCreate();
+
+  Http::TestRequestHeaderMapImpl headers;
+  HttpTestUtility::addDefaultHeaders(headers);
+  router_.decodeHeaders(headers, true);
+
+  // Waiting for a connection is not part of the response time.
+  test_time_.advanceTimeWait(std::chrono::milliseconds(4));
+  conn_pool_callbacks->onPoolReady(encoder, cm_.conn_pool_.host_, upstream_stream_info_);
+
+  test_time_.advanceTimeWait(std::chrono::milliseconds(3));
+  EXPECT_CALL(cm_.thread_local_cluster_,
+              putResponseTime(Ref(*cm_.conn_pool_.host_), std::chrono::microseconds(3000)));
+  Http::ResponseHeaderMapPtr response_headers(
+      new Http::TestResponseHeaderMapImpl{{":status", "200"}});
+  response_decoder->decodeHeaders(std::move(response_headers), true);
+}
+
+// Without a timeout, an upstream reset is not reported to a peak EWMA cluster, as the time until
+// the reset would make a failing host look fast.
+TEST_F(RouterTest, PeakEwmaResponseTimeOnResetWithoutTimeout) {
+  cm_.thread_local_cluster_.cluster_.info_->lb_type_ = Upstream::LoadBalancerType::PeakEwma;
+  EXPECT_CALL(callbacks_.route_->route_entry_, timeout())
+      .WillOnce(Return(std::chrono::milliseconds(0)));
+
+  NiceMock<Http::MockRequestEncoder> encoder;
+  EXPECT_CALL(cm_.conn_pool_, newStream(_, _))
+      .WillOnce(Invoke(
+          [&](Http::ResponseDecoder&,
+              Http::ConnectionPool::Callbacks& callbacks) -> Http::ConnectionPool::Cancellable* {
+            callbacks.onPoolReady(encoder, cm_.conn_pool_.host_, upstream_stream_info_);
+            return nullptr;
+          }));
+
+  Http::TestRequestHeaderMapImpl headers;
+  HttpTestUtility::addDefaultHeaders(headers);
+  router_.decodeHeaders(headers, true);
+
+  test_time_.advanceTimeWait(std::chrono::milliseconds(2));
+  EXPECT_CALL(cm_.thread_local_cluster_, putResponseTime(_, _)).Times(0);
+  EXPECT_CALL(callbacks_, encodeHeaders_(_, false));
+  encoder.stream_.resetStream(Http::StreamResetReason::RemoteReset);
+}
+
 TEST_F(RouterTest, Redirect) {
   MockDirectResponseEntry direct_response;
   std::string route_name("route-test-name");
@@ -72,6 +72,64 @@ TEST_F(AllocatorImplTest, GaugesWithSameName) {
   EXPECT_EQ(0, g2->value());
 }
 
+TEST_F(AllocatorImplTest, GaugeLatchChanged) {
+  GaugeSharedPtr gauge =
+      alloc_.makeGauge(makeStat("gauge.name"), StatName(), {}, Gauge::ImportMode::Accumulate);
+  EXPECT_FALSE(gauge->latchChanged());
+  gauge->set(5);
+  EXPECT_TRUE(gauge->latchChanged());
+  EXPECT_FALSE(gauge->latchChanged());
+  gauge->add(1);
+  EXPECT_TRUE(gauge->latchChanged());
+  gauge->sub(1);
+  EXPECT_TRUE(gauge->latchChanged());
+  gauge->setParentValue(2);
+  EXPECT_TRUE(gauge->latchChanged());
+  EXPECT_FALSE(gauge->latchChanged());
+  EXPECT_TRUE(gauge->used());
+  EXPECT_EQ(7, gauge->value());
+}
+
+TEST_F(AllocatorImplTest, ShardedCounter) {
+  // Use a separate allocator, so that the names it keeps are freed before the fixture checks that
+  // no symbols are left.
+  AllocatorImpl alloc(symbol_table_);
+  alloc.setShardedCounterNames({"sharded"});
+  CounterSharedPtr sharded = alloc.makeCounter(makeStat("sharded.1"), makeStat("sharded"), {});
+  CounterSharedPtr plain = alloc.makeCounter(makeStat("plain"), makeStat("plain"), {});
+  EXPECT_EQ(sharded.get(), alloc.makeCounter(makeStat("sharded.1"), makeStat("sharded"), {}).get());
+
+  const uint32_t num_threads = 12;
+  const uint32_t iters = 10000;
+  Thread::ThreadFactory& thread_factory = Thread::threadFactoryForTest();
+  std::vector<Thread::ThreadPtr> threads;
+  absl::Notification go;
+  for (uint32_t i = 0; i < num_threads; ++i) {
+    threads.push_back(thread_factory.createThread([&]() {
+      go.WaitForNotification();
+      for (uint32_t i = 0; i < iters; ++i) {
+        sharded->inc();
+        plain->inc();
+      }
+    }));
+  }
+  EXPECT_FALSE(sharded->used());
+  go.Notify();
+  for (uint32_t i = 0; i < num_threads; ++i) {
+    threads[i]->join();
+  }
+
+  EXPECT_TRUE(sharded->used());
+  EXPECT_EQ(num_threads * iters, sharded->value());
+  EXPECT_EQ(plain->value(), sharded->value());
+  EXPECT_EQ(num_threads * iters, sharded->latch());
+  EXPECT_EQ(0, sharded->latch());
+  sharded->add(5);
+  EXPECT_EQ(5, sharded->latch());
+  sharded->reset();
+  EXPECT_EQ(0, sharded->value());
+}
+
 // Test for a race-condition where we may decrement the ref-count of a stat to
 // zero at the same time as we are allocating another instance of that
 // stat. This test reproduces that race organically by having a 12 threads each
@@ -1,3 +1,5 @@
+#include <cmath>
+
 #include "envoy/config/metrics/v3/stats.pb.h"
 
 #include "common/stats/histogram_impl.h"
@@ -95,5 +97,69 @@ TEST_F(HistogramSettingsImplTest, Priority) {
   EXPECT_EQ(settings_->buckets("abcd"), ConstSupportedBuckets({1, 2}));
 }
 
+// Test that fixed buckets are only used by stats matching a config that asks for them.
+TEST_F(HistogramSettingsImplTest, FixedBuckets) {
+  {
+    envoy::config::metrics::v3::HistogramBucketSettings setting;
+    setting.mutable_match()->set_prefix("a");
+    setting.mutable_buckets()->Add(1);
+    setting.set_fixed_buckets(true);
+    buckets_configs_.push_back(setting);
+  }
+
+  {
+    envoy::config::metrics::v3::HistogramBucketSettings setting;
+    setting.mutable_match()->set_prefix("b");
+    setting.mutable_buckets()->Add(2);
+    buckets_configs_.push_back(setting);
+  }
+
+  initialize();
+  EXPECT_TRUE(settings_->fixedBuckets("abcd"));
+  EXPECT_FALSE(settings_->fixedBuckets("bcde"));
+  EXPECT_FALSE(settings_->fixedBuckets("test"));
+}
+
+// Test that a fixed-bucket histogram counts values exactly, including values equal to a bucket's
+// upper bound and values above the last bucket, and interpolates quantiles within the buckets.
+TEST(FixedBucketHistogramTest, Statistics) {
+  const ConstSupportedBuckets buckets{1, 5, 10, 50, 100};
+  FixedBucketHistogram recorded(buckets);
+  for (uint64_t value = 1; value <= 100; ++value) {
+    recorded.recordValue(value);
+  }
+  recorded.recordValue(1000);
+
+  FixedBucketHistogram merged(buckets);
+  recorded.moveTo(merged);
+  for (size_t i = 0; i <= buckets.size(); ++i) {
+    EXPECT_EQ(0, recorded.bucketCount(i));
+  }
+  EXPECT_EQ(0, recorded.sampleSum());
+
+  HistogramStatisticsImpl statistics(buckets);
+  statistics.refresh(merged);
+  EXPECT_EQ(101, statistics.sampleCount());
+  EXPECT_EQ(6050, statistics.sampleSum());
+  EXPECT_EQ(std::vector<uint64_t>({1, 5, 10, 50, 100}), statistics.computedBuckets());
+  // P50 and P99 are interpolated, and P100 is in the overflow bucket.
+  EXPECT_DOUBLE_EQ(50.5, statistics.computedQuantiles()[2]);
+  EXPECT_DOUBLE_EQ(99.99, statistics.computedQuantiles()[6]);
+  EXPECT_DOUBLE_EQ(100, statistics.computedQuantiles().back());
+
+  // Merging again doubles the counts, and an empty histogram has no quantiles.
+  FixedBucketHistogram cumulative(buckets);
+  merged.addTo(cumulative);
+  merged.addTo(cumulative);
+  statistics.refresh(cumulative);
+  EXPECT_EQ(202, statistics.sampleCount());
+  EXPECT_EQ(std::vector<uint64_t>({2, 10, 20, 100, 200}), statistics.computedBuckets());
+
+  merged.clear();
+  statistics.refresh(merged);
+  EXPECT_EQ(0, statistics.sampleCount());
+  EXPECT_TRUE(std::isnan(statistics.computedQuantiles()[2]));
+}
+
 } // namespace Stats
 } // namespace Envoy
@@ -231,7 +231,6 @@ TEST_F(StatNameTest, TestSuccessfulDecode) {
 class StatNameDeathTest : public StatNameTest {
 public:
   void decodeSymbolVec(const SymbolVec& symbol_vec) {
-    Thread::LockGuard lock(table_.lock_);
     for (Symbol symbol : symbol_vec) {
       table_.fromSymbol(symbol);
     }
@@ -682,6 +681,24 @@ TEST_F(StatNameTest, RecentLookups) {
   EXPECT_EQ(0, num_calls);
 }
 
+TEST_F(StatNameTest, RecentLookupsTotalWithoutCapacity) {
+  // With no capacity the names are not remembered, but lookups are still counted.
+  encodeDecode("direct.stat");
+  encodeDecode("other.stat");
+  encodeDecode("direct.stat");
+  uint32_t num_calls = 0;
+  EXPECT_EQ(3, table_.getRecentLookups([&num_calls](absl::string_view, uint64_t) { ++num_calls; }));
+  EXPECT_EQ(0, num_calls);
+
+  table_.setRecentLookupCapacity(10);
+  encodeDecode("direct.stat");
+  EXPECT_EQ(4, table_.getRecentLookups([&num_calls](absl::string_view, uint64_t) { ++num_calls; }));
+  EXPECT_EQ(1, num_calls);
+
+  table_.clearRecentLookups();
+  EXPECT_EQ(0, table_.getRecentLookups([](absl::string_view, uint64_t) {}));
+}
+
 TEST_F(StatNameTest, StatNameEmptyEquivalent) {
   StatName empty1;
   StatName empty2 = makeStat("");
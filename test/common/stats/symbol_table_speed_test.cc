@@ -12,6 +12,7 @@
 #include "test/common/stats/make_elements_helper.h"
 #include "test/test_common/utility.h"
 
+#include "absl/strings/str_cat.h"
 #include "absl/synchronization/blocking_counter.h"
 #include "benchmark/benchmark.h"
 
@@ -90,6 +91,29 @@ static void BM_JoinElements(benchmark::State& state) {
 }
 BENCHMARK(BM_JoinElements);
 
+// Encodes, decodes and frees stat names from many threads at once, as workers do when they create
+// stats with dynamic names. Some tokens are shared by all threads and some are unique to each.
+// NOLINTNEXTLINE(readability-identifier-naming)
+static void BM_EncodeDecodeContention(benchmark::State& state) {
+  // Shared by all of the benchmark's threads, and intentionally leaked so that no thread can
+  // outlive it.
+  static Envoy::Stats::SymbolTableImpl* table = new Envoy::Stats::SymbolTableImpl;
+
+  std::vector<std::string> names;
+  for (uint32_t i = 0; i < 64; ++i) {
+    names.push_back(
+        absl::StrCat("cluster.service_", i, ".upstream_rq_", state.thread_index, ".", i % 7));
+  }
+
+  size_t index = 0;
+  for (auto _ : state) {
+    Envoy::Stats::StatNameStorage storage(names[index++ % names.size()], *table);
+    benchmark::DoNotOptimize(table->toString(storage.statName()));
+    storage.free(*table);
+  }
+}
+BENCHMARK(BM_EncodeDecodeContention)->ThreadRange(1, 64)->UseRealTime();
+
 int main(int argc, char** argv) {
   Envoy::Thread::MutexBasicLockable lock;
   Envoy::Logger::Context logger_context(spdlog::level::warn,
@@ -17,6 +17,7 @@
 #include "test/test_common/test_time.h"
 #include "test/test_common/utility.h"
 
+#include "absl/strings/str_cat.h"
 #include "benchmark/benchmark.h"
 
 namespace Envoy {
@@ -53,6 +54,27 @@ public:
     }
   }
 
+  void createHistograms(uint64_t count) {
+    for (uint64_t i = 0; i < count; ++i) {
+      histograms_.push_back(&store_.histogramFromString(absl::StrCat("cluster.", i, ".rq_time"),
+                                                        Stats::Histogram::Unit::Milliseconds));
+    }
+  }
+
+  void recordHistogramValues() {
+    for (Stats::Histogram* histogram : histograms_) {
+      histogram->recordValue(42);
+    }
+  }
+
+  void mergeHistograms() {
+    bool merged = false;
+    store_.mergeHistograms([&merged]() { merged = true; });
+    while (!merged) {
+      dispatcher_->run(Event::Dispatcher::RunType::NonBlock);
+    }
+  }
+
   void initThreading() {
     if (!Envoy::Event::Libevent::Global::initialized()) {
       Envoy::Event::Libevent::Global::initialize();
@@ -73,6 +95,27 @@ private:
   Api::ApiPtr api_;
   envoy::config::metrics::v3::StatsConfig stats_config_;
   std::vector<std::unique_ptr<Stats::StatNameStorage>> stat_names_;
+  std::vector<Stats::Histogram*> histograms_;
+};
+
+// A plain and a sharded counter, shared by all the threads of a benchmark.
+class CounterContentionPerf {
+public:
+  CounterContentionPerf() : alloc_(symbol_table_), pool_(symbol_table_) {
+    alloc_.setShardedCounterNames({"sharded"});
+    for (absl::string_view name : {"plain", "sharded"}) {
+      const Stats::StatName stat_name = pool_.add(name);
+      counters_.push_back(alloc_.makeCounter(stat_name, stat_name, {}));
+    }
+  }
+
+  Stats::Counter& counter(bool sharded) { return *counters_[sharded ? 1 : 0]; }
+
+private:
+  Stats::SymbolTableImpl symbol_table_;
+  Stats::AllocatorImpl alloc_;
+  Stats::StatNamePool pool_;
+  std::vector<Stats::CounterSharedPtr> counters_;
 };
 
 } // namespace Envoy
@@ -101,5 +144,36 @@ static void BM_StatsWithTls(benchmark::State& state) {
 }
 BENCHMARK(BM_StatsWithTls);
 
+// Merges state.range(0) histograms that each recorded a value in the last interval, as done on
+// every stats flush. There are no worker threads, so this measures the total merge work, all of
+// which runs on the main thread.
+static void BM_HistogramMerge(benchmark::State& state) {
+  Envoy::ThreadLocalStorePerf context;
+  context.initThreading();
+  context.createHistograms(state.range(0));
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    context.recordHistogramValues();
+    state.ResumeTiming();
+    context.mergeHistograms();
+  }
+}
+BENCHMARK(BM_HistogramMerge)->Arg(1000)->Arg(10000)->Arg(50000)->Unit(benchmark::kMillisecond);
+
+// Increments one counter from every thread, as workers do for counters such as
+// downstream_rq_total. With Arg(0) the counter is a single atomic shared by all threads, with
+// Arg(1) it is sharded per thread.
+static void BM_CounterIncContention(benchmark::State& state) {
+  // Shared by all threads of all runs, and never freed.
+  static auto* context = new Envoy::CounterContentionPerf;
+  Envoy::Stats::Counter& counter = context->counter(state.range(0) == 1);
+
+  for (auto _ : state) {
+    counter.inc();
+  }
+}
+BENCHMARK(BM_CounterIncContention)->Arg(0)->Arg(1)->ThreadRange(1, 64)->UseRealTime();
+
 // TODO(jmarantz): add multi-threaded variant of this test, that aggressively
 // looks up stats in multiple threads to try to trigger contention issues.
@@ -1,6 +1,8 @@
 #include <chrono>
 #include <memory>
 #include <string>
+#include <typeinfo>
+#include <vector>
 
 #include "envoy/config/metrics/v3/stats.pb.h"
 #include "envoy/stats/histogram.h"
@@ -20,6 +22,7 @@
 #include "test/mocks/stats/mocks.h"
 #include "test/mocks/thread_local/mocks.h"
 #include "test/test_common/logging.h"
+#include "test/test_common/test_runtime.h"
 #include "test/test_common/utility.h"
 
 #include "absl/strings/str_split.h"
@@ -32,6 +35,7 @@ using testing::_;
 using testing::HasSubstr;
 using testing::InSequence;
 using testing::NiceMock;
+using testing::Not;
 using testing::Ref;
 using testing::Return;
 
@@ -483,6 +487,25 @@ TEST_F(StatsThreadLocalStoreTest, SanitizePrefix) {
   tls_.shutdownThread();
 }
 
+TEST_F(StatsThreadLocalStoreTest, ShardedCounterNames) {
+  envoy::config::metrics::v3::StatsConfig stats_config;
+  TestUtility::loadFromYaml(R"EOF(
+sharded_counter_names:
+- scope.sharded
+)EOF",
+                            stats_config);
+  store_->setShardedCounterNames(std::vector<std::string>(
+      stats_config.sharded_counter_names().begin(), stats_config.sharded_counter_names().end()));
+
+  ScopePtr scope = store_->createScope("scope.");
+  Counter& sharded = scope->counterFromString("sharded");
+  Counter& plain = scope->counterFromString("plain");
+  EXPECT_THAT(typeid(sharded).name(), HasSubstr("ShardedCounterImpl"));
+  EXPECT_THAT(typeid(plain).name(), Not(HasSubstr("ShardedCounterImpl")));
+  sharded.add(3);
+  EXPECT_EQ(3, sharded.value());
+}
+
 TEST_F(StatsThreadLocalStoreTest, ConstSymtabAccessor) {
   ScopePtr scope = store_->createScope("scope.");
   const Scope& cscope = *scope;
@@ -1307,6 +1330,24 @@ TEST_F(HistogramTest, MultiHistogramMultipleMerges) {
   EXPECT_EQ(2, validateMerge());
 }
 
+TEST_F(HistogramTest, MultiHistogramMultipleMergesSerial) {
+  TestScopedRuntime scoped_runtime;
+  Runtime::LoaderSingleton::getExisting()->mergeValues(
+      {{"envoy.reloadable_features.parallel_histogram_merge", "false"}});
+
+  Histogram& h1 = store_->histogramFromString("h1", Stats::Histogram::Unit::Unspecified);
+  Histogram& h2 = store_->histogramFromString("h2", Stats::Histogram::Unit::Unspecified);
+
+  expectCallAndAccumulate(h1, 1);
+  EXPECT_EQ(2, validateMerge());
+
+  expectCallAndAccumulate(h1, 2);
+  expectCallAndAccumulate(h2, 3);
+  EXPECT_EQ(2, validateMerge());
+
+  EXPECT_EQ(2, validateMerge());
+}
+
 TEST_F(HistogramTest, BasicScopeHistogramMerge) {
   ScopePtr scope1 = store_->createScope("scope1.");
 
@@ -1436,6 +1477,40 @@ TEST_F(HistogramTest, ParentHistogramBucketSummary) {
             parent_histogram->bucketSummary());
 }
 
+// Test that a histogram configured with fixed buckets merges its TLS values into exact bucket
+// counts.
+TEST_F(HistogramTest, FixedBucketHistogramMerge) {
+  envoy::config::metrics::v3::StatsConfig config;
+  auto& setting = *config.mutable_histogram_bucket_settings()->Add();
+  setting.mutable_match()->set_prefix("fixed");
+  setting.mutable_buckets()->Add(10);
+  setting.mutable_buckets()->Add(100);
+  setting.set_fixed_buckets(true);
+  store_->setHistogramSettings(std::make_unique<HistogramSettingsImpl>(config));
+
+  Histogram& histogram =
+      store_->histogramFromString("fixed_histogram", Stats::Histogram::Unit::Unspecified);
+  store_->mergeHistograms([]() -> void {});
+  ASSERT_EQ(1, store_->histograms().size());
+  ParentHistogramSharedPtr parent_histogram = store_->histograms()[0];
+  EXPECT_EQ("No recorded values", parent_histogram->bucketSummary());
+
+  EXPECT_CALL(sink_, onHistogramComplete(Ref(histogram), 10));
+  histogram.recordValue(10);
+  EXPECT_CALL(sink_, onHistogramComplete(Ref(histogram), 50));
+  histogram.recordValue(50);
+  store_->mergeHistograms([]() -> void {});
+  EXPECT_EQ("B10(1,1) B100(2,2)", parent_histogram->bucketSummary());
+  EXPECT_EQ(60, parent_histogram->cumulativeStatistics().sampleSum());
+
+  EXPECT_CALL(sink_, onHistogramComplete(Ref(histogram), 1000));
+  histogram.recordValue(1000);
+  store_->mergeHistograms([]() -> void {});
+  EXPECT_EQ("B10(0,1) B100(0,2)", parent_histogram->bucketSummary());
+  EXPECT_EQ(1, parent_histogram->intervalStatistics().sampleCount());
+  EXPECT_EQ(3, parent_histogram->cumulativeStatistics().sampleCount());
+}
+
 class ThreadLocalRealThreadsTestBase : public ThreadLocalStoreNoMocksTestBase {
 protected:
   static constexpr uint32_t NumScopes = 1000;
@@ -578,7 +578,7 @@ TEST_P(TcpConnPoolImplTest, MaxPendingRequests) {
 
   EXPECT_EQ(ConnectionPool::PoolFailureReason::Overflow, callbacks2.reason_);
 
-  EXPECT_EQ(1U, cluster_->stats_.upstream_rq_pending_overflow_.value());
+  EXPECT_EQ(1U, cluster_->traffic_stats_.upstream_rq_pending_overflow_.value());
 }
 
 /**
@@ -602,8 +602,8 @@ TEST_P(TcpConnPoolImplTest, RemoteConnectFailure) {
 
   EXPECT_EQ(ConnectionPool::PoolFailureReason::RemoteConnectionFailure, callbacks.reason_);
 
-  EXPECT_EQ(1U, cluster_->stats_.upstream_cx_connect_fail_.value());
-  EXPECT_EQ(1U, cluster_->stats_.upstream_rq_pending_failure_eject_.value());
+  EXPECT_EQ(1U, cluster_->traffic_stats_.upstream_cx_connect_fail_.value());
+  EXPECT_EQ(1U, cluster_->traffic_stats_.upstream_rq_pending_failure_eject_.value());
 }
 
 /**
@@ -627,8 +627,8 @@ TEST_P(TcpConnPoolImplTest, LocalConnectFailure) {
 
   EXPECT_EQ(ConnectionPool::PoolFailureReason::LocalConnectionFailure, callbacks.reason_);
 
-  EXPECT_EQ(1U, cluster_->stats_.upstream_cx_connect_fail_.value());
-  EXPECT_EQ(1U, cluster_->stats_.upstream_rq_pending_failure_eject_.value());
+  EXPECT_EQ(1U, cluster_->traffic_stats_.upstream_cx_connect_fail_.value());
+  EXPECT_EQ(1U, cluster_->traffic_stats_.upstream_rq_pending_failure_eject_.value());
 }
 
 /**
@@ -658,8 +658,8 @@ TEST_P(TcpConnPoolImplTest, ConnectTimeout) {
   EXPECT_EQ(ConnectionPool::PoolFailureReason::Timeout, callbacks1.reason_);
   EXPECT_EQ(ConnectionPool::PoolFailureReason::Timeout, callbacks2.reason_);
 
-  EXPECT_EQ(2U, cluster_->stats_.upstream_cx_connect_fail_.value());
-  EXPECT_EQ(2U, cluster_->stats_.upstream_cx_connect_timeout_.value());
+  EXPECT_EQ(2U, cluster_->traffic_stats_.upstream_cx_connect_fail_.value());
+  EXPECT_EQ(2U, cluster_->traffic_stats_.upstream_cx_connect_timeout_.value());
 }
 
 /**
@@ -777,7 +777,7 @@ TEST_P(TcpConnPoolImplTest, MaxConnections) {
   // Request 2 should not kick off a new connection.
   ConnPoolCallbacks callbacks2;
   handle = conn_pool_.newConnection(callbacks2);
-  EXPECT_EQ(1U, cluster_->stats_.upstream_cx_overflow_.value());
+  EXPECT_EQ(1U, cluster_->traffic_stats_.upstream_cx_overflow_.value());
 
   EXPECT_NE(nullptr, handle);
 
@@ -823,8 +823,8 @@ TEST_P(TcpConnPoolImplTest, MaxRequestsPerConnection) {
   callbacks.conn_data_.reset();
   dispatcher_.clearDeferredDeleteList();
 
-  EXPECT_EQ(0U, cluster_->stats_.upstream_cx_destroy_with_active_rq_.value());
-  EXPECT_EQ(1U, cluster_->stats_.upstream_cx_max_requests_.value());
+  EXPECT_EQ(0U, cluster_->traffic_stats_.upstream_cx_destroy_with_active_rq_.value());
+  EXPECT_EQ(1U, cluster_->traffic_stats_.upstream_cx_max_requests_.value());
 }
 
 /*
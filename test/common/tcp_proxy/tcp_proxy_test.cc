@@ -31,6 +31,8 @@
 #include "test/mocks/stream_info/mocks.h"
 #include "test/mocks/tcp/mocks.h"
 #include "test/mocks/upstream/host.h"
+#include "test/test_common/simulated_time_system.h"
+#include "test/test_common/test_runtime.h"
 #include "test/test_common/utility.h"
 
 #include "gmock/gmock.h"
@@ -994,6 +996,10 @@ public:
   Upstream::HostDescriptionConstSharedPtr upstream_host_{};
 };
 
+// TcpProxyTest with the mock dispatcher's time source backed by simulated time, for tests of the
+// idle timer.
+class TcpProxyIdleTimeoutTest : public Event::TestUsingSimulatedTime, public TcpProxyTest {};
+
 TEST_F(TcpProxyTest, DEPRECATED_FEATURE_TEST(DefaultRoutes)) {
   envoy::extensions::filters::network::tcp_proxy::v3::TcpProxy config = defaultConfig();
 
@@ -1527,7 +1533,76 @@ TEST_F(TcpProxyTest, DEPRECATED_FEATURE_TEST(UpstreamConnectionLimit)) {
 
 // Tests that the idle timer closes both connections, and gets updated when either
 // connection has activity.
-TEST_F(TcpProxyTest, DEPRECATED_FEATURE_TEST(IdleTimeout)) {
+TEST_F(TcpProxyIdleTimeoutTest, DEPRECATED_FEATURE_TEST(IdleTimeout)) {
+  envoy::extensions::filters::network::tcp_proxy::v3::TcpProxy config = defaultConfig();
+  config.mutable_idle_timeout()->set_seconds(1);
+  setup(1, config);
+
+  // Keep the approximate time current so that each activity is recorded at the simulated time.
+  ON_CALL(filter_callbacks_.connection_.dispatcher_, approximateMonotonicTime())
+      .WillByDefault(Invoke([this]() { return simTime().monotonicTime(); }));
+  Event::MockTimer* idle_timer = new Event::MockTimer(&filter_callbacks_.connection_.dispatcher_);
+  EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(1000), _));
+  raiseEventUpstreamConnected(0);
+
+  // Activity on either connection only records the time of the activity.
+  simTime().advanceTimeWait(std::chrono::milliseconds(100));
+  Buffer::OwnedImpl buffer("hello");
+  filter_->onData(buffer, false);
+
+  simTime().advanceTimeWait(std::chrono::milliseconds(100));
+  buffer.add("hello2");
+  upstream_callbacks_->onUpstreamData(buffer, false);
+
+  simTime().advanceTimeWait(std::chrono::milliseconds(100));
+  filter_callbacks_.connection_.raiseBytesSentCallbacks(1);
+
+  simTime().advanceTimeWait(std::chrono::milliseconds(100));
+  upstream_connections_.at(0)->raiseBytesSentCallbacks(2);
+
+  // The timer fires 600ms after the last activity and is re-armed for the remaining time.
+  simTime().advanceTimeWait(std::chrono::milliseconds(600));
+  EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(400), _));
+  idle_timer->invokeCallback();
+  EXPECT_EQ(0U, config_->stats().idle_timeout_.value());
+
+  simTime().advanceTimeWait(std::chrono::milliseconds(400));
+  EXPECT_CALL(*upstream_connections_.at(0), close(Network::ConnectionCloseType::NoFlush));
+  EXPECT_CALL(filter_callbacks_.connection_, close(Network::ConnectionCloseType::NoFlush));
+  EXPECT_CALL(*idle_timer, disableTimer());
+  idle_timer->invokeCallback();
+  EXPECT_EQ(1U, config_->stats().idle_timeout_.value());
+}
+
+// Tests that the idle timeout is measured against the current time when the timer fires, not the
+// approximate time of the event loop iteration, which can be as old as the last activity.
+TEST_F(TcpProxyIdleTimeoutTest, DEPRECATED_FEATURE_TEST(IdleTimeoutStaleApproximateTime)) {
+  envoy::extensions::filters::network::tcp_proxy::v3::TcpProxy config = defaultConfig();
+  config.mutable_idle_timeout()->set_seconds(1);
+  setup(1, config);
+
+  Event::MockTimer* idle_timer = new Event::MockTimer(&filter_callbacks_.connection_.dispatcher_);
+  EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(1000), _));
+  raiseEventUpstreamConnected(0);
+
+  Buffer::OwnedImpl buffer("hello");
+  filter_->onData(buffer, false);
+
+  // The approximate time is never updated by the mock dispatcher, so it stays at the time of the
+  // last activity. The timer must still time the session out once the full timeout has elapsed.
+  simTime().advanceTimeWait(std::chrono::milliseconds(1000));
+  EXPECT_CALL(*upstream_connections_.at(0), close(Network::ConnectionCloseType::NoFlush));
+  EXPECT_CALL(filter_callbacks_.connection_, close(Network::ConnectionCloseType::NoFlush));
+  EXPECT_CALL(*idle_timer, disableTimer());
+  idle_timer->invokeCallback();
+  EXPECT_EQ(1U, config_->stats().idle_timeout_.value());
+}
+
+// Tests that every read and write re-arms the idle timer when the lazy idle timer is disabled.
+TEST_F(TcpProxyIdleTimeoutTest, DEPRECATED_FEATURE_TEST(IdleTimeoutLazyIdleTimerDisabled)) {
+  TestScopedRuntime scoped_runtime;
+  Runtime::LoaderSingleton::getExisting()->mergeValues(
+      {{"envoy.reloadable_features.tcp_proxy_lazy_idle_timer", "false"}});
   envoy::extensions::filters::network::tcp_proxy::v3::TcpProxy config = defaultConfig();
   config.mutable_idle_timeout()->set_seconds(1);
   setup(1, config);
@@ -1550,10 +1625,12 @@ TEST_F(TcpProxyTest, DEPRECATED_FEATURE_TEST(IdleTimeout)) {
   EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(1000), _));
   upstream_connections_.at(0)->raiseBytesSentCallbacks(2);
 
+  // The timer is not re-armed when it fires.
   EXPECT_CALL(*upstream_connections_.at(0), close(Network::ConnectionCloseType::NoFlush));
   EXPECT_CALL(filter_callbacks_.connection_, close(Network::ConnectionCloseType::NoFlush));
   EXPECT_CALL(*idle_timer, disableTimer());
   idle_timer->invokeCallback();
+  EXPECT_EQ(1U, config_->stats().idle_timeout_.value());
 }
 
 // Tests that the idle timer is disabled when the downstream connection is closed.
@@ -1585,7 +1662,7 @@ TEST_F(TcpProxyTest, DEPRECATED_FEATURE_TEST(IdleTimerDisabledUpstreamClose)) {
 }
 
 // Tests that flushing data during an idle timeout doesn't cause problems.
-TEST_F(TcpProxyTest, DEPRECATED_FEATURE_TEST(IdleTimeoutWithOutstandingDataFlushed)) {
+TEST_F(TcpProxyIdleTimeoutTest, DEPRECATED_FEATURE_TEST(IdleTimeoutWithOutstandingDataFlushed)) {
   envoy::extensions::filters::network::tcp_proxy::v3::TcpProxy config = defaultConfig();
   config.mutable_idle_timeout()->set_seconds(1);
   setup(1, config);
@@ -1595,18 +1672,14 @@ TEST_F(TcpProxyTest, DEPRECATED_FEATURE_TEST(IdleTimeoutWithOutstandingDataFlush
   raiseEventUpstreamConnected(0);
 
   Buffer::OwnedImpl buffer("hello");
-  EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(1000), _));
   filter_->onData(buffer, false);
 
   buffer.add("hello2");
-  EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(1000), _));
   upstream_callbacks_->onUpstreamData(buffer, false);
 
-  EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(1000), _));
   filter_callbacks_.connection_.raiseBytesSentCallbacks(1);
-
-  EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(1000), _));
   upstream_connections_.at(0)->raiseBytesSentCallbacks(2);
+  simTime().advanceTimeWait(std::chrono::milliseconds(1000));
 
   // Mark the upstream connection as blocked.
   // This should read-disable the downstream connection.
@@ -1742,14 +1815,14 @@ TEST_F(TcpProxyTest, DEPRECATED_FEATURE_TEST(UpstreamFlushNoTimeout)) {
 
 // Tests that upstream flush works with an idle timeout configured, but the connection
 // finishes draining before the timer expires.
-TEST_F(TcpProxyTest, DEPRECATED_FEATURE_TEST(UpstreamFlushTimeoutConfigured)) {
+TEST_F(TcpProxyIdleTimeoutTest, DEPRECATED_FEATURE_TEST(UpstreamFlushTimeoutConfigured)) {
   envoy::extensions::filters::network::tcp_proxy::v3::TcpProxy config = defaultConfig();
   config.mutable_idle_timeout()->set_seconds(1);
   setup(1, config);
 
   NiceMock<Event::MockTimer>* idle_timer =
       new NiceMock<Event::MockTimer>(&filter_callbacks_.connection_.dispatcher_);
-  EXPECT_CALL(*idle_timer, enableTimer(_, _));
+  EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(1000), _));
   raiseEventUpstreamConnected(0);
 
   EXPECT_CALL(*upstream_connections_.at(0),
@@ -1757,6 +1830,8 @@ TEST_F(TcpProxyTest, DEPRECATED_FEATURE_TEST(UpstreamFlushTimeoutConfigured)) {
       .WillOnce(Return()); // Cancel default action of raising LocalClose
   EXPECT_CALL(*upstream_connections_.at(0), state())
       .WillOnce(Return(Network::Connection::State::Closing));
+  // The timer is re-armed for the remaining idle time before it is handed to the drainer.
+  EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(1000), _));
   filter_callbacks_.connection_.raiseEvent(Network::ConnectionEvent::RemoteClose);
 
   filter_.reset();
@@ -1774,14 +1849,14 @@ TEST_F(TcpProxyTest, DEPRECATED_FEATURE_TEST(UpstreamFlushTimeoutConfigured)) {
 }
 
 // Tests that upstream flush closes the connection when the idle timeout fires.
-TEST_F(TcpProxyTest, DEPRECATED_FEATURE_TEST(UpstreamFlushTimeoutExpired)) {
+TEST_F(TcpProxyIdleTimeoutTest, DEPRECATED_FEATURE_TEST(UpstreamFlushTimeoutExpired)) {
   envoy::extensions::filters::network::tcp_proxy::v3::TcpProxy config = defaultConfig();
   config.mutable_idle_timeout()->set_seconds(1);
   setup(1, config);
 
   NiceMock<Event::MockTimer>* idle_timer =
       new NiceMock<Event::MockTimer>(&filter_callbacks_.connection_.dispatcher_);
-  EXPECT_CALL(*idle_timer, enableTimer(_, _));
+  EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(1000), _));
   raiseEventUpstreamConnected(0);
 
   EXPECT_CALL(*upstream_connections_.at(0),
@@ -1789,6 +1864,8 @@ TEST_F(TcpProxyTest, DEPRECATED_FEATURE_TEST(UpstreamFlushTimeoutExpired)) {
       .WillOnce(Return()); // Cancel default action of raising LocalClose
   EXPECT_CALL(*upstream_connections_.at(0), state())
       .WillOnce(Return(Network::Connection::State::Closing));
+  // The timer is re-armed for the remaining idle time before it is handed to the drainer.
+  EXPECT_CALL(*idle_timer, enableTimer(std::chrono::milliseconds(1000), _));
   filter_callbacks_.connection_.raiseEvent(Network::ConnectionEvent::RemoteClose);
 
   filter_.reset();
@@ -117,6 +117,8 @@ TEST_F(BoundedLoadHashingLoadBalancerTest, NoHostEverOverloaded) {
     EXPECT_NE(host, nullptr);
     EXPECT_EQ(host->address()->asString(), fmt::format("127.0.0.1{}:90", i));
   }
+  EXPECT_EQ(0, info_->stats_.lb_bounded_load_overflow_.value());
+  EXPECT_EQ(0, info_->stats_.lb_bounded_load_overflow_probes_.value());
 };
 
 // Works correctly for the case one host is overloaded.
@@ -143,6 +145,9 @@ TEST_F(BoundedLoadHashingLoadBalancerTest, OneHostOverloaded) {
   HostConstSharedPtr host = lb_->chooseHost(2, 1);
   EXPECT_NE(host, nullptr);
   EXPECT_EQ(host->address()->asString(), "127.0.0.11:90");
+  EXPECT_EQ(1, info_->stats_.lb_bounded_load_overflow_.value());
+  EXPECT_EQ(1, info_->stats_.lb_bounded_load_overflow_probes_.value());
+  EXPECT_EQ(0, info_->stats_.lb_bounded_load_all_hosts_overloaded_.value());
 };
 
 // Works correctly for the case a few hosts are overloaded.
@@ -171,6 +176,9 @@ TEST_F(BoundedLoadHashingLoadBalancerTest, MultipleHostOverloaded) {
   HostConstSharedPtr host = lb_->chooseHost(2, 1);
   EXPECT_NE(host, nullptr);
   EXPECT_EQ(host->address()->asString(), "127.0.0.14:90");
+  EXPECT_EQ(1, info_->stats_.lb_bounded_load_overflow_.value());
+  EXPECT_EQ(3, info_->stats_.lb_bounded_load_overflow_probes_.value());
+  EXPECT_EQ(0, info_->stats_.lb_bounded_load_all_hosts_overloaded_.value());
 };
 
 // Works correctly for the case when requests with different hash map to the same
@@ -206,6 +214,7 @@ TEST_F(BoundedLoadHashingLoadBalancerTest, MultipleHashSameHostOverloaded) {
   EXPECT_EQ(host1->address()->asString(), "127.0.0.14:90");
   // sequence for 5 is 01432, 0 is the first host not overloaded
   EXPECT_EQ(host2->address()->asString(), "127.0.0.10:90");
+  EXPECT_EQ(2, info_->stats_.lb_bounded_load_overflow_.value());
 };
 
 // Works correctly for the case when all hosts are overloaded
@@ -228,6 +237,9 @@ TEST_F(BoundedLoadHashingLoadBalancerTest, AllHostsOverloaded) {
   HostConstSharedPtr host = lb_->chooseHost(0, 1);
   EXPECT_NE(host, nullptr);
   EXPECT_EQ(host->address()->asString(), "127.0.0.11:90");
+  EXPECT_EQ(1, info_->stats_.lb_bounded_load_overflow_.value());
+  EXPECT_EQ(2, info_->stats_.lb_bounded_load_overflow_probes_.value());
+  EXPECT_EQ(1, info_->stats_.lb_bounded_load_all_hosts_overloaded_.value());
 };
 
 } // namespace
@@ -12,6 +12,7 @@
 #include "test/mocks/upstream/health_checker.h"
 #include "test/mocks/upstream/load_balancer_context.h"
 #include "test/mocks/upstream/thread_aware_load_balancer.h"
+#include "test/test_common/test_runtime.h"
 
 namespace Envoy {
 namespace Upstream {
@@ -592,6 +593,25 @@ TEST_F(ClusterManagerImplTest, SubsetLoadBalancerClusterProvidedLbRestriction) {
       "cluster: LB policy CLUSTER_PROVIDED cannot be combined with lb_subset_config");
 }
 
+TEST_F(ClusterManagerImplTest, SubsetLoadBalancerPeakEwmaLbRestriction) {
+  const std::string yaml = R"EOF(
+ static_resources:
+  clusters:
+  - name: cluster_1
+    connect_timeout: 0.250s
+    type: static
+    lb_policy: peak_ewma
+    lb_subset_config:
+      fallback_policy: ANY_ENDPOINT
+      subset_selectors:
+        - keys: [ "x" ]
+  )EOF";
+
+  EXPECT_THROW_WITH_MESSAGE(
+      create(parseBootstrapFromV3Yaml(yaml)), EnvoyException,
+      "cluster: LB policy PEAK_EWMA cannot be combined with lb_subset_config");
+}
+
 TEST_F(ClusterManagerImplTest, SubsetLoadBalancerLocalityAware) {
   const std::string yaml = R"EOF(
  static_resources:
@@ -682,6 +702,43 @@ TEST_F(ClusterManagerImplTest, RingHashLoadBalancerV2Initialization) {
   create(parseBootstrapFromV3Yaml(yaml));
 }
 
+// Verify that the peak EWMA load balancer is created and fed the response times of the cluster.
+TEST_F(ClusterManagerImplTest, PeakEwmaLoadBalancerInitialization) {
+  const std::string yaml = R"EOF(
+  static_resources:
+    clusters:
+    - name: cluster_1
+      connect_timeout: 0.250s
+      lb_policy: PEAK_EWMA
+      peak_ewma_lb_config:
+        choice_count: 3
+        decay_time: 5s
+      load_assignment:
+        cluster_name: cluster_1
+        endpoints:
+        - lb_endpoints:
+          - endpoint:
+              address:
+                socket_address:
+                  address: 127.0.0.1
+                  port_value: 8000
+          - endpoint:
+              address:
+                socket_address:
+                  address: 127.0.0.1
+                  port_value: 8001
+  )EOF";
+  create(parseBootstrapFromV3Yaml(yaml));
+
+  ThreadLocalCluster* cluster = cluster_manager_->get("cluster_1");
+  ASSERT_NE(nullptr, cluster);
+  EXPECT_EQ(LoadBalancerType::PeakEwma, cluster->info()->lbType());
+  HostConstSharedPtr host = cluster->loadBalancer().chooseHost(nullptr);
+  ASSERT_NE(nullptr, host);
+  cluster->putResponseTime(*host, std::chrono::milliseconds(10));
+  EXPECT_NE(nullptr, cluster->loadBalancer().chooseHost(nullptr));
+}
+
 // Verify EDS clusters have EDS config.
 TEST_F(ClusterManagerImplTest, EdsClustersRequireEdsConfig) {
   const std::string yaml = R"EOF(
@@ -1438,6 +1495,66 @@ TEST_F(ClusterManagerImplTest, DynamicAddRemove) {
   EXPECT_TRUE(Mock::VerifyAndClearExpectations(callbacks.get()));
 }
 
+// Verify that when thread local clusters are created on first use, adding and updating a cluster
+// does not create its thread local state, and the first use creates it with the latest cluster and
+// hosts.
+TEST_F(ClusterManagerImplTest, LazyThreadLocalClusters) {
+  TestScopedRuntime scoped_runtime;
+  Runtime::LoaderSingleton::getExisting()->mergeValues(
+      {{"envoy.reloadable_features.lazy_thread_local_clusters", "true"}});
+  create(defaultConfig());
+
+  // The thread local cluster calls lbSubsetInfo() when it is created.
+  std::shared_ptr<MockClusterMockPrioritySet> cluster1(new NiceMock<MockClusterMockPrioritySet>());
+  cluster1->prioritySet().getMockHostSet(0)->hosts_ = {
+      makeTestHost(cluster1->info_, "tcp://127.0.0.1:80")};
+  EXPECT_CALL(*cluster1->info_, lbSubsetInfo()).Times(0);
+  EXPECT_CALL(factory_, clusterFromProto_(_, _, _, _))
+      .WillOnce(Return(std::make_pair(cluster1, nullptr)));
+  EXPECT_CALL(*cluster1, initialize(_))
+      .WillOnce(Invoke([](std::function<void()> initialize_callback) { initialize_callback(); }));
+  EXPECT_TRUE(cluster_manager_->addOrUpdateCluster(defaultStaticCluster("fake_cluster"), ""));
+
+  auto update_cluster = defaultStaticCluster("fake_cluster");
+  update_cluster.mutable_per_connection_buffer_limit_bytes()->set_value(12345);
+  std::shared_ptr<MockClusterMockPrioritySet> cluster2(new NiceMock<MockClusterMockPrioritySet>());
+  cluster2->prioritySet().getMockHostSet(0)->hosts_ = {
+      makeTestHost(cluster2->info_, "tcp://127.0.0.1:81")};
+  EXPECT_CALL(*cluster2->info_, lbSubsetInfo()).Times(0);
+  EXPECT_CALL(factory_, clusterFromProto_(_, _, _, _))
+      .WillOnce(Return(std::make_pair(cluster2, nullptr)));
+  EXPECT_CALL(*cluster2, initialize(_))
+      .WillOnce(Invoke([](std::function<void()> initialize_callback) { initialize_callback(); }));
+  EXPECT_TRUE(cluster_manager_->addOrUpdateCluster(update_cluster, ""));
+  checkStats(1 /*added*/, 1 /*modified*/, 0 /*removed*/, 1 /*active*/, 0 /*warming*/);
+
+  // The first use creates the thread local cluster, only once.
+  EXPECT_CALL(*cluster2->info_, lbSubsetInfo());
+  ThreadLocalCluster* cluster = cluster_manager_->get("fake_cluster");
+  ASSERT_NE(nullptr, cluster);
+  EXPECT_EQ(cluster2->info_, cluster->info());
+  ASSERT_EQ(1U, cluster->prioritySet().hostSetsPerPriority()[0]->hosts().size());
+  EXPECT_EQ(cluster2->prioritySet().getMockHostSet(0)->hosts_[0],
+            cluster->prioritySet().hostSetsPerPriority()[0]->hosts()[0]);
+  EXPECT_EQ(cluster, cluster_manager_->get("fake_cluster"));
+  EXPECT_EQ(nullptr, cluster_manager_->get("unknown_cluster"));
+
+  // A cluster that was never used can be removed.
+  std::shared_ptr<MockClusterMockPrioritySet> cluster3(new NiceMock<MockClusterMockPrioritySet>());
+  cluster3->info_->name_ = "unused_cluster";
+  EXPECT_CALL(*cluster3->info_, lbSubsetInfo()).Times(0);
+  EXPECT_CALL(factory_, clusterFromProto_(_, _, _, _))
+      .WillOnce(Return(std::make_pair(cluster3, nullptr)));
+  EXPECT_CALL(*cluster3, initialize(_))
+      .WillOnce(Invoke([](std::function<void()> initialize_callback) { initialize_callback(); }));
+  EXPECT_TRUE(cluster_manager_->addOrUpdateCluster(defaultStaticCluster("unused_cluster"), ""));
+  EXPECT_TRUE(cluster_manager_->removeCluster("unused_cluster"));
+  EXPECT_EQ(nullptr, cluster_manager_->get("unused_cluster"));
+
+  EXPECT_TRUE(cluster_manager_->removeCluster("fake_cluster"));
+  EXPECT_EQ(nullptr, cluster_manager_->get("fake_cluster"));
+}
+
 TEST_F(ClusterManagerImplTest, AddOrUpdateClusterStaticExists) {
   const std::string json = fmt::sprintf("{\"static_resources\":{%s}}",
                                         clustersJson({defaultStaticClusterJson("fake_cluster")}));
@@ -231,7 +231,7 @@ TEST_F(ConnPoolMapImplTest, GetPoolHittingLimitIncrementsFailureCounter) {
   ON_CALL(*mock_pools_[0], hasActiveConnections()).WillByDefault(Return(true));
   test_map->getPool(2, getNeverCalledFactory());
 
-  EXPECT_EQ(host_->cluster_.stats_.upstream_cx_pool_overflow_.value(), 1);
+  EXPECT_EQ(host_->cluster_.traffic_stats_.upstream_cx_pool_overflow_.value(), 1);
 }
 
 TEST_F(ConnPoolMapImplTest, GetPoolHittingLimitIncrementsFailureMultiple) {
@@ -243,7 +243,7 @@ TEST_F(ConnPoolMapImplTest, GetPoolHittingLimitIncrementsFailureMultiple) {
   test_map->getPool(2, getNeverCalledFactory());
   test_map->getPool(2, getNeverCalledFactory());
 
-  EXPECT_EQ(host_->cluster_.stats_.upstream_cx_pool_overflow_.value(), 3);
+  EXPECT_EQ(host_->cluster_.traffic_stats_.upstream_cx_pool_overflow_.value(), 3);
 }
 
 TEST_F(ConnPoolMapImplTest, GetPoolHittingLimitGreaterThan1Fails) {
@@ -280,7 +280,7 @@ TEST_F(ConnPoolMapImplTest, GetPoolLimitHitFollowedBySuccessDoesNotClearFailure)
   ON_CALL(*mock_pools_[0], hasActiveConnections()).WillByDefault(Return(false));
 
   test_map->getPool(2, getBasicFactory());
-  EXPECT_EQ(host_->cluster_.stats_.upstream_cx_pool_overflow_.value(), 1);
+  EXPECT_EQ(host_->cluster_.traffic_stats_.upstream_cx_pool_overflow_.value(), 1);
 }
 
 // Test that only the pool which are idle are actually cleared
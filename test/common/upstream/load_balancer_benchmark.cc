@@ -5,6 +5,7 @@
 #include "envoy/config/cluster/v3/cluster.pb.h"
 
 #include "common/common/random_generator.h"
+#include "common/common/utility.h"
 #include "common/memory/stats.h"
 #include "common/upstream/maglev_lb.h"
 #include "common/upstream/ring_hash_lb.h"
@@ -14,6 +15,7 @@
 #include "test/benchmark/main.h"
 #include "test/common/upstream/utility.h"
 #include "test/mocks/upstream/cluster_info.h"
+#include "test/test_common/test_runtime.h"
 
 #include "benchmark/benchmark.h"
 
@@ -166,6 +168,14 @@ public:
                                                       random_, config_, common_config_);
   }
 
+  void updateHosts(const HostVector& hosts, const HostVector& hosts_added,
+                   const HostVector& hosts_removed) {
+    HostVectorConstSharedPtr updated_hosts = std::make_shared<HostVector>(hosts);
+    priority_set_.updateHosts(
+        0, HostSetImpl::partitionHosts(updated_hosts, makeHostsPerLocality({hosts})), {},
+        hosts_added, hosts_removed, absl::nullopt);
+  }
+
   absl::optional<envoy::config::cluster::v3::Cluster::MaglevLbConfig> config_;
   std::unique_ptr<MaglevLoadBalancer> maglev_lb_;
 };
@@ -198,6 +208,8 @@ BENCHMARK(benchmarkRingHashLoadBalancerBuildRing)
     ->Args({100, 65536})
     ->Args({200, 65536})
     ->Args({500, 65536})
+    ->Args({2000, 65536})
+    ->Args({2000, 1048576})
     ->Args({100, 256000})
     ->Args({200, 256000})
     ->Args({500, 256000})
@@ -227,6 +239,57 @@ BENCHMARK(benchmarkMaglevLoadBalancerBuildTable)
     ->Arg(500)
     ->Unit(::benchmark::kMillisecond);
 
+// Measures rebuilding the table after one host is removed or added back, or after the weight of
+// one host changes, with and without incremental table rebuilds.
+void benchmarkMaglevLoadBalancerRebuildTable(::benchmark::State& state) {
+  const uint64_t num_hosts = state.range(0);
+  const bool change_weight = state.range(1);
+  const bool incremental = state.range(2);
+
+  if (benchmark::skipExpensiveBenchmarks() && num_hosts > 1000) {
+    state.SkipWithError("Skipping expensive benchmark");
+    return;
+  }
+
+  TestScopedRuntime scoped_runtime;
+  Runtime::LoaderSingleton::getExisting()->mergeValues(
+      {{"envoy.reloadable_features.maglev_incremental_table_rebuild",
+        incremental ? "true" : "false"}});
+
+  MaglevTester tester(num_hosts);
+  tester.maglev_lb_->initialize();
+  const HostVector all_hosts = tester.priority_set_.hostSetsPerPriority()[0]->hosts();
+  const HostVector fewer_hosts(all_hosts.begin(), all_hosts.end() - 1);
+  const HostVector churned_host{all_hosts.back()};
+  bool host_removed = false;
+  for (auto _ : state) { // NOLINT: Silences warning about dead store
+    if (change_weight) {
+      all_hosts[0]->weight(all_hosts[0]->weight() == 1 ? 2 : 1);
+      tester.updateHosts(all_hosts, {}, {});
+    } else if (host_removed) {
+      tester.updateHosts(all_hosts, churned_host, {});
+      host_removed = false;
+    } else {
+      tester.updateHosts(fewer_hosts, {}, churned_host);
+      host_removed = true;
+    }
+  }
+}
+BENCHMARK(benchmarkMaglevLoadBalancerRebuildTable)
+    ->Args({1000, false, false})
+    ->Args({1000, false, true})
+    ->Args({2000, false, false})
+    ->Args({2000, false, true})
+    ->Args({5000, false, false})
+    ->Args({5000, false, true})
+    ->Args({10000, false, false})
+    ->Args({10000, false, true})
+    ->Args({1000, true, false})
+    ->Args({1000, true, true})
+    ->Args({10000, true, false})
+    ->Args({10000, true, true})
+    ->Unit(::benchmark::kMillisecond);
+
 class TestLoadBalancerContext : public LoadBalancerContextBase {
 public:
   // Upstream::LoadBalancerContext
@@ -336,6 +399,26 @@ BENCHMARK(benchmarkRingHashLoadBalancerChooseHost)
     ->Args({500, 256000, 100000})
     ->Unit(::benchmark::kMillisecond);
 
+// Unlike benchmarkRingHashLoadBalancerChooseHost, this only times the ring lookups, and not the
+// counting of the hits per host.
+void benchmarkRingHashLoadBalancerLookup(::benchmark::State& state) {
+  const uint64_t num_hosts = state.range(0);
+  const uint64_t min_ring_size = state.range(1);
+  RingHashTester tester(num_hosts, min_ring_size);
+  tester.ring_hash_lb_->initialize();
+  LoadBalancerPtr lb = tester.ring_hash_lb_->factory()->create();
+  TestLoadBalancerContext context;
+  uint64_t i = 0;
+  for (auto _ : state) { // NOLINT: Silences warning about dead store
+    context.hash_key_ = hashInt(i++);
+    ::benchmark::DoNotOptimize(lb->chooseHost(&context));
+  }
+}
+BENCHMARK(benchmarkRingHashLoadBalancerLookup)
+    ->Args({100, 65536})
+    ->Args({2000, 65536})
+    ->Args({2000, 1048576});
+
 void benchmarkMaglevLoadBalancerChooseHost(::benchmark::State& state) {
   for (auto _ : state) { // NOLINT: Silences warning about dead store
     // Do not time the creation of the table.
@@ -529,7 +612,7 @@ BENCHMARK(benchmarkMaglevLoadBalancerWeighted)
 
 class SubsetLbTester : public BaseTester {
 public:
-  SubsetLbTester(uint64_t num_hosts, bool single_host_per_subset)
+  SubsetLbTester(uint64_t num_hosts, bool single_host_per_subset, bool lazy_subsets = false)
       : BaseTester(num_hosts, 0, 0, true /* attach metadata */) {
     envoy::config::cluster::v3::Cluster::LbSubsetConfig subset_config;
     subset_config.set_fallback_policy(
@@ -537,12 +620,13 @@ public:
     auto* selector = subset_config.mutable_subset_selectors()->Add();
     selector->set_single_host_per_subset(single_host_per_subset);
     *selector->mutable_keys()->Add() = metadata_key;
+    subset_config.set_lazy_subsets(lazy_subsets);
 
     subset_info_ = std::make_unique<LoadBalancerSubsetInfoImpl>(subset_config);
     lb_ = std::make_unique<SubsetLoadBalancer>(LoadBalancerType::Random, priority_set_,
                                                &local_priority_set_, stats_, stats_store_, runtime_,
                                                random_, *subset_info_, absl::nullopt, absl::nullopt,
-                                               absl::nullopt, common_config_);
+                                               absl::nullopt, common_config_, time_source_);
 
     const HostVector& hosts = priority_set_.getOrCreateHostSet(0).hosts();
     ASSERT(hosts.size() == num_hosts);
@@ -563,6 +647,7 @@ public:
   }
 
   std::unique_ptr<LoadBalancerSubsetInfoImpl> subset_info_;
+  RealTimeSource time_source_;
   std::unique_ptr<SubsetLoadBalancer> lb_;
   HostVectorConstSharedPtr orig_hosts_;
   HostVectorConstSharedPtr smaller_hosts_;
@@ -571,6 +656,51 @@ public:
   HostVector host_moved_;
 };
 
+// Selects the subset of the hosts whose metadata value is the given number.
+class SubsetLbContext : public LoadBalancerContextBase {
+public:
+  explicit SubsetLbContext(uint64_t value) {
+    ProtobufWkt::Value metadata_value;
+    metadata_value.set_number_value(value);
+    criteria_.criteria_.push_back(std::make_shared<const Criterion>(HashedValue(metadata_value)));
+  }
+
+  // Upstream::LoadBalancerContext
+  const Router::MetadataMatchCriteria* metadataMatchCriteria() override { return &criteria_; }
+
+private:
+  struct Criterion : public Router::MetadataMatchCriterion {
+    explicit Criterion(const HashedValue& value) : value_(value) {}
+
+    // Router::MetadataMatchCriterion
+    const std::string& name() const override { return name_; }
+    const HashedValue& value() const override { return value_; }
+
+    const std::string name_{BaseTester::metadata_key};
+    const HashedValue value_;
+  };
+
+  struct Criteria : public Router::MetadataMatchCriteria {
+    // Router::MetadataMatchCriteria
+    const std::vector<Router::MetadataMatchCriterionConstSharedPtr>&
+    metadataMatchCriteria() const override {
+      return criteria_;
+    }
+    Router::MetadataMatchCriteriaConstPtr
+    mergeMatchCriteria(const ProtobufWkt::Struct&) const override {
+      return nullptr;
+    }
+    Router::MetadataMatchCriteriaConstPtr
+    filterMatchCriteria(const std::set<std::string>&) const override {
+      return nullptr;
+    }
+
+    std::vector<Router::MetadataMatchCriterionConstSharedPtr> criteria_;
+  };
+
+  Criteria criteria_;
+};
+
 void benchmarkSubsetLoadBalancerCreate(::benchmark::State& state) {
   const bool single_host_per_subset = state.range(0);
   const uint64_t num_hosts = state.range(1);
@@ -607,6 +737,39 @@ BENCHMARK(benchmarkSubsetLoadBalancerUpdate)
     ->Ranges({{false, true}, {50, 2500}})
     ->Unit(::benchmark::kMillisecond);
 
+// With lazy subsets, the cost of an update depends on the number of subsets that requests selected
+// rather than on the number of metadata values, which is the number of hosts here.
+void benchmarkSubsetLoadBalancerLazyUpdate(::benchmark::State& state) {
+  const uint64_t num_hosts = state.range(0);
+  const uint64_t num_selected_subsets = state.range(1);
+  if (benchmark::skipExpensiveBenchmarks() && num_hosts > 100) {
+    state.SkipWithError("Skipping expensive benchmark");
+    return;
+  }
+
+  SubsetLbTester tester(num_hosts, false, true /* lazy subsets */);
+  // The first host is removed and added back by each update, so its subset is not selected.
+  ASSERT(num_selected_subsets < num_hosts);
+  for (uint64_t i = 1; i <= num_selected_subsets; i++) {
+    SubsetLbContext context(i);
+    tester.lb_->chooseHost(&context);
+  }
+
+  for (auto _ : state) { // NOLINT: Silences warning about dead store
+    tester.update();
+  }
+  state.counters["subsets"] = tester.stats_.lb_subsets_active_.value();
+}
+
+BENCHMARK(benchmarkSubsetLoadBalancerLazyUpdate)
+    ->Args({50, 0})
+    ->Args({50, 10})
+    ->Args({2500, 0})
+    ->Args({2500, 10})
+    ->Args({2500, 100})
+    ->Args({2500, 1000})
+    ->Unit(::benchmark::kMillisecond);
+
 } // namespace
 } // namespace Upstream
 } // namespace Envoy
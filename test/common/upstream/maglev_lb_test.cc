@@ -9,6 +9,7 @@
 #include "test/mocks/upstream/cluster_info.h"
 #include "test/mocks/upstream/host_set.h"
 #include "test/mocks/upstream/priority_set.h"
+#include "test/test_common/test_runtime.h"
 
 namespace Envoy {
 namespace Upstream {
@@ -68,6 +69,16 @@ public:
   std::unique_ptr<MaglevLoadBalancer> lb_;
 };
 
+std::vector<HostConstSharedPtr> tableAssignments(MaglevLoadBalancer& lb, uint64_t table_size) {
+  LoadBalancerPtr worker_lb = lb.factory()->create();
+  std::vector<HostConstSharedPtr> assignments;
+  for (uint64_t i = 0; i < table_size; ++i) {
+    TestLoadBalancerContext context(i);
+    assignments.push_back(worker_lb->chooseHost(&context));
+  }
+  return assignments;
+}
+
 // Works correctly without any hosts.
 TEST_F(MaglevLoadBalancerTest, NoHost) {
   init(7);
@@ -428,6 +439,108 @@ TEST_F(MaglevLoadBalancerTest, LocalityWeightedLopsided) {
   EXPECT_EQ(MaglevTable::DefaultTableSize - 1023, counts[0]);
 }
 
+// With incremental rebuilds enabled, removing or adding back a host only moves the keys of that
+// host.
+TEST_F(MaglevLoadBalancerTest, IncrementalRebuild) {
+  TestScopedRuntime scoped_runtime;
+  Runtime::LoaderSingleton::getExisting()->mergeValues(
+      {{"envoy.reloadable_features.maglev_incremental_table_rebuild", "true"}});
+
+  for (uint32_t i = 0; i < 20; ++i) {
+    host_set_.hosts_.push_back(makeTestHost(info_, fmt::format("tcp://127.0.0.1:{}", i)));
+  }
+  host_set_.healthy_hosts_ = host_set_.hosts_;
+  host_set_.runCallbacks({}, {});
+  init(1009);
+  EXPECT_EQ(50, lb_->stats().min_entries_per_host_.value());
+  EXPECT_EQ(51, lb_->stats().max_entries_per_host_.value());
+  const std::vector<HostConstSharedPtr> initial = tableAssignments(*lb_, 1009);
+
+  HostSharedPtr removed = host_set_.hosts_.back();
+  host_set_.hosts_.pop_back();
+  host_set_.healthy_hosts_ = host_set_.hosts_;
+  host_set_.runCallbacks({}, {removed});
+  EXPECT_EQ(53, lb_->stats().min_entries_per_host_.value());
+  EXPECT_EQ(54, lb_->stats().max_entries_per_host_.value());
+  const std::vector<HostConstSharedPtr> after_removal = tableAssignments(*lb_, 1009);
+  for (uint64_t i = 0; i < 1009; ++i) {
+    EXPECT_NE(removed, after_removal[i]);
+    if (initial[i] != removed) {
+      EXPECT_EQ(initial[i], after_removal[i]);
+    }
+  }
+
+  host_set_.hosts_.push_back(removed);
+  host_set_.healthy_hosts_ = host_set_.hosts_;
+  host_set_.runCallbacks({removed}, {});
+  EXPECT_EQ(50, lb_->stats().min_entries_per_host_.value());
+  EXPECT_EQ(51, lb_->stats().max_entries_per_host_.value());
+  const std::vector<HostConstSharedPtr> after_addition = tableAssignments(*lb_, 1009);
+  for (uint64_t i = 0; i < 1009; ++i) {
+    if (after_addition[i] != removed) {
+      EXPECT_EQ(after_removal[i], after_addition[i]);
+    }
+  }
+}
+
+// When too many hosts change at once the table is rebuilt from scratch, and so is identical to
+// the table of a new load balancer.
+TEST_F(MaglevLoadBalancerTest, IncrementalRebuildFallsBackOnLargeChange) {
+  TestScopedRuntime scoped_runtime;
+  Runtime::LoaderSingleton::getExisting()->mergeValues(
+      {{"envoy.reloadable_features.maglev_incremental_table_rebuild", "true"}});
+
+  for (uint32_t i = 0; i < 10; ++i) {
+    host_set_.hosts_.push_back(makeTestHost(info_, fmt::format("tcp://127.0.0.1:{}", i)));
+  }
+  host_set_.healthy_hosts_ = host_set_.hosts_;
+  host_set_.runCallbacks({}, {});
+  init(1009);
+
+  HostVector removed{host_set_.hosts_[0], host_set_.hosts_[1]};
+  host_set_.hosts_.erase(host_set_.hosts_.begin(), host_set_.hosts_.begin() + 2);
+  host_set_.healthy_hosts_ = host_set_.hosts_;
+  host_set_.runCallbacks({}, removed);
+  const std::vector<HostConstSharedPtr> rebuilt = tableAssignments(*lb_, 1009);
+
+  std::unique_ptr<MaglevLoadBalancer> previous_lb = std::move(lb_);
+  init(1009);
+  EXPECT_EQ(tableAssignments(*lb_, 1009), rebuilt);
+}
+
+// The table of a removed priority is dropped, so a priority added back in its place is built from
+// scratch rather than incrementally from the stale table.
+TEST_F(MaglevLoadBalancerTest, IncrementalRebuildAfterPriorityRemoved) {
+  TestScopedRuntime scoped_runtime;
+  Runtime::LoaderSingleton::getExisting()->mergeValues(
+      {{"envoy.reloadable_features.maglev_incremental_table_rebuild", "true"}});
+
+  HostVector hosts;
+  for (uint32_t i = 0; i < 20; ++i) {
+    hosts.push_back(makeTestHost(info_, fmt::format("tcp://127.0.0.1:{}", i)));
+  }
+  MockHostSet& host_set_1 = *priority_set_.getMockHostSet(1);
+  host_set_1.hosts_ = hosts;
+  host_set_1.healthy_hosts_ = hosts;
+  host_set_1.runCallbacks({}, {});
+  init(1009);
+
+  priority_set_.host_sets_.pop_back();
+  host_set_.runCallbacks({}, {});
+
+  HostSharedPtr removed = hosts.back();
+  hosts.pop_back();
+  MockHostSet& new_host_set_1 = *priority_set_.getMockHostSet(1);
+  new_host_set_1.hosts_ = hosts;
+  new_host_set_1.healthy_hosts_ = hosts;
+  new_host_set_1.runCallbacks({}, {removed});
+  const std::vector<HostConstSharedPtr> rebuilt = tableAssignments(*lb_, 1009);
+
+  std::unique_ptr<MaglevLoadBalancer> previous_lb = std::move(lb_);
+  init(1009);
+  EXPECT_EQ(tableAssignments(*lb_, 1009), rebuilt);
+}
+
 } // namespace
 } // namespace Upstream
 } // namespace Envoy
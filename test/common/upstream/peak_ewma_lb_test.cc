@@ -0,0 +1,198 @@
+#include <chrono>
+#include <memory>
+
+#include "envoy/config/cluster/v3/cluster.pb.h"
+
+#include "common/upstream/peak_ewma_lb.h"
+
+#include "test/common/upstream/utility.h"
+#include "test/mocks/common.h"
+#include "test/mocks/runtime/mocks.h"
+#include "test/mocks/upstream/cluster_info.h"
+#include "test/mocks/upstream/host_set.h"
+#include "test/mocks/upstream/priority_set.h"
+#include "test/test_common/simulated_time_system.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using testing::NiceMock;
+using testing::Return;
+
+namespace Envoy {
+namespace Upstream {
+namespace {
+
+class PeakEwmaLoadBalancerTest : public Event::TestUsingSimulatedTime, public testing::Test {
+public:
+  PeakEwmaLoadBalancerTest() : stats_(ClusterInfoImpl::generateStats(stats_store_)) {}
+
+  void init() {
+    lb_ = std::make_unique<PeakEwmaLoadBalancer>(priority_set_, nullptr, stats_, runtime_, random_,
+                                                 common_config_, config_, simTime());
+  }
+
+  void addHosts(uint32_t num_hosts) {
+    HostVector hosts_added;
+    for (uint32_t i = 0; i < num_hosts; ++i) {
+      hosts_added.push_back(
+          makeTestHost(info_, fmt::format("tcp://127.0.0.1:{}", host_set_.hosts_.size())));
+      host_set_.hosts_.push_back(hosts_added.back());
+    }
+    host_set_.healthy_hosts_ = host_set_.hosts_;
+    host_set_.runCallbacks(hosts_added, {});
+  }
+
+  // Picks between the first two hosts.
+  HostConstSharedPtr chooseBetweenFirstTwoHosts() {
+    EXPECT_CALL(random_, random()).WillOnce(Return(0)).WillOnce(Return(0)).WillOnce(Return(1));
+    return lb_->chooseHost(nullptr);
+  }
+
+  NiceMock<MockPrioritySet> priority_set_;
+  MockHostSet& host_set_ = *priority_set_.getMockHostSet(0);
+  std::shared_ptr<MockClusterInfo> info_{new NiceMock<MockClusterInfo>()};
+  Stats::IsolatedStoreImpl stats_store_;
+  ClusterStats stats_;
+  absl::optional<envoy::config::cluster::v3::Cluster::PeakEwmaLbConfig> config_;
+  envoy::config::cluster::v3::Cluster::CommonLbConfig common_config_;
+  NiceMock<Runtime::MockLoader> runtime_;
+  NiceMock<Random::MockRandomGenerator> random_;
+  std::unique_ptr<PeakEwmaLoadBalancer> lb_;
+};
+
+TEST_F(PeakEwmaLoadBalancerTest, NoHosts) {
+  init();
+  EXPECT_EQ(nullptr, lb_->chooseHost(nullptr));
+  EXPECT_EQ(nullptr, lb_->peekAnotherHost(nullptr));
+}
+
+// Hosts without a response time are tried while they have no active requests.
+TEST_F(PeakEwmaLoadBalancerTest, HostsWithoutResponseTime) {
+  addHosts(2);
+  init();
+  lb_->putResponseTime(*host_set_.hosts_[0], std::chrono::milliseconds(1));
+
+  EXPECT_EQ(host_set_.hosts_[1], chooseBetweenFirstTwoHosts());
+
+  host_set_.hosts_[1]->stats().rq_active_.inc();
+  EXPECT_EQ(host_set_.hosts_[0], chooseBetweenFirstTwoHosts());
+}
+
+// The cost of a host is its average response time multiplied by its active requests plus one.
+TEST_F(PeakEwmaLoadBalancerTest, LowestCost) {
+  init();
+  addHosts(2);
+  lb_->putResponseTime(*host_set_.hosts_[0], std::chrono::milliseconds(100));
+  lb_->putResponseTime(*host_set_.hosts_[1], std::chrono::milliseconds(10));
+
+  EXPECT_EQ(host_set_.hosts_[1], chooseBetweenFirstTwoHosts());
+
+  for (uint32_t i = 0; i < 10; ++i) {
+    host_set_.hosts_[1]->stats().rq_active_.inc();
+  }
+  EXPECT_EQ(host_set_.hosts_[0], chooseBetweenFirstTwoHosts());
+}
+
+// A peak replaces the average at once, while faster responses pull it down over the decay time.
+TEST_F(PeakEwmaLoadBalancerTest, PeakSensitiveAverage) {
+  config_ = envoy::config::cluster::v3::Cluster::PeakEwmaLbConfig();
+  config_->mutable_decay_time()->set_seconds(1);
+  init();
+  addHosts(2);
+  lb_->putResponseTime(*host_set_.hosts_[0], std::chrono::milliseconds(10));
+  lb_->putResponseTime(*host_set_.hosts_[1], std::chrono::milliseconds(50));
+  EXPECT_EQ(host_set_.hosts_[0], chooseBetweenFirstTwoHosts());
+
+  lb_->putResponseTime(*host_set_.hosts_[0], std::chrono::milliseconds(100));
+  EXPECT_EQ(host_set_.hosts_[1], chooseBetweenFirstTwoHosts());
+
+  // After the decay time, the average of the first host is 100 / e + 10 * (1 - 1 / e) = 43.
+  simTime().advanceTimeWait(std::chrono::seconds(1));
+  lb_->putResponseTime(*host_set_.hosts_[0], std::chrono::milliseconds(10));
+  lb_->putResponseTime(*host_set_.hosts_[1], std::chrono::milliseconds(50));
+  EXPECT_EQ(host_set_.hosts_[0], chooseBetweenFirstTwoHosts());
+}
+
+// The average decays while no response time is recorded, so that slow hosts are retried.
+TEST_F(PeakEwmaLoadBalancerTest, AverageDecaysWithoutResponses) {
+  init();
+  addHosts(2);
+  lb_->putResponseTime(*host_set_.hosts_[0], std::chrono::milliseconds(100));
+  simTime().advanceTimeWait(std::chrono::seconds(30));
+  lb_->putResponseTime(*host_set_.hosts_[1], std::chrono::milliseconds(10));
+
+  // 100ms decayed over three times the default decay time is 5ms.
+  EXPECT_EQ(host_set_.hosts_[0], chooseBetweenFirstTwoHosts());
+}
+
+// Response times of removed hosts are ignored, and hosts that are added back start over.
+TEST_F(PeakEwmaLoadBalancerTest, RemovedHosts) {
+  init();
+  addHosts(2);
+  lb_->putResponseTime(*host_set_.hosts_[0], std::chrono::milliseconds(100));
+  lb_->putResponseTime(*host_set_.hosts_[1], std::chrono::milliseconds(10));
+
+  HostSharedPtr removed = host_set_.hosts_[0];
+  host_set_.hosts_.erase(host_set_.hosts_.begin());
+  host_set_.healthy_hosts_ = host_set_.hosts_;
+  host_set_.runCallbacks({}, {removed});
+  lb_->putResponseTime(*removed, std::chrono::milliseconds(100));
+
+  host_set_.hosts_.insert(host_set_.hosts_.begin(), removed);
+  host_set_.healthy_hosts_ = host_set_.hosts_;
+  host_set_.runCallbacks({removed}, {});
+  EXPECT_EQ(host_set_.hosts_[0], chooseBetweenFirstTwoHosts());
+}
+
+// A host that moves to another priority keeps its response time, whichever priority is updated
+// first.
+TEST_F(PeakEwmaLoadBalancerTest, HostMovesPriority) {
+  MockHostSet& host_set_p1 = *priority_set_.getMockHostSet(1);
+  init();
+  addHosts(2);
+  lb_->putResponseTime(*host_set_.hosts_[0], std::chrono::milliseconds(100));
+  lb_->putResponseTime(*host_set_.hosts_[1], std::chrono::milliseconds(10));
+
+  // Move the slow host to priority 1, adding it there before removing it from priority 0.
+  HostSharedPtr moved = host_set_.hosts_[0];
+  host_set_p1.hosts_ = {moved};
+  host_set_p1.healthy_hosts_ = host_set_p1.hosts_;
+  host_set_p1.runCallbacks({moved}, {});
+  host_set_.hosts_.erase(host_set_.hosts_.begin());
+  host_set_.healthy_hosts_ = host_set_.hosts_;
+  host_set_.runCallbacks({}, {moved});
+
+  // And back to priority 0, again adding it before removing it.
+  host_set_.hosts_.insert(host_set_.hosts_.begin(), moved);
+  host_set_.healthy_hosts_ = host_set_.hosts_;
+  host_set_.runCallbacks({moved}, {});
+  host_set_p1.hosts_.clear();
+  host_set_p1.healthy_hosts_.clear();
+  host_set_p1.runCallbacks({}, {moved});
+
+  // Had the response time been forgotten, the host would be picked as it has no active requests.
+  EXPECT_EQ(host_set_.hosts_[1], chooseBetweenFirstTwoHosts());
+}
+
+// The lowest cost out of choice_count hosts is picked.
+TEST_F(PeakEwmaLoadBalancerTest, ChoiceCount) {
+  config_ = envoy::config::cluster::v3::Cluster::PeakEwmaLbConfig();
+  config_->mutable_choice_count()->set_value(3);
+  init();
+  addHosts(3);
+  lb_->putResponseTime(*host_set_.hosts_[0], std::chrono::milliseconds(30));
+  lb_->putResponseTime(*host_set_.hosts_[1], std::chrono::milliseconds(20));
+  lb_->putResponseTime(*host_set_.hosts_[2], std::chrono::milliseconds(10));
+
+  EXPECT_CALL(random_, random())
+      .WillOnce(Return(0))
+      .WillOnce(Return(0))
+      .WillOnce(Return(1))
+      .WillOnce(Return(2));
+  EXPECT_EQ(host_set_.hosts_[2], lb_->chooseHost(nullptr));
+}
+
+} // namespace
+} // namespace Upstream
+} // namespace Envoy
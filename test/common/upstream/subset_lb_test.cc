@@ -23,6 +23,7 @@
 #include "test/mocks/upstream/host_set.h"
 #include "test/mocks/upstream/load_balancer.h"
 #include "test/mocks/upstream/priority_set.h"
+#include "test/test_common/simulated_time_system.h"
 
 #include "absl/types/optional.h"
 #include "gmock/gmock.h"
@@ -123,7 +124,8 @@ private:
 
 enum class UpdateOrder { RemovesFirst, Simultaneous };
 
-class SubsetLoadBalancerTest : public testing::TestWithParam<UpdateOrder> {
+class SubsetLoadBalancerTest : public Event::TestUsingSimulatedTime,
+                               public testing::TestWithParam<UpdateOrder> {
 public:
   SubsetLoadBalancerTest()
       : scope_(stats_store_.createScope("testprefix")),
@@ -196,7 +198,8 @@ public:
 
     lb_ = std::make_shared<SubsetLoadBalancer>(
         lb_type_, priority_set_, nullptr, stats_, *scope_, runtime_, random_, subset_info_,
-        ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_, common_config_);
+        ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_, common_config_,
+        simTime());
   }
 
   void zoneAwareInit(const std::vector<HostURLMetadataMap>& host_metadata_per_locality,
@@ -246,7 +249,7 @@ public:
     lb_ = std::make_shared<SubsetLoadBalancer>(lb_type_, priority_set_, &local_priority_set_,
                                                stats_, *scope_, runtime_, random_, subset_info_,
                                                ring_hash_lb_config_, maglev_lb_config_,
-                                               least_request_lb_config_, common_config_);
+                                               least_request_lb_config_, common_config_, simTime());
   }
 
   HostSharedPtr makeHost(const std::string& url, const HostMetadata& metadata) {
@@ -1203,6 +1206,138 @@ TEST_P(SubsetLoadBalancerTest, UpdateRemovingLastSubsetHost) {
   EXPECT_EQ(1U, stats_.lb_subsets_removed_.value());
 }
 
+// With lazy subsets, subsets are created when a request first selects them, and host updates only
+// update the subsets that were created.
+TEST_P(SubsetLoadBalancerTest, LazySubsetsCreatedOnFirstSelection) {
+  EXPECT_CALL(subset_info_, fallbackPolicy())
+      .WillRepeatedly(Return(envoy::config::cluster::v3::Cluster::LbSubsetConfig::ANY_ENDPOINT));
+  EXPECT_CALL(subset_info_, lazySubsets()).WillRepeatedly(Return(true));
+
+  std::vector<SubsetSelectorPtr> subset_selectors = {makeSelector(
+      {"version"},
+      envoy::config::cluster::v3::Cluster::LbSubsetConfig::LbSubsetSelector::NOT_DEFINED)};
+  EXPECT_CALL(subset_info_, subsetSelectors()).WillRepeatedly(ReturnRef(subset_selectors));
+
+  init({
+      {"tcp://127.0.0.1:80", {{"version", "1.0"}}},
+      {"tcp://127.0.0.1:81", {{"version", "1.1"}}},
+  });
+  EXPECT_EQ(0U, stats_.lb_subsets_active_.value());
+  EXPECT_EQ(0U, stats_.lb_subsets_created_.value());
+
+  HostSharedPtr host_v10 = host_set_.hosts_[0];
+  HostSharedPtr host_v11 = host_set_.hosts_[1];
+
+  TestLoadBalancerContext context_10({{"version", "1.0"}});
+  TestLoadBalancerContext context_11({{"version", "1.1"}});
+  EXPECT_EQ(host_v11, lb_->chooseHost(&context_11));
+  EXPECT_EQ(1U, stats_.lb_subsets_active_.value());
+  EXPECT_EQ(1U, stats_.lb_subsets_created_.value());
+  EXPECT_EQ(host_v10, lb_->chooseHost(&context_10));
+  EXPECT_EQ(host_v11, lb_->chooseHost(&context_11));
+  EXPECT_EQ(3U, stats_.lb_subsets_selected_.value());
+  EXPECT_EQ(2U, stats_.lb_subsets_active_.value());
+  EXPECT_EQ(2U, stats_.lb_subsets_created_.value());
+
+  // Subsets without hosts and criteria without a matching selector use the fallback policy and
+  // don't create subsets.
+  TestLoadBalancerContext context_12({{"version", "1.2"}});
+  TestLoadBalancerContext context_stage({{"stage", "prod"}});
+  EXPECT_NE(nullptr, lb_->chooseHost(&context_12));
+  EXPECT_NE(nullptr, lb_->chooseHost(&context_stage));
+  EXPECT_EQ(2U, stats_.lb_subsets_fallback_.value());
+  EXPECT_EQ(2U, stats_.lb_subsets_active_.value());
+  EXPECT_EQ(2U, stats_.lb_subsets_created_.value());
+
+  HostSharedPtr added_host = makeHost("tcp://127.0.0.1:8000", {{"version", "1.1"}});
+  modifyHosts({added_host}, {host_v10});
+  EXPECT_EQ(1U, stats_.lb_subsets_active_.value());
+  EXPECT_EQ(1U, stats_.lb_subsets_removed_.value());
+
+  HostConstSharedPtr first = lb_->chooseHost(&context_11);
+  HostConstSharedPtr second = lb_->chooseHost(&context_11);
+  EXPECT_NE(first, second);
+  EXPECT_TRUE(first == added_host || second == added_host);
+  EXPECT_NE(nullptr, lb_->chooseHost(&context_10));
+  EXPECT_EQ(3U, stats_.lb_subsets_fallback_.value());
+}
+
+// Lazy subsets that were not selected for the idle timeout are removed on the next host update.
+TEST_P(SubsetLoadBalancerTest, LazySubsetsEvictedWhenIdle) {
+  EXPECT_CALL(subset_info_, fallbackPolicy())
+      .WillRepeatedly(Return(envoy::config::cluster::v3::Cluster::LbSubsetConfig::NO_FALLBACK));
+  EXPECT_CALL(subset_info_, lazySubsets()).WillRepeatedly(Return(true));
+  EXPECT_CALL(subset_info_, lazySubsetIdleTimeout())
+      .WillRepeatedly(Return(std::chrono::milliseconds(10000)));
+
+  std::vector<SubsetSelectorPtr> subset_selectors = {makeSelector(
+      {"version"},
+      envoy::config::cluster::v3::Cluster::LbSubsetConfig::LbSubsetSelector::NOT_DEFINED)};
+  EXPECT_CALL(subset_info_, subsetSelectors()).WillRepeatedly(ReturnRef(subset_selectors));
+
+  init({
+      {"tcp://127.0.0.1:80", {{"version", "1.0"}}},
+      {"tcp://127.0.0.1:81", {{"version", "1.1"}}},
+  });
+
+  TestLoadBalancerContext context_10({{"version", "1.0"}});
+  TestLoadBalancerContext context_11({{"version", "1.1"}});
+  EXPECT_EQ(host_set_.hosts_[0], lb_->chooseHost(&context_10));
+  EXPECT_EQ(host_set_.hosts_[1], lb_->chooseHost(&context_11));
+  EXPECT_EQ(2U, stats_.lb_subsets_active_.value());
+
+  simTime().advanceTimeWait(std::chrono::seconds(5));
+  EXPECT_EQ(host_set_.hosts_[0], lb_->chooseHost(&context_10));
+  simTime().advanceTimeWait(std::chrono::seconds(6));
+
+  // Only the subset for version 1.1 has been idle for the timeout.
+  modifyHosts({makeHost("tcp://127.0.0.1:8000", {{"version", "1.2"}})}, {});
+  EXPECT_EQ(1U, stats_.lb_subsets_active_.value());
+  EXPECT_EQ(1U, stats_.lb_subsets_removed_.value());
+
+  // An evicted subset is created again when it is selected.
+  EXPECT_EQ(host_set_.hosts_[1], lb_->chooseHost(&context_11));
+  EXPECT_EQ(2U, stats_.lb_subsets_active_.value());
+  EXPECT_EQ(3U, stats_.lb_subsets_created_.value());
+}
+
+TEST_P(SubsetLoadBalancerTest, LazySubsetsEvictedOnSelection) {
+  EXPECT_CALL(subset_info_, fallbackPolicy())
+      .WillRepeatedly(Return(envoy::config::cluster::v3::Cluster::LbSubsetConfig::NO_FALLBACK));
+  EXPECT_CALL(subset_info_, lazySubsets()).WillRepeatedly(Return(true));
+  EXPECT_CALL(subset_info_, lazySubsetIdleTimeout())
+      .WillRepeatedly(Return(std::chrono::milliseconds(10000)));
+
+  std::vector<SubsetSelectorPtr> subset_selectors = {makeSelector(
+      {"version"},
+      envoy::config::cluster::v3::Cluster::LbSubsetConfig::LbSubsetSelector::NOT_DEFINED)};
+  EXPECT_CALL(subset_info_, subsetSelectors()).WillRepeatedly(ReturnRef(subset_selectors));
+
+  init({
+      {"tcp://127.0.0.1:80", {{"version", "1.0"}}},
+      {"tcp://127.0.0.1:81", {{"version", "1.1"}}},
+  });
+
+  TestLoadBalancerContext context_10({{"version", "1.0"}});
+  TestLoadBalancerContext context_11({{"version", "1.1"}});
+  TestLoadBalancerContext context_12({{"version", "1.2"}});
+  EXPECT_EQ(host_set_.hosts_[0], lb_->chooseHost(&context_10));
+  EXPECT_EQ(host_set_.hosts_[1], lb_->chooseHost(&context_11));
+  EXPECT_EQ(2U, stats_.lb_subsets_active_.value());
+
+  // Values that no host has don't create a subset.
+  EXPECT_EQ(nullptr, lb_->chooseHost(&context_12));
+  EXPECT_EQ(2U, stats_.lb_subsets_created_.value());
+
+  // Without a host update, selecting a subset after the idle timeout evicts the idle ones.
+  simTime().advanceTimeWait(std::chrono::seconds(11));
+  EXPECT_EQ(host_set_.hosts_[0], lb_->chooseHost(&context_10));
+  EXPECT_EQ(1U, stats_.lb_subsets_active_.value());
+  EXPECT_EQ(1U, stats_.lb_subsets_removed_.value());
+  EXPECT_EQ(2U, stats_.lb_subsets_created_.value());
+  EXPECT_EQ(host_set_.hosts_[0], lb_->chooseHost(&context_10));
+}
+
 TEST_P(SubsetLoadBalancerTest, UpdateRemovingUnknownHost) {
   EXPECT_CALL(subset_info_, fallbackPolicy())
       .WillRepeatedly(Return(envoy::config::cluster::v3::Cluster::LbSubsetConfig::NO_FALLBACK));
@@ -1432,7 +1567,7 @@ TEST_F(SubsetLoadBalancerTest, IgnoresHostsWithoutMetadata) {
 
   lb_ = std::make_shared<SubsetLoadBalancer>(
       lb_type_, priority_set_, nullptr, stats_, stats_store_, runtime_, random_, subset_info_,
-      ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_, common_config_);
+      ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_, common_config_, simTime());
 
   TestLoadBalancerContext context_version({{"version", "1.0"}});
 
@@ -1851,7 +1986,7 @@ TEST_F(SubsetLoadBalancerTest, DisabledLocalityWeightAwareness) {
 
   lb_ = std::make_shared<SubsetLoadBalancer>(
       lb_type_, priority_set_, nullptr, stats_, stats_store_, runtime_, random_, subset_info_,
-      ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_, common_config_);
+      ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_, common_config_, simTime());
 
   TestLoadBalancerContext context({{"version", "1.1"}});
 
@@ -1874,7 +2009,7 @@ TEST_F(SubsetLoadBalancerTest, DoesNotCheckHostHealth) {
 
   lb_ = std::make_shared<SubsetLoadBalancer>(
       lb_type_, priority_set_, nullptr, stats_, stats_store_, runtime_, random_, subset_info_,
-      ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_, common_config_);
+      ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_, common_config_, simTime());
 }
 
 TEST_F(SubsetLoadBalancerTest, EnabledLocalityWeightAwareness) {
@@ -1897,7 +2032,7 @@ TEST_F(SubsetLoadBalancerTest, EnabledLocalityWeightAwareness) {
 
   lb_ = std::make_shared<SubsetLoadBalancer>(
       lb_type_, priority_set_, nullptr, stats_, stats_store_, runtime_, random_, subset_info_,
-      ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_, common_config_);
+      ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_, common_config_, simTime());
 
   TestLoadBalancerContext context({{"version", "1.1"}});
 
@@ -1932,7 +2067,7 @@ TEST_F(SubsetLoadBalancerTest, EnabledScaleLocalityWeights) {
 
   lb_ = std::make_shared<SubsetLoadBalancer>(
       lb_type_, priority_set_, nullptr, stats_, stats_store_, runtime_, random_, subset_info_,
-      ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_, common_config_);
+      ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_, common_config_, simTime());
   TestLoadBalancerContext context({{"version", "1.1"}});
 
   // Since we scale the locality weights by number of hosts removed, we expect to see the second
@@ -1977,7 +2112,7 @@ TEST_F(SubsetLoadBalancerTest, EnabledScaleLocalityWeightsRounding) {
 
   lb_ = std::make_shared<SubsetLoadBalancer>(
       lb_type_, priority_set_, nullptr, stats_, stats_store_, runtime_, random_, subset_info_,
-      ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_, common_config_);
+      ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_, common_config_, simTime());
   TestLoadBalancerContext context({{"version", "1.0"}});
 
   // We expect to see a 33/66 split because 2 * 1 / 2 = 1 and 2 * 3 / 4 = 1.5 -> 2
@@ -2009,7 +2144,7 @@ TEST_F(SubsetLoadBalancerTest, ScaleLocalityWeightsWithNoLocalityWeights) {
 
   lb_ = std::make_shared<SubsetLoadBalancer>(
       lb_type_, priority_set_, nullptr, stats_, stats_store_, runtime_, random_, subset_info_,
-      ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_, common_config_);
+      ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_, common_config_, simTime());
 }
 
 TEST_P(SubsetLoadBalancerTest, GaugesUpdatedOnDestroy) {
@@ -38,6 +38,7 @@
 #include "test/mocks/upstream/health_checker.h"
 #include "test/mocks/upstream/priority_set.h"
 #include "test/test_common/registry.h"
+#include "test/test_common/test_runtime.h"
 #include "test/test_common/utility.h"
 
 #include "gmock/gmock.h"
@@ -354,7 +355,7 @@ TEST_F(StrictDnsClusterImplTest, Basic) {
   EXPECT_EQ(Http::Http1Settings::HeaderKeyFormat::ProperCase,
             cluster.info()->http1Settings().header_key_format_);
 
-  cluster.info()->stats().upstream_rq_total_.inc();
+  cluster.info()->trafficStats().upstream_rq_total_.inc();
   EXPECT_EQ(1UL, stats_.counter("cluster.name.upstream_rq_total").value());
 
   EXPECT_CALL(runtime_.snapshot_, featureEnabled("upstream.maintenance_mode.name", 0));
@@ -693,7 +694,7 @@ TEST_F(StrictDnsClusterImplTest, LoadAssignmentBasic) {
   EXPECT_EQ(3U, cluster.info()->maxRequestsPerConnection());
   EXPECT_EQ(0U, cluster.info()->http2Options().hpack_table_size().value());
 
-  cluster.info()->stats().upstream_rq_total_.inc();
+  cluster.info()->trafficStats().upstream_rq_total_.inc();
   EXPECT_EQ(1UL, stats_.counter("cluster.name.upstream_rq_total").value());
 
   EXPECT_CALL(runtime_.snapshot_, featureEnabled("upstream.maintenance_mode.name", 0));
@@ -1608,7 +1609,7 @@ TEST_F(StaticClusterImplTest, AltStatName) {
   StaticClusterImpl cluster(cluster_config, runtime_, factory_context, std::move(scope), false);
   cluster.initialize([] {});
   // Increment a stat and verify it is emitted with alt_stat_name
-  cluster.info()->stats().upstream_rq_total_.inc();
+  cluster.info()->trafficStats().upstream_rq_total_.inc();
   EXPECT_EQ(1UL, stats_.counter("cluster.staticcluster_stats.upstream_rq_total").value());
 }
 
@@ -2472,6 +2473,44 @@ TEST_F(ClusterInfoImplTest, TestTrackRequestResponseSizes) {
   EXPECT_EQ(Stats::Histogram::Unit::Bytes, req_resp_stats.upstream_rs_body_size_.unit());
 }
 
+// Traffic stats are created eagerly unless lazy creation is enabled through runtime.
+TEST_F(ClusterInfoImplTest, TrafficStatsCreatedEagerly) {
+  const std::string yaml = R"EOF(
+    name: name
+    connect_timeout: 0.25s
+    type: STRICT_DNS
+    lb_policy: ROUND_ROBIN
+  )EOF";
+
+  auto cluster = makeCluster(yaml);
+  EXPECT_TRUE(cluster->info()->trafficStatsCreated());
+  EXPECT_TRUE(stats_.findCounterByString("cluster.name.upstream_cx_total").has_value());
+}
+
+TEST_F(ClusterInfoImplTest, TrafficStatsCreatedOnFirstUse) {
+  TestScopedRuntime scoped_runtime;
+  Runtime::LoaderSingleton::getExisting()->mergeValues(
+      {{"envoy.reloadable_features.lazy_cluster_traffic_stats", "true"}});
+
+  const std::string yaml = R"EOF(
+    name: name
+    connect_timeout: 0.25s
+    type: STRICT_DNS
+    lb_policy: ROUND_ROBIN
+  )EOF";
+
+  auto cluster = makeCluster(yaml);
+  EXPECT_FALSE(cluster->info()->trafficStatsCreated());
+  EXPECT_FALSE(stats_.findCounterByString("cluster.name.upstream_cx_total").has_value());
+  // Stats that change without traffic are still created with the cluster.
+  EXPECT_TRUE(stats_.findGaugeByString("cluster.name.membership_total").has_value());
+
+  cluster->info()->trafficStats().upstream_cx_total_.inc();
+  EXPECT_TRUE(cluster->info()->trafficStatsCreated());
+  EXPECT_EQ(1UL, stats_.counter("cluster.name.upstream_cx_total").value());
+  EXPECT_EQ(&cluster->info()->trafficStats(), &cluster->info()->trafficStats());
+}
+
 TEST_F(ClusterInfoImplTest, TestTrackRemainingResourcesGauges) {
   const std::string yaml = R"EOF(
     name: name
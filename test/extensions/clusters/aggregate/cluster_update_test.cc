@@ -16,6 +16,7 @@
 #include "test/mocks/upstream/cluster_update_callbacks.h"
 #include "test/test_common/environment.h"
 #include "test/test_common/simulated_time_system.h"
+#include "test/test_common/test_runtime.h"
 
 using testing::Return;
 
@@ -299,6 +300,108 @@ TEST_F(AggregateClusterUpdateTest, InitializeAggregateClusterAfterOtherClusters)
   }
 }
 
+// Verify that the aggregate cluster works when thread local clusters are created on first use, in
+// which case looking up the underlying clusters from host set callbacks creates their entries.
+TEST_F(AggregateClusterUpdateTest, LazyThreadLocalClusters) {
+  TestScopedRuntime scoped_runtime;
+  Runtime::LoaderSingleton::getExisting()->mergeValues(
+      {{"envoy.reloadable_features.lazy_thread_local_clusters", "true"}});
+  const std::string config = R"EOF(
+ static_resources:
+  clusters:
+  - name: primary
+    connect_timeout: 5s
+    type: STATIC
+    load_assignment:
+      cluster_name: primary
+      endpoints:
+      - lb_endpoints:
+        - endpoint:
+            address:
+              socket_address:
+                address: 127.0.0.1
+                port_value: 80
+    lb_policy: ROUND_ROBIN
+  - name: secondary
+    connect_timeout: 5s
+    type: STATIC
+    load_assignment:
+      cluster_name: secondary
+      endpoints:
+      - lb_endpoints:
+        - endpoint:
+            address:
+              socket_address:
+                address: 127.0.0.2
+                port_value: 80
+    lb_policy: ROUND_ROBIN
+  - name: unused1
+    connect_timeout: 5s
+    type: STATIC
+    lb_policy: ROUND_ROBIN
+  - name: unused2
+    connect_timeout: 5s
+    type: STATIC
+    lb_policy: ROUND_ROBIN
+  - name: unused3
+    connect_timeout: 5s
+    type: STATIC
+    lb_policy: ROUND_ROBIN
+  - name: aggregate_cluster
+    connect_timeout: 0.25s
+    lb_policy: CLUSTER_PROVIDED
+    cluster_type:
+      name: envoy.clusters.aggregate
+      typed_config:
+        "@type": type.googleapis.com/envoy.config.cluster.aggregate.v2alpha.ClusterConfig
+        clusters:
+        - primary
+        - secondary
+  )EOF";
+
+  auto bootstrap = parseBootstrapFromV2Yaml(config);
+  cluster_manager_ = std::make_unique<Upstream::TestClusterManagerImpl>(
+      bootstrap, factory_, factory_.stats_, factory_.tls_, factory_.runtime_, factory_.local_info_,
+      log_manager_, factory_.dispatcher_, admin_, validation_context_, *factory_.api_,
+      http_context_, grpc_context_);
+  cluster_manager_->initializeSecondaryClusters(bootstrap);
+  EXPECT_EQ(cluster_manager_->activeClusters().size(), 6);
+  cluster_ = cluster_manager_->get("aggregate_cluster");
+  ASSERT_NE(nullptr, cluster_);
+  auto host = cluster_->loadBalancer().chooseHost(nullptr);
+  ASSERT_NE(nullptr, host);
+  EXPECT_EQ("primary", host->cluster().name());
+
+  // Membership updates of the underlying clusters refresh the aggregate load balancer, which looks
+  // the clusters up again while the thread local cluster is being updated.
+  auto primary = cluster_manager_->get("primary");
+  ASSERT_NE(nullptr, primary);
+  Upstream::Cluster& cluster = cluster_manager_->activeClusters().find("primary")->second;
+  const Upstream::HostVector primary_hosts =
+      cluster.prioritySet().hostSetsPerPriority()[0]->hosts();
+  cluster.prioritySet().updateHosts(
+      0,
+      Upstream::HostSetImpl::partitionHosts(std::make_shared<Upstream::HostVector>(),
+                                            Upstream::HostsPerLocalityImpl::empty()),
+      nullptr, {}, primary_hosts, 100);
+  host = cluster_->loadBalancer().chooseHost(nullptr);
+  ASSERT_NE(nullptr, host);
+  EXPECT_EQ("secondary", host->cluster().name());
+  EXPECT_EQ("127.0.0.2:80", host->address()->asString());
+
+  Upstream::HostSharedPtr host1 = Upstream::makeTestHost(primary->info(), "tcp://127.0.0.3:80");
+  cluster.prioritySet().updateHosts(
+      0,
+      Upstream::HostSetImpl::partitionHosts(
+          std::make_shared<Upstream::HostVector>(Upstream::HostVector{host1}),
+          Upstream::HostsPerLocalityImpl::empty()),
+      nullptr, {host1}, {}, 100);
+  EXPECT_EQ(host1, cluster_->loadBalancer().chooseHost(nullptr));
+
+  // Clusters that the aggregate cluster does not reference are created on their first use.
+  EXPECT_NE(nullptr, cluster_manager_->get("unused1"));
+}
+
 } // namespace Aggregate
 } // namespace Clusters
 } // namespace Extensions
@@ -82,7 +82,7 @@ public:
 
     client_ = ClientImpl::create(host_, dispatcher_, Common::Redis::EncoderPtr{encoder_}, *this,
                                  *config_, redis_command_stats_, stats_);
-    EXPECT_EQ(1UL, host_->cluster_.stats_.upstream_cx_total_.value());
+    EXPECT_EQ(1UL, host_->cluster_.traffic_stats_.upstream_cx_total_.value());
     EXPECT_EQ(1UL, host_->stats_.cx_total_.value());
     EXPECT_EQ(false, client_->active());
 
@@ -118,8 +118,8 @@ public:
     EXPECT_CALL(*flush_timer_, enabled()).WillOnce(Return(false));
     client_->initialize(auth_username_, auth_password_);
 
-    EXPECT_EQ(1UL, host_->cluster_.stats_.upstream_rq_total_.value());
-    EXPECT_EQ(1UL, host_->cluster_.stats_.upstream_rq_active_.value());
+    EXPECT_EQ(1UL, host_->cluster_.traffic_stats_.upstream_rq_total_.value());
+    EXPECT_EQ(1UL, host_->cluster_.traffic_stats_.upstream_rq_active_.value());
     EXPECT_EQ(1UL, host_->stats_.rq_total_.value());
     EXPECT_EQ(1UL, host_->stats_.rq_active_.value());
 
@@ -309,8 +309,8 @@ TEST_F(RedisClientImplTest, Basic) {
   PoolRequest* handle2 = client_->makeRequest(request2, callbacks2);
   EXPECT_NE(nullptr, handle2);
 
-  EXPECT_EQ(2UL, host_->cluster_.stats_.upstream_rq_total_.value());
-  EXPECT_EQ(2UL, host_->cluster_.stats_.upstream_rq_active_.value());
+  EXPECT_EQ(2UL, host_->cluster_.traffic_stats_.upstream_rq_total_.value());
+  EXPECT_EQ(2UL, host_->cluster_.traffic_stats_.upstream_rq_active_.value());
   EXPECT_EQ(2UL, host_->stats_.rq_total_.value());
   EXPECT_EQ(2UL, host_->stats_.rq_active_.value());
 
@@ -386,8 +386,8 @@ TEST_F(RedisClientImplTest, CommandStatsDisabledSingleRequest) {
   onConnected();
 
   // Regular Envoy stats function as normal
-  EXPECT_EQ(1UL, host_->cluster_.stats_.upstream_rq_total_.value());
-  EXPECT_EQ(1UL, host_->cluster_.stats_.upstream_rq_active_.value());
+  EXPECT_EQ(1UL, host_->cluster_.traffic_stats_.upstream_rq_total_.value());
+  EXPECT_EQ(1UL, host_->cluster_.traffic_stats_.upstream_rq_active_.value());
   EXPECT_EQ(1UL, host_->stats_.rq_total_.value());
   EXPECT_EQ(1UL, host_->stats_.rq_active_.value());
 
@@ -450,8 +450,8 @@ TEST_F(RedisClientImplTest, CommandStatsEnabledTwoRequests) {
   EXPECT_NE(nullptr, handle2);
 
   // Regular Envoy stats function as normal
-  EXPECT_EQ(2UL, host_->cluster_.stats_.upstream_rq_total_.value());
-  EXPECT_EQ(2UL, host_->cluster_.stats_.upstream_rq_active_.value());
+  EXPECT_EQ(2UL, host_->cluster_.traffic_stats_.upstream_rq_total_.value());
+  EXPECT_EQ(2UL, host_->cluster_.traffic_stats_.upstream_rq_active_.value());
   EXPECT_EQ(2UL, host_->stats_.rq_total_.value());
   EXPECT_EQ(2UL, host_->stats_.rq_active_.value());
 
@@ -514,8 +514,8 @@ TEST_F(RedisClientImplTest, InitializedWithAuthPassword) {
   EXPECT_CALL(*flush_timer_, enabled()).WillOnce(Return(false));
   client_->initialize(auth_username_, auth_password_);
 
-  EXPECT_EQ(1UL, host_->cluster_.stats_.upstream_rq_total_.value());
-  EXPECT_EQ(1UL, host_->cluster_.stats_.upstream_rq_active_.value());
+  EXPECT_EQ(1UL, host_->cluster_.traffic_stats_.upstream_rq_total_.value());
+  EXPECT_EQ(1UL, host_->cluster_.traffic_stats_.upstream_rq_active_.value());
   EXPECT_EQ(1UL, host_->stats_.rq_total_.value());
   EXPECT_EQ(1UL, host_->stats_.rq_active_.value());
 
@@ -536,8 +536,8 @@ TEST_F(RedisClientImplTest, InitializedWithAuthAcl) {
   EXPECT_CALL(*flush_timer_, enabled()).WillOnce(Return(false));
   client_->initialize(auth_username_, auth_password_);
 
-  EXPECT_EQ(1UL, host_->cluster_.stats_.upstream_rq_total_.value());
-  EXPECT_EQ(1UL, host_->cluster_.stats_.upstream_rq_active_.value());
+  EXPECT_EQ(1UL, host_->cluster_.traffic_stats_.upstream_rq_total_.value());
+  EXPECT_EQ(1UL, host_->cluster_.traffic_stats_.upstream_rq_active_.value());
   EXPECT_EQ(1UL, host_->stats_.rq_total_.value());
   EXPECT_EQ(1UL, host_->stats_.rq_active_.value());
 
@@ -613,7 +613,7 @@ TEST_F(RedisClientImplTest, Cancel) {
   EXPECT_CALL(*connect_or_op_timer_, disableTimer());
   client_->close();
 
-  EXPECT_EQ(1UL, host_->cluster_.stats_.upstream_rq_cancelled_.value());
+  EXPECT_EQ(1UL, host_->cluster_.traffic_stats_.upstream_rq_cancelled_.value());
 }
 
 TEST_F(RedisClientImplTest, FailAll) {
@@ -640,8 +640,8 @@ TEST_F(RedisClientImplTest, FailAll) {
   EXPECT_CALL(connection_callbacks, onEvent(Network::ConnectionEvent::RemoteClose));
   upstream_connection_->raiseEvent(Network::ConnectionEvent::RemoteClose);
 
-  EXPECT_EQ(1UL, host_->cluster_.stats_.upstream_cx_destroy_with_active_rq_.value());
-  EXPECT_EQ(1UL, host_->cluster_.stats_.upstream_cx_destroy_remote_with_active_rq_.value());
+  EXPECT_EQ(1UL, host_->cluster_.traffic_stats_.upstream_cx_destroy_with_active_rq_.value());
+  EXPECT_EQ(1UL, host_->cluster_.traffic_stats_.upstream_cx_destroy_remote_with_active_rq_.value());
 }
 
 TEST_F(RedisClientImplTest, FailAllWithCancel) {
@@ -667,9 +667,9 @@ TEST_F(RedisClientImplTest, FailAllWithCancel) {
   EXPECT_CALL(connection_callbacks, onEvent(Network::ConnectionEvent::LocalClose));
   upstream_connection_->raiseEvent(Network::ConnectionEvent::LocalClose);
 
-  EXPECT_EQ(1UL, host_->cluster_.stats_.upstream_cx_destroy_with_active_rq_.value());
-  EXPECT_EQ(1UL, host_->cluster_.stats_.upstream_cx_destroy_local_with_active_rq_.value());
-  EXPECT_EQ(1UL, host_->cluster_.stats_.upstream_rq_cancelled_.value());
+  EXPECT_EQ(1UL, host_->cluster_.traffic_stats_.upstream_cx_destroy_with_active_rq_.value());
+  EXPECT_EQ(1UL, host_->cluster_.traffic_stats_.upstream_cx_destroy_local_with_active_rq_.value());
+  EXPECT_EQ(1UL, host_->cluster_.traffic_stats_.upstream_rq_cancelled_.value());
 }
 
 TEST_F(RedisClientImplTest, ProtocolError) {
@@ -697,7 +697,7 @@ TEST_F(RedisClientImplTest, ProtocolError) {
   EXPECT_CALL(*connect_or_op_timer_, disableTimer());
   upstream_read_filter_->onData(fake_data, false);
 
-  EXPECT_EQ(1UL, host_->cluster_.stats_.upstream_cx_protocol_error_.value());
+  EXPECT_EQ(1UL, host_->cluster_.traffic_stats_.upstream_cx_protocol_error_.value());
   EXPECT_EQ(1UL, host_->stats_.rq_error_.value());
 }
 
@@ -719,7 +719,7 @@ TEST_F(RedisClientImplTest, ConnectFail) {
   EXPECT_CALL(*connect_or_op_timer_, disableTimer());
   upstream_connection_->raiseEvent(Network::ConnectionEvent::RemoteClose);
 
-  EXPECT_EQ(1UL, host_->cluster_.stats_.upstream_cx_connect_fail_.value());
+  EXPECT_EQ(1UL, host_->cluster_.traffic_stats_.upstream_cx_connect_fail_.value());
   EXPECT_EQ(1UL, host_->stats_.cx_connect_fail_.value());
 }
 
@@ -754,7 +754,7 @@ TEST_F(RedisClientImplTest, OutlierDisabled) {
   EXPECT_CALL(*connect_or_op_timer_, disableTimer());
   upstream_connection_->raiseEvent(Network::ConnectionEvent::RemoteClose);
 
-  EXPECT_EQ(1UL, host_->cluster_.stats_.upstream_cx_connect_fail_.value());
+  EXPECT_EQ(1UL, host_->cluster_.traffic_stats_.upstream_cx_connect_fail_.value());
   EXPECT_EQ(1UL, host_->stats_.cx_connect_fail_.value());
 }
 
@@ -777,7 +777,7 @@ TEST_F(RedisClientImplTest, ConnectTimeout) {
   EXPECT_CALL(*connect_or_op_timer_, disableTimer());
   connect_or_op_timer_->invokeCallback();
 
-  EXPECT_EQ(1UL, host_->cluster_.stats_.upstream_cx_connect_timeout_.value());
+  EXPECT_EQ(1UL, host_->cluster_.traffic_stats_.upstream_cx_connect_timeout_.value());
   EXPECT_EQ(1UL, host_->stats_.cx_connect_fail_.value());
 }
 
@@ -795,8 +795,8 @@ TEST_F(RedisClientImplTest, OpTimeout) {
 
   onConnected();
 
-  EXPECT_EQ(1UL, host_->cluster_.stats_.upstream_rq_total_.value());
-  EXPECT_EQ(1UL, host_->cluster_.stats_.upstream_rq_active_.value());
+  EXPECT_EQ(1UL, host_->cluster_.traffic_stats_.upstream_rq_total_.value());
+  EXPECT_EQ(1UL, host_->cluster_.traffic_stats_.upstream_rq_active_.value());
 
   EXPECT_CALL(callbacks1, onResponse_(_));
   EXPECT_CALL(*connect_or_op_timer_, disableTimer());
@@ -804,8 +804,8 @@ TEST_F(RedisClientImplTest, OpTimeout) {
               putResult(Upstream::Outlier::Result::ExtOriginRequestSuccess, _));
   respond();
 
-  EXPECT_EQ(1UL, host_->cluster_.stats_.upstream_rq_total_.value());
-  EXPECT_EQ(0UL, host_->cluster_.stats_.upstream_rq_active_.value());
+  EXPECT_EQ(1UL, host_->cluster_.traffic_stats_.upstream_rq_total_.value());
+  EXPECT_EQ(0UL, host_->cluster_.traffic_stats_.upstream_rq_active_.value());
 
   EXPECT_CALL(*encoder_, encode(Ref(request1), _));
   EXPECT_CALL(*flush_timer_, enabled()).WillOnce(Return(false));
@@ -820,10 +820,10 @@ TEST_F(RedisClientImplTest, OpTimeout) {
   EXPECT_CALL(*connect_or_op_timer_, disableTimer());
   connect_or_op_timer_->invokeCallback();
 
-  EXPECT_EQ(1UL, host_->cluster_.stats_.upstream_rq_timeout_.value());
+  EXPECT_EQ(1UL, host_->cluster_.traffic_stats_.upstream_rq_timeout_.value());
   EXPECT_EQ(1UL, host_->stats_.rq_timeout_.value());
-  EXPECT_EQ(2UL, host_->cluster_.stats_.upstream_rq_total_.value());
-  EXPECT_EQ(0UL, host_->cluster_.stats_.upstream_rq_active_.value());
+  EXPECT_EQ(2UL, host_->cluster_.traffic_stats_.upstream_rq_total_.value());
+  EXPECT_EQ(0UL, host_->cluster_.traffic_stats_.upstream_rq_active_.value());
 }
 
 TEST_F(RedisClientImplTest, AskRedirection) {
@@ -847,8 +847,8 @@ TEST_F(RedisClientImplTest, AskRedirection) {
   PoolRequest* handle2 = client_->makeRequest(request2, callbacks2);
   EXPECT_NE(nullptr, handle2);
 
-  EXPECT_EQ(2UL, host_->cluster_.stats_.upstream_rq_total_.value());
-  EXPECT_EQ(2UL, host_->cluster_.stats_.upstream_rq_active_.value());
+  EXPECT_EQ(2UL, host_->cluster_.traffic_stats_.upstream_rq_total_.value());
+  EXPECT_EQ(2UL, host_->cluster_.traffic_stats_.upstream_rq_active_.value());
   EXPECT_EQ(2UL, host_->stats_.rq_total_.value());
   EXPECT_EQ(2UL, host_->stats_.rq_active_.value());
 
@@ -867,7 +867,9 @@ TEST_F(RedisClientImplTest, AskRedirection) {
                 putResult(Upstream::Outlier::Result::ExtOriginRequestSuccess, _));
     callbacks_->onRespValue(std::move(response1));
 
-    EXPECT_EQ(1UL, host_->cluster_.stats_.upstream_internal_redirect_failed_total_.value());
+    EXPECT_EQ(1UL,
+
+              host_->cluster_.traffic_stats_.upstream_internal_redirect_failed_total_.value());
 
     Common::Redis::RespValuePtr response2(new Common::Redis::RespValue());
     response2->type(Common::Redis::RespType::Error);
@@ -880,7 +882,9 @@ TEST_F(RedisClientImplTest, AskRedirection) {
                 putResult(Upstream::Outlier::Result::ExtOriginRequestSuccess, _));
     callbacks_->onRespValue(std::move(response2));
 
-    EXPECT_EQ(1UL, host_->cluster_.stats_.upstream_internal_redirect_succeeded_total_.value());
+    EXPECT_EQ(1UL,
+
+              host_->cluster_.traffic_stats_.upstream_internal_redirect_succeeded_total_.value());
   }));
   upstream_read_filter_->onData(fake_data, false);
 
@@ -910,8 +914,8 @@ TEST_F(RedisClientImplTest, MovedRedirection) {
   PoolRequest* handle2 = client_->makeRequest(request2, callbacks2);
   EXPECT_NE(nullptr, handle2);
 
-  EXPECT_EQ(2UL, host_->cluster_.stats_.upstream_rq_total_.value());
-  EXPECT_EQ(2UL, host_->cluster_.stats_.upstream_rq_active_.value());
+  EXPECT_EQ(2UL, host_->cluster_.traffic_stats_.upstream_rq_total_.value());
+  EXPECT_EQ(2UL, host_->cluster_.traffic_stats_.upstream_rq_active_.value());
   EXPECT_EQ(2UL, host_->stats_.rq_total_.value());
   EXPECT_EQ(2UL, host_->stats_.rq_active_.value());
 
@@ -930,7 +934,9 @@ TEST_F(RedisClientImplTest, MovedRedirection) {
                 putResult(Upstream::Outlier::Result::ExtOriginRequestSuccess, _));
     callbacks_->onRespValue(std::move(response1));
 
-    EXPECT_EQ(1UL, host_->cluster_.stats_.upstream_internal_redirect_failed_total_.value());
+    EXPECT_EQ(1UL,
+
+              host_->cluster_.traffic_stats_.upstream_internal_redirect_failed_total_.value());
 
     Common::Redis::RespValuePtr response2(new Common::Redis::RespValue());
     response2->type(Common::Redis::RespType::Error);
@@ -943,7 +949,9 @@ TEST_F(RedisClientImplTest, MovedRedirection) {
                 putResult(Upstream::Outlier::Result::ExtOriginRequestSuccess, _));
     callbacks_->onRespValue(std::move(response2));
 
-    EXPECT_EQ(1UL, host_->cluster_.stats_.upstream_internal_redirect_succeeded_total_.value());
+    EXPECT_EQ(1UL,
+
+              host_->cluster_.traffic_stats_.upstream_internal_redirect_succeeded_total_.value());
   }));
   upstream_read_filter_->onData(fake_data, false);
 
@@ -973,8 +981,8 @@ TEST_F(RedisClientImplTest, RedirectionFailure) {
   PoolRequest* handle2 = client_->makeRequest(request2, callbacks2);
   EXPECT_NE(nullptr, handle2);
 
-  EXPECT_EQ(2UL, host_->cluster_.stats_.upstream_rq_total_.value());
-  EXPECT_EQ(2UL, host_->cluster_.stats_.upstream_rq_active_.value());
+  EXPECT_EQ(2UL, host_->cluster_.traffic_stats_.upstream_rq_total_.value());
+  EXPECT_EQ(2UL, host_->cluster_.traffic_stats_.upstream_rq_active_.value());
   EXPECT_EQ(2UL, host_->stats_.rq_total_.value());
   EXPECT_EQ(2UL, host_->stats_.rq_active_.value());
 
@@ -994,8 +1002,10 @@ TEST_F(RedisClientImplTest, RedirectionFailure) {
                 putResult(Upstream::Outlier::Result::ExtOriginRequestSuccess, _));
     callbacks_->onRespValue(std::move(response1));
 
-    EXPECT_EQ(0UL, host_->cluster_.stats_.upstream_internal_redirect_succeeded_total_.value());
-    EXPECT_EQ(0UL, host_->cluster_.stats_.upstream_internal_redirect_failed_total_.value());
+    EXPECT_EQ(0UL,
+
+              host_->cluster_.traffic_stats_.upstream_internal_redirect_succeeded_total_.value());
+    EXPECT_EQ(0UL, host_->cluster_.traffic_stats_.upstream_internal_redirect_failed_total_.value());
 
     // Test a truncated MOVED error response that cannot be parsed properly.
     Common::Redis::RespValuePtr response2(new Common::Redis::RespValue());
@@ -1007,8 +1017,10 @@ TEST_F(RedisClientImplTest, RedirectionFailure) {
                 putResult(Upstream::Outlier::Result::ExtOriginRequestSuccess, _));
     callbacks_->onRespValue(std::move(response2));
 
-    EXPECT_EQ(0UL, host_->cluster_.stats_.upstream_internal_redirect_succeeded_total_.value());
-    EXPECT_EQ(0UL, host_->cluster_.stats_.upstream_internal_redirect_failed_total_.value());
+    EXPECT_EQ(0UL,
+
+              host_->cluster_.traffic_stats_.upstream_internal_redirect_succeeded_total_.value());
+    EXPECT_EQ(0UL, host_->cluster_.traffic_stats_.upstream_internal_redirect_failed_total_.value());
   }));
   upstream_read_filter_->onData(fake_data, false);
 
@@ -1038,8 +1050,8 @@ TEST_F(RedisClientImplTest, AskRedirectionNotEnabled) {
   PoolRequest* handle2 = client_->makeRequest(request2, callbacks2);
   EXPECT_NE(nullptr, handle2);
 
-  EXPECT_EQ(2UL, host_->cluster_.stats_.upstream_rq_total_.value());
-  EXPECT_EQ(2UL, host_->cluster_.stats_.upstream_rq_active_.value());
+  EXPECT_EQ(2UL, host_->cluster_.traffic_stats_.upstream_rq_total_.value());
+  EXPECT_EQ(2UL, host_->cluster_.traffic_stats_.upstream_rq_active_.value());
   EXPECT_EQ(2UL, host_->stats_.rq_total_.value());
   EXPECT_EQ(2UL, host_->stats_.rq_active_.value());
 
@@ -1057,8 +1069,11 @@ TEST_F(RedisClientImplTest, AskRedirectionNotEnabled) {
                 putResult(Upstream::Outlier::Result::ExtOriginRequestSuccess, _));
     callbacks_->onRespValue(std::move(response1));
 
-    EXPECT_EQ(0UL, host_->cluster_.stats_.upstream_internal_redirect_failed_total_.value());
-    EXPECT_EQ(0UL, host_->cluster_.stats_.upstream_internal_redirect_succeeded_total_.value());
+    EXPECT_EQ(0UL,
+
+              host_->cluster_.traffic_stats_.upstream_internal_redirect_failed_total_.value());
+    EXPECT_EQ(0UL,
+              host_->cluster_.traffic_stats_.upstream_internal_redirect_succeeded_total_.value());
 
     Common::Redis::RespValuePtr response2(new Common::Redis::RespValue());
     response2->type(Common::Redis::RespType::Error);
@@ -1070,8 +1085,11 @@ TEST_F(RedisClientImplTest, AskRedirectionNotEnabled) {
                 putResult(Upstream::Outlier::Result::ExtOriginRequestSuccess, _));
     callbacks_->onRespValue(std::move(response2));
 
-    EXPECT_EQ(0UL, host_->cluster_.stats_.upstream_internal_redirect_failed_total_.value());
-    EXPECT_EQ(0UL, host_->cluster_.stats_.upstream_internal_redirect_succeeded_total_.value());
+    EXPECT_EQ(0UL,
+
+              host_->cluster_.traffic_stats_.upstream_internal_redirect_failed_total_.value());
+    EXPECT_EQ(0UL,
+              host_->cluster_.traffic_stats_.upstream_internal_redirect_succeeded_total_.value());
   }));
   upstream_read_filter_->onData(fake_data, false);
 
@@ -1101,8 +1119,8 @@ TEST_F(RedisClientImplTest, MovedRedirectionNotEnabled) {
   PoolRequest* handle2 = client_->makeRequest(request2, callbacks2);
   EXPECT_NE(nullptr, handle2);
 
-  EXPECT_EQ(2UL, host_->cluster_.stats_.upstream_rq_total_.value());
-  EXPECT_EQ(2UL, host_->cluster_.stats_.upstream_rq_active_.value());
+  EXPECT_EQ(2UL, host_->cluster_.traffic_stats_.upstream_rq_total_.value());
+  EXPECT_EQ(2UL, host_->cluster_.traffic_stats_.upstream_rq_active_.value());
   EXPECT_EQ(2UL, host_->stats_.rq_total_.value());
   EXPECT_EQ(2UL, host_->stats_.rq_active_.value());
 
@@ -1119,8 +1137,10 @@ TEST_F(RedisClientImplTest, MovedRedirectionNotEnabled) {
                 putResult(Upstream::Outlier::Result::ExtOriginRequestSuccess, _));
     callbacks_->onRespValue(std::move(response1));
 
-    EXPECT_EQ(0UL, host_->cluster_.stats_.upstream_internal_redirect_succeeded_total_.value());
-    EXPECT_EQ(0UL, host_->cluster_.stats_.upstream_internal_redirect_failed_total_.value());
+    EXPECT_EQ(0UL,
+
+              host_->cluster_.traffic_stats_.upstream_internal_redirect_succeeded_total_.value());
+    EXPECT_EQ(0UL, host_->cluster_.traffic_stats_.upstream_internal_redirect_failed_total_.value());
 
     Common::Redis::RespValuePtr response2(new Common::Redis::RespValue());
     response2->type(Common::Redis::RespType::Error);
@@ -1132,8 +1152,10 @@ TEST_F(RedisClientImplTest, MovedRedirectionNotEnabled) {
                 putResult(Upstream::Outlier::Result::ExtOriginRequestSuccess, _));
     callbacks_->onRespValue(std::move(response2));
 
-    EXPECT_EQ(0UL, host_->cluster_.stats_.upstream_internal_redirect_succeeded_total_.value());
-    EXPECT_EQ(0UL, host_->cluster_.stats_.upstream_internal_redirect_failed_total_.value());
+    EXPECT_EQ(0UL,
+
+              host_->cluster_.traffic_stats_.upstream_internal_redirect_succeeded_total_.value());
+    EXPECT_EQ(0UL, host_->cluster_.traffic_stats_.upstream_internal_redirect_failed_total_.value());
   }));
   upstream_read_filter_->onData(fake_data, false);
 
@@ -210,20 +210,20 @@ TEST_F(TcpStatsdSinkTest, Overflow) {
   snapshot_.counters_.push_back({1, counter});
 
   // Synthetically set buffer above high watermark. Make sure we don't write anything.
-  cluster_manager_.thread_local_cluster_.cluster_.info_->stats().upstream_cx_tx_bytes_buffered_.set(
-      1024 * 1024 * 17);
+  cluster_manager_.thread_local_cluster_.cluster_.info_->trafficStats()
+      .upstream_cx_tx_bytes_buffered_.set(1024 * 1024 * 17);
   sink_->flush(snapshot_);
 
   // Lower and make sure we write.
-  cluster_manager_.thread_local_cluster_.cluster_.info_->stats().upstream_cx_tx_bytes_buffered_.set(
-      1024 * 1024 * 15);
+  cluster_manager_.thread_local_cluster_.cluster_.info_->trafficStats()
+      .upstream_cx_tx_bytes_buffered_.set(1024 * 1024 * 15);
   expectCreateConnection();
   EXPECT_CALL(*connection_, write(BufferStringEqual("envoy.test_counter:1|c\n"), _));
   sink_->flush(snapshot_);
 
   // Raise and make sure we don't write and kill connection.
-  cluster_manager_.thread_local_cluster_.cluster_.info_->stats().upstream_cx_tx_bytes_buffered_.set(
-      1024 * 1024 * 17);
+  cluster_manager_.thread_local_cluster_.cluster_.info_->trafficStats()
+      .upstream_cx_tx_bytes_buffered_.set(1024 * 1024 * 17);
   EXPECT_CALL(*connection_, close(Network::ConnectionCloseType::NoFlush));
   sink_->flush(snapshot_);
 
@@ -83,9 +83,9 @@ public:
     ON_CALL(error_4xx_counter_, value()).WillByDefault(Return((i + 1) * error_4xx_step));
     ON_CALL(retry_4xx_counter_, value()).WillByDefault(Return((i + 1) * error_4xx_retry_step));
     ON_CALL(success_counter_, value()).WillByDefault(Return((i + 1) * success_step));
-    cluster_info_->stats().upstream_rq_timeout_.add(timeout_step);
-    cluster_info_->stats().upstream_rq_per_try_timeout_.add(timeout_retry_step);
-    cluster_info_->stats().upstream_rq_pending_overflow_.add(rejected_step);
+    cluster_info_->trafficStats().upstream_rq_timeout_.add(timeout_step);
+    cluster_info_->trafficStats().upstream_rq_per_try_timeout_.add(timeout_retry_step);
+    cluster_info_->trafficStats().upstream_rq_pending_overflow_.add(rejected_step);
   }
 
   NiceMock<Upstream::MockClusterMockPrioritySet> cluster_;
@@ -264,6 +264,19 @@ TEST_F(HystrixSinkTest, EmptyFlush) {
   validateResults(cluster_message_map[cluster1_name_], 0, 0, 0, 0, 0, window_size_);
 }
 
+// Clusters that have not created their traffic stats yet report zeros without creating them.
+TEST_F(HystrixSinkTest, TrafficStatsNotCreated) {
+  createClusterAndCallbacks();
+  ON_CALL(*cluster1_.cluster_info_, trafficStatsCreated()).WillByDefault(Return(false));
+  EXPECT_CALL(*cluster1_.cluster_info_, trafficStats()).Times(0);
+  // Register callback to sink.
+  sink_->registerConnection(&callbacks_);
+  sink_->flush(snapshot_);
+  absl::node_hash_map<std::string, std::string> cluster_message_map =
+      buildClusterMap(cluster_stats_buffer_.toString());
+  validateResults(cluster_message_map[cluster1_name_], 0, 0, 0, 0, 0, window_size_);
+}
+
 TEST_F(HystrixSinkTest, BasicFlow) {
   InSequence s;
   createClusterAndCallbacks();
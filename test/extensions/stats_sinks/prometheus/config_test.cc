@@ -0,0 +1,49 @@
+#include "envoy/config/metrics/v3/stats.pb.h"
+#include "envoy/registry/registry.h"
+
+#include "common/protobuf/utility.h"
+
+#include "extensions/stat_sinks/prometheus/config.h"
+#include "extensions/stat_sinks/prometheus/prometheus.h"
+#include "extensions/stat_sinks/well_known_names.h"
+
+#include "test/mocks/server/instance.h"
+#include "test/test_common/utility.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using testing::_;
+using testing::NiceMock;
+
+namespace Envoy {
+namespace Extensions {
+namespace StatSinks {
+namespace Prometheus {
+namespace {
+
+TEST(StatsConfigTest, ValidPrometheusSink) {
+  const std::string name = StatsSinkNames::get().Prometheus;
+
+  envoy::config::metrics::v3::PrometheusSink sink_config;
+  sink_config.set_used_only(true);
+
+  Server::Configuration::StatsSinkFactory* factory =
+      Registry::FactoryRegistry<Server::Configuration::StatsSinkFactory>::getFactory(name);
+  ASSERT_NE(factory, nullptr);
+
+  ProtobufTypes::MessagePtr message = factory->createEmptyConfigProto();
+  TestUtility::jsonConvert(sink_config, *message);
+
+  NiceMock<Server::Configuration::MockServerFactoryContext> server;
+  EXPECT_CALL(server.admin_, addHandler("/stats/prometheus/cached", _, _, false, false));
+  Stats::SinkPtr sink = factory->createStatsSink(*message, server);
+  EXPECT_NE(sink, nullptr);
+  EXPECT_NE(dynamic_cast<PrometheusSink*>(sink.get()), nullptr);
+}
+
+} // namespace
+} // namespace Prometheus
+} // namespace StatSinks
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,103 @@
+#include "common/buffer/buffer_impl.h"
+#include "common/stats/isolated_store_impl.h"
+
+#include "extensions/compression/gzip/decompressor/zlib_decompressor_impl.h"
+#include "extensions/stat_sinks/prometheus/prometheus.h"
+
+#include "test/mocks/server/admin.h"
+#include "test/mocks/server/admin_stream.h"
+#include "test/mocks/stats/mocks.h"
+#include "test/test_common/utility.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using testing::HasSubstr;
+using testing::NiceMock;
+using testing::ReturnRef;
+
+namespace Envoy {
+namespace Extensions {
+namespace StatSinks {
+namespace Prometheus {
+namespace {
+
+class PrometheusSinkTest : public testing::Test {
+protected:
+  PrometheusSinkTest() : sink_(admin_, false) {
+    ON_CALL(admin_stream_, getRequestHeaders()).WillByDefault(ReturnRef(request_headers_));
+  }
+
+  Http::Code request(Buffer::Instance& response) {
+    return sink_.handlerCachedPrometheusStats("/stats/prometheus/cached", response_headers_,
+                                              response, admin_stream_);
+  }
+
+  void flushCounter(uint64_t value) {
+    Stats::Counter& counter = store_.counter("cluster.upstream_rq");
+    counter.add(value);
+    NiceMock<Stats::MockMetricSnapshot> snapshot;
+    snapshot.counters_.push_back({counter.latch(), counter});
+    sink_.flush(snapshot);
+  }
+
+  Stats::IsolatedStoreImpl store_;
+  NiceMock<Server::MockAdmin> admin_;
+  NiceMock<Server::MockAdminStream> admin_stream_;
+  Http::TestRequestHeaderMapImpl request_headers_;
+  Http::TestResponseHeaderMapImpl response_headers_;
+  PrometheusSink sink_;
+};
+
+TEST_F(PrometheusSinkTest, NotFlushedYet) {
+  Buffer::OwnedImpl response;
+  EXPECT_EQ(Http::Code::ServiceUnavailable, request(response));
+}
+
+TEST_F(PrometheusSinkTest, ServesLastFlush) {
+  flushCounter(5);
+  Buffer::OwnedImpl response;
+  EXPECT_EQ(Http::Code::OK, request(response));
+  EXPECT_EQ("# TYPE envoy_cluster_upstream_rq counter\nenvoy_cluster_upstream_rq{} 5\n",
+            response.toString());
+  EXPECT_FALSE(response_headers_.has(Http::CustomHeaders::get().ContentEncoding));
+
+  // The response holds on to the rendering it was given across later flushes.
+  flushCounter(2);
+  EXPECT_THAT(response.toString(), HasSubstr("envoy_cluster_upstream_rq{} 5\n"));
+  Buffer::OwnedImpl next_response;
+  EXPECT_EQ(Http::Code::OK, request(next_response));
+  EXPECT_THAT(next_response.toString(), HasSubstr("envoy_cluster_upstream_rq{} 7\n"));
+}
+
+TEST_F(PrometheusSinkTest, ServesGzipWhenAccepted) {
+  flushCounter(5);
+  request_headers_.addCopy(Http::CustomHeaders::get().AcceptEncoding, "deflate, gzip;q=0.5");
+  Buffer::OwnedImpl response;
+  EXPECT_EQ(Http::Code::OK, request(response));
+  EXPECT_EQ("gzip", response_headers_.get_(Http::CustomHeaders::get().ContentEncoding));
+
+  Compression::Gzip::Decompressor::ZlibDecompressorImpl decompressor(store_, "test.");
+  decompressor.init(15 | 16);
+  Buffer::OwnedImpl decompressed;
+  decompressor.decompress(response, decompressed);
+  EXPECT_EQ("# TYPE envoy_cluster_upstream_rq counter\nenvoy_cluster_upstream_rq{} 5\n",
+            decompressed.toString());
+}
+
+TEST(PrometheusSinkAcceptsGzipTest, AcceptEncoding) {
+  EXPECT_TRUE(PrometheusSink::acceptsGzip("gzip"));
+  EXPECT_TRUE(PrometheusSink::acceptsGzip("deflate, GZIP"));
+  EXPECT_TRUE(PrometheusSink::acceptsGzip("gzip;q=0.1"));
+  EXPECT_TRUE(PrometheusSink::acceptsGzip("*"));
+  EXPECT_FALSE(PrometheusSink::acceptsGzip(""));
+  EXPECT_FALSE(PrometheusSink::acceptsGzip("deflate, br"));
+  EXPECT_FALSE(PrometheusSink::acceptsGzip("gzip;q=0"));
+  EXPECT_FALSE(PrometheusSink::acceptsGzip("gzip; q=0.000"));
+}
+
+} // namespace
+} // namespace Prometheus
+} // namespace StatSinks
+} // namespace Extensions
+} // namespace Envoy
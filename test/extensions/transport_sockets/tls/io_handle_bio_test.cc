@@ -1,3 +1,6 @@
+#include <string>
+
+#include "common/buffer/buffer_impl.h"
 #include "common/network/io_socket_error_impl.h"
 
 #include "extensions/transport_sockets/tls/io_handle_bio.h"
@@ -8,6 +11,8 @@
 #include "gtest/gtest.h"
 #include "openssl/ssl.h"
 
+using testing::_;
+using testing::Invoke;
 using testing::NiceMock;
 using testing::Return;
 
@@ -50,6 +55,65 @@ TEST_F(IoHandleBioTest, TestMiscApis) {
   bio_->init = 1;
 }
 
+class IoHandleBioReadAheadTest : public testing::Test {
+public:
+  IoHandleBioReadAheadTest() { bio_ = BIO_new_io_handle(&io_handle_, 1024); }
+  ~IoHandleBioReadAheadTest() override { BIO_free(bio_); }
+
+  BIO* bio_;
+  NiceMock<Network::MockIoHandle> io_handle_;
+};
+
+// Small reads are served from a single read ahead of the IoHandle.
+TEST_F(IoHandleBioReadAheadTest, ServesReadsFromReadAhead) {
+  EXPECT_CALL(io_handle_, read(_, 1024))
+      .WillOnce(Invoke([](Buffer::Instance& buffer, uint64_t) -> Api::IoCallUint64Result {
+        buffer.add("helloworld");
+        return {10, Api::IoErrorPtr(nullptr, Network::IoSocketError::deleteIoError)};
+      }));
+
+  char out[16];
+  EXPECT_EQ(5, BIO_read(bio_, out, 5));
+  EXPECT_EQ("hello", std::string(out, 5));
+  EXPECT_EQ(5, BIO_pending(bio_));
+  EXPECT_EQ(5, BIO_read(bio_, out, 16));
+  EXPECT_EQ("world", std::string(out, 5));
+  EXPECT_EQ(0, BIO_pending(bio_));
+
+  EXPECT_CALL(io_handle_, read(_, 1024))
+      .WillOnce(Invoke([](Buffer::Instance&, uint64_t) -> Api::IoCallUint64Result {
+        return {0, Api::IoErrorPtr(Network::IoSocketError::getIoSocketEagainInstance(),
+                                   Network::IoSocketError::deleteIoError)};
+      }));
+  EXPECT_EQ(-1, BIO_read(bio_, out, 5));
+  EXPECT_TRUE(BIO_should_retry(bio_));
+  EXPECT_TRUE(BIO_should_read(bio_));
+}
+
+// Reads larger than the read ahead size are passed through to the IoHandle in full.
+TEST_F(IoHandleBioReadAheadTest, LargeReadUsesRequestedSize) {
+  EXPECT_CALL(io_handle_, read(_, 2048))
+      .WillOnce(Invoke([](Buffer::Instance& buffer, uint64_t) -> Api::IoCallUint64Result {
+        buffer.add(std::string(2048, 'a'));
+        return {2048, Api::IoErrorPtr(nullptr, Network::IoSocketError::deleteIoError)};
+      }));
+
+  char out[2048];
+  EXPECT_EQ(2048, BIO_read(bio_, out, 2048));
+  EXPECT_EQ(0, BIO_pending(bio_));
+}
+
+// A zero length read from the IoHandle is reported as end of stream.
+TEST_F(IoHandleBioReadAheadTest, EndOfStream) {
+  EXPECT_CALL(io_handle_, read(_, 1024))
+      .WillOnce(Return(testing::ByMove(Api::IoCallUint64Result{
+          0, Api::IoErrorPtr(nullptr, Network::IoSocketError::deleteIoError)})));
+
+  char out[5];
+  EXPECT_EQ(0, BIO_read(bio_, out, 5));
+  EXPECT_FALSE(BIO_should_retry(bio_));
+}
+
 } // namespace Tls
 } // namespace TransportSockets
 } // namespace Extensions
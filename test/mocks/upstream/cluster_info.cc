@@ -26,6 +26,8 @@ MockLoadBalancerSubsetInfo::MockLoadBalancerSubsetInfo() {
       .WillByDefault(Return(envoy::config::cluster::v3::Cluster::LbSubsetConfig::ANY_ENDPOINT));
   ON_CALL(*this, defaultSubset()).WillByDefault(ReturnRef(ProtobufWkt::Struct::default_instance()));
   ON_CALL(*this, subsetSelectors()).WillByDefault(ReturnRef(subset_selectors_));
+  ON_CALL(*this, lazySubsetIdleTimeout())
+      .WillByDefault(Return(LoadBalancerSubsetInfoImpl::DefaultLazySubsetIdleTimeout));
 }
 
 MockLoadBalancerSubsetInfo::~MockLoadBalancerSubsetInfo() = default;
@@ -40,6 +42,7 @@ MockClusterInfo::MockClusterInfo()
     : http2_options_(::Envoy::Http2::Utility::initializeAndValidateOptions(
           envoy::config::core::v3::Http2ProtocolOptions())),
       stats_(ClusterInfoImpl::generateStats(stats_store_)),
+      traffic_stats_(ClusterInfoImpl::generateTrafficStats(stats_store_)),
       transport_socket_matcher_(new NiceMock<Upstream::MockTransportSocketMatcher>()),
       load_report_stats_(ClusterInfoImpl::generateLoadReportStats(load_report_stats_store_)),
       request_response_size_stats_(std::make_unique<ClusterRequestResponseSizeStats>(
@@ -66,6 +69,8 @@ MockClusterInfo::MockClusterInfo()
   ON_CALL(*this, maxRequestsPerConnection())
       .WillByDefault(ReturnPointee(&max_requests_per_connection_));
   ON_CALL(*this, stats()).WillByDefault(ReturnRef(stats_));
+  ON_CALL(*this, trafficStats()).WillByDefault(ReturnRef(traffic_stats_));
+  ON_CALL(*this, trafficStatsCreated()).WillByDefault(Return(true));
   ON_CALL(*this, statsScope()).WillByDefault(ReturnRef(stats_store_));
   // TODO(incfly): The following is a hack because it's not possible to directly embed
   // a mock transport socket factory matcher due to circular dependencies. Fix this up in a follow
@@ -89,6 +94,7 @@ MockClusterInfo::MockClusterInfo()
   ON_CALL(*this, lbSubsetInfo()).WillByDefault(ReturnRef(lb_subset_));
   ON_CALL(*this, lbRingHashConfig()).WillByDefault(ReturnRef(lb_ring_hash_config_));
   ON_CALL(*this, lbMaglevConfig()).WillByDefault(ReturnRef(lb_maglev_config_));
+  ON_CALL(*this, lbPeakEwmaConfig()).WillByDefault(ReturnRef(lb_peak_ewma_config_));
   ON_CALL(*this, lbOriginalDstConfig()).WillByDefault(ReturnRef(lb_original_dst_config_));
   ON_CALL(*this, upstreamConfig()).WillByDefault(ReturnRef(upstream_config_));
   ON_CALL(*this, lbConfig()).WillByDefault(ReturnRef(lb_config_));
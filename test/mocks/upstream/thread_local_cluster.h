@@ -19,6 +19,8 @@ public:
   MOCK_METHOD(const PrioritySet&, prioritySet, ());
   MOCK_METHOD(ClusterInfoConstSharedPtr, info, ());
   MOCK_METHOD(LoadBalancer&, loadBalancer, ());
+  MOCK_METHOD(void, putResponseTime,
+              (const HostDescription& host, std::chrono::microseconds response_time));
 
   NiceMock<MockClusterMockPrioritySet> cluster_;
   NiceMock<MockLoadBalancer> lb_;
@@ -2,6 +2,7 @@
 
 #include "test/server/admin/admin_instance.h"
 
+using testing::HasSubstr;
 using testing::Return;
 using testing::ReturnPointee;
 using testing::ReturnRef;
@@ -235,5 +236,43 @@ fake_cluster::1.2.3.4:80::local_origin_success_rate::93.2
   EXPECT_EQ(expected_text, response2.toString());
 }
 
+TEST_P(AdminInstanceTest, ClustersMemory) {
+  Upstream::ClusterManager::ClusterInfoMap cluster_map;
+  ON_CALL(server_.cluster_manager_, clusters()).WillByDefault(ReturnPointee(&cluster_map));
+
+  NiceMock<Upstream::MockClusterMockPrioritySet> cluster;
+  cluster_map.emplace(cluster.info_->name_, cluster);
+  cluster.info_->stats_store_.textReadoutFromString("version_text");
+
+  Upstream::MockHostSet* host_set = cluster.priority_set_.getMockHostSet(0);
+  auto host = std::make_shared<NiceMock<Upstream::MockHost>>();
+  host_set->hosts_.emplace_back(host);
+  Stats::PrimitiveCounter rq_total;
+  std::vector<std::pair<absl::string_view, Stats::PrimitiveCounterReference>> counters = {
+      {"rq_total", rq_total}};
+  ON_CALL(*host, counters()).WillByDefault(Invoke([&counters]() { return counters; }));
+  auto metadata = std::make_shared<envoy::config::core::v3::Metadata>(
+      TestUtility::parseYaml<envoy::config::core::v3::Metadata>(R"EOF(
+filter_metadata:
+  envoy.lb:
+    version: v1
+)EOF"));
+  ON_CALL(*host, metadata()).WillByDefault(Return(metadata));
+
+  Buffer::OwnedImpl response;
+  Http::TestResponseHeaderMapImpl header_map;
+  EXPECT_EQ(Http::Code::OK, getCallback("/memory/clusters", header_map, response));
+  const std::string output = response.toString();
+  EXPECT_THAT(output, HasSubstr("fake_cluster::stats_text_readouts::1\n"));
+  EXPECT_THAT(output, HasSubstr("fake_cluster::stat_name_bytes::"));
+  EXPECT_THAT(output, HasSubstr("fake_cluster::host_sets::1\n"));
+  EXPECT_THAT(output, HasSubstr("fake_cluster::hosts::1\n"));
+  EXPECT_THAT(output, HasSubstr("fake_cluster::host_stats::1\n"));
+  EXPECT_THAT(output, HasSubstr(fmt::format("fake_cluster::host_metadata_bytes::{}\n",
+                                            metadata->SpaceUsedLong())));
+  EXPECT_THAT(output, HasSubstr(fmt::format("fake_cluster::metadata_bytes::{}\n",
+                                            cluster.info_->metadata_.SpaceUsedLong())));
+}
+
 } // namespace Server
 } // namespace Envoy
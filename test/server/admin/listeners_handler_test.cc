@@ -0,0 +1,39 @@
+#include <functional>
+#include <vector>
+
+#include "test/mocks/network/mocks.h"
+#include "test/server/admin/admin_instance.h"
+
+using testing::_;
+using testing::HasSubstr;
+using testing::Return;
+
+namespace Envoy {
+namespace Server {
+
+INSTANTIATE_TEST_SUITE_P(IpVersions, AdminInstanceTest,
+                         testing::ValuesIn(TestEnvironment::getIpVersionsForTest()),
+                         TestUtility::ipTestParamsToString);
+
+TEST_P(AdminInstanceTest, ListenersMemory) {
+  NiceMock<Network::MockListenerConfig> listener;
+  listener.name_ = "fake_listener";
+  listener.scope_.counterFromString("downstream_cx_total");
+  listener.scope_.gaugeFromString("downstream_cx_active", Stats::Gauge::ImportMode::Accumulate);
+  std::vector<std::reference_wrapper<Network::ListenerConfig>> listeners = {listener};
+  ON_CALL(server_.listener_manager_, listeners(_)).WillByDefault(Return(listeners));
+
+  Buffer::OwnedImpl response;
+  Http::TestResponseHeaderMapImpl header_map;
+  EXPECT_EQ(Http::Code::OK, getCallback("/memory/listeners", header_map, response));
+  const std::string output = response.toString();
+  EXPECT_THAT(output, HasSubstr("fake_listener::stats_counters::1\n"));
+  EXPECT_THAT(output, HasSubstr("fake_listener::stats_gauges::1\n"));
+  EXPECT_THAT(output, HasSubstr("fake_listener::stats_histograms::0\n"));
+  EXPECT_THAT(output, HasSubstr("fake_listener::stats_text_readouts::0\n"));
+  EXPECT_THAT(output, HasSubstr("fake_listener::stat_name_bytes::"));
+  EXPECT_THAT(output, HasSubstr("fake_listener::access_logs::0\n"));
+}
+
+} // namespace Server
+} // namespace Envoy
@@ -701,5 +701,27 @@ envoy_cluster_test_1_upstream_cx_total{a_tag_name="a.tag-value"} 0
   EXPECT_EQ(expected_output, response.toString());
 }
 
+// The response is built up in chunks; make sure output spanning several of them comes out intact
+// and that tags shared by many stats are rendered the same way for each of them.
+TEST_F(PrometheusStatsFormatterTest, OutputLargerThanOneChunk) {
+  const Stats::StatName tag_name = makeStat("envoy.cluster-name");
+  std::string expected_output = "# TYPE envoy_cluster_upstream_cx_total counter\n";
+  for (uint32_t i = 0; i < 2000; ++i) {
+    const std::string cluster = fmt::format("cluster_{:04}", i);
+    addCounter("cluster.upstream_cx_total", {{tag_name, makeStat(cluster)}});
+    counters_.back()->add(i);
+    absl::StrAppend(&expected_output, "envoy_cluster_upstream_cx_total{envoy_cluster_name=\"",
+                    cluster, "\"} ", i, "\n");
+  }
+  expected_output.append("\n");
+
+  Buffer::OwnedImpl response;
+  auto size = PrometheusStatsFormatter::statsAsPrometheus(counters_, gauges_, histograms_, response,
+                                                          false, absl::nullopt);
+  EXPECT_EQ(1UL, size);
+  EXPECT_GT(expected_output.size(), 64UL * 1024);
+  EXPECT_EQ(expected_output, response.toString());
+}
+
 } // namespace Server
 } // namespace Envoy
@@ -41,6 +41,7 @@ using testing::InSequence;
 using testing::Invoke;
 using testing::InvokeWithoutArgs;
 using testing::Return;
+using testing::ReturnRef;
 using testing::SaveArg;
 using testing::StrictMock;
 
@@ -96,6 +97,86 @@ TEST(ServerInstanceUtil, flushHelper) {
   InstanceUtil::flushMetricsToSinks(sinks, mock_store);
 }
 
+class ChangedMetricsSink : public Stats::MockSink {
+public:
+  bool flushChangedMetricsOnly() const override {
+    ++flush_changed_metrics_only_calls_;
+    return true;
+  }
+
+  mutable uint32_t flush_changed_metrics_only_calls_{};
+};
+
+TEST(ServerInstanceUtil, flushChangedMetricsOnly) {
+  Stats::TestUtil::TestStore store;
+  Stats::Counter& active_counter = store.counter("active_counter");
+  store.counter("idle_counter").inc();
+  Stats::Gauge& active_gauge = store.gauge("active_gauge", Stats::Gauge::ImportMode::Accumulate);
+  store.gauge("idle_gauge", Stats::Gauge::ImportMode::Accumulate).set(5);
+  store.textReadout("text").set("is important");
+
+  // Latch the stats set above.
+  std::list<Stats::SinkPtr> sinks;
+  InstanceUtil::flushMetricsToSinks(sinks, store);
+
+  Stats::MockSink* full_sink = new StrictMock<Stats::MockSink>();
+  sinks.emplace_back(full_sink);
+  ChangedMetricsSink* changed_sink = new StrictMock<ChangedMetricsSink>();
+  sinks.emplace_back(changed_sink);
+
+  active_counter.inc();
+  active_gauge.set(3);
+  EXPECT_CALL(*full_sink, flush(_)).WillOnce(Invoke([](Stats::MetricSnapshot& snapshot) {
+    EXPECT_EQ(snapshot.counters().size(), 2);
+    EXPECT_EQ(snapshot.gauges().size(), 2);
+    EXPECT_EQ(snapshot.textReadouts().size(), 1);
+  }));
+  EXPECT_CALL(*changed_sink, flush(_)).WillOnce(Invoke([](Stats::MetricSnapshot& snapshot) {
+    ASSERT_EQ(snapshot.counters().size(), 1);
+    EXPECT_EQ(snapshot.counters()[0].counter_.get().name(), "active_counter");
+    EXPECT_EQ(snapshot.counters()[0].delta_, 1);
+
+    ASSERT_EQ(snapshot.gauges().size(), 1);
+    EXPECT_EQ(snapshot.gauges()[0].get().name(), "active_gauge");
+    EXPECT_EQ(snapshot.gauges()[0].get().value(), 3);
+
+    ASSERT_EQ(snapshot.textReadouts().size(), 1);
+    EXPECT_EQ(snapshot.textReadouts()[0].get().name(), "text");
+  }));
+  InstanceUtil::flushMetricsToSinks(sinks, store);
+  // The sink is only asked once per flush.
+  EXPECT_EQ(1, changed_sink->flush_changed_metrics_only_calls_);
+
+  // Nothing changed since the previous flush.
+  EXPECT_CALL(*full_sink, flush(_));
+  EXPECT_CALL(*changed_sink, flush(_)).WillOnce(Invoke([](Stats::MetricSnapshot& snapshot) {
+    EXPECT_TRUE(snapshot.counters().empty());
+    EXPECT_TRUE(snapshot.gauges().empty());
+  }));
+  InstanceUtil::flushMetricsToSinks(sinks, store);
+
+  // Only histograms with samples in the last interval are passed on.
+  NiceMock<Stats::MockStore> mock_store;
+  auto idle_histogram = std::make_shared<NiceMock<Stats::MockParentHistogram>>();
+  auto active_histogram = std::make_shared<NiceMock<Stats::MockParentHistogram>>();
+  histogram_t* samples = hist_alloc();
+  hist_insert_intscale(samples, 1, 0, 1);
+  Stats::HistogramStatisticsImpl active_statistics(samples);
+  hist_free(samples);
+  ON_CALL(*active_histogram, intervalStatistics()).WillByDefault(ReturnRef(active_statistics));
+  std::vector<Stats::ParentHistogramSharedPtr> parent_histograms = {idle_histogram,
+                                                                    active_histogram};
+  ON_CALL(mock_store, histograms).WillByDefault(Return(parent_histograms));
+  EXPECT_CALL(*full_sink, flush(_)).WillOnce(Invoke([](Stats::MetricSnapshot& snapshot) {
+    EXPECT_EQ(snapshot.histograms().size(), 2);
+  }));
+  EXPECT_CALL(*changed_sink, flush(_)).WillOnce(Invoke([&](Stats::MetricSnapshot& snapshot) {
+    ASSERT_EQ(snapshot.histograms().size(), 1);
+    EXPECT_EQ(&snapshot.histograms()[0].get(), active_histogram.get());
+  }));
+  InstanceUtil::flushMetricsToSinks(sinks, mock_store);
+}
+
 class RunHelperTest : public testing::Test {
 public:
   RunHelperTest() {